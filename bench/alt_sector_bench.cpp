@@ -0,0 +1,92 @@
+// DL message vs TL bandwidth as a function of the alternative sector size.
+// The message queue is kept saturated with full-size UART Stream Transport
+// messages and eight TL flits are offered per DL flit, so each row shows the
+// payload split a fully loaded link would see.
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "ualink/dl_flit.h"
+#include "ualink/dl_message_queue.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+
+constexpr std::size_t kFlits = 100'000;
+constexpr std::size_t kTlFlitsOffered = 8;
+constexpr std::array<std::size_t, 8> kSectorDwords = {1, 2, 4, 8, 14, 16, 24, 32};
+
+// Payload DWords are non-zero, so any all-zero DWord in a sector is No-Op fill
+static DlMessage make_transport_message() {
+  UartStreamTransportMessage msg{};
+  msg.stream_id = 0;
+  for (std::uint32_t payload_index = 0; payload_index < kMaxUartTransportDwords - 1; ++payload_index) {
+    msg.payload_dwords.push_back(0x5A000000U | payload_index);
+  }
+  return msg;
+}
+
+static bool is_no_op_fill(const std::array<std::byte, 4> &dword) {
+  return dword == std::array<std::byte, 4>{};
+}
+
+struct SectorRun {
+  std::size_t message_bytes{0};
+  std::size_t tl_bytes{0};
+};
+
+static SectorRun run_sector_size(std::size_t sector_dwords) {
+  const DlMessage msg = make_transport_message();
+  const DlAltSectorConfig alt_sector{.dwords = sector_dwords};
+  const std::vector<TlFlit> tl_flits(kTlFlitsOffered);
+  DlMessageQueue queue;
+  std::size_t queued_dwords = 0;
+
+  ExplicitFlitHeaderFields header{};
+  header.op = 0;
+  header.payload = true;
+  header.flit_seq_no = 1;
+
+  SectorRun run;
+  for (std::size_t flit_index = 0; flit_index < kFlits; ++flit_index) {
+    while (queued_dwords + kMaxUartTransportDwords <= kDlMessageRingDwords) {
+      queue.enqueue(msg);
+      queued_dwords += kMaxUartTransportDwords;
+    }
+
+    const DlFlit flit = DlSerializer::serialize(tl_flits, header, &queue, alt_sector);
+    const DlDeserializedResult result = DlDeserializer::deserialize_ex(flit, alt_sector);
+    for (const auto &dword : result.dl_message_dwords) {
+      if (!is_no_op_fill(dword)) {
+        run.message_bytes += 4;
+        queued_dwords--;
+      }
+    }
+    run.tl_bytes += result.tl_flits.size() * kTlFlitBytes;
+    do_not_optimize(flit.crc);
+  }
+  return run;
+}
+
+int main() {
+  std::cout << std::left << std::setw(16) << "sector_dwords" << std::right << std::setw(18) << "dl_msg_B/flit"
+            << std::setw(14) << "tl_B/flit" << std::setw(14) << "dl_msg_%" << std::setw(14) << "tl_%" << "\n";
+
+  for (const std::size_t sector_dwords : kSectorDwords) {
+    const SectorRun run = run_sector_size(sector_dwords);
+    const double message_per_flit = static_cast<double>(run.message_bytes) / static_cast<double>(kFlits);
+    const double tl_per_flit = static_cast<double>(run.tl_bytes) / static_cast<double>(kFlits);
+
+    std::cout << std::left << std::setw(16) << sector_dwords << std::right << std::fixed << std::setprecision(1)
+              << std::setw(18) << message_per_flit << std::setw(14) << tl_per_flit << std::setw(14)
+              << 100.0 * message_per_flit / static_cast<double>(kDlPayloadBytes) << std::setw(14)
+              << 100.0 * tl_per_flit / static_cast<double>(kDlPayloadBytes) << "\n";
+  }
+  return 0;
+}
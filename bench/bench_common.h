@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace ualink::bench {
+
+// Keeps a value observable so the optimizer cannot discard the work producing it
+template <typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Run fn() `iterations` times and return the mean cost in nanoseconds
+template <typename Fn>
+[[nodiscard]] double measure_ns_per_op(std::size_t iterations, Fn &&fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    fn();
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  const std::chrono::duration<double, std::nano> elapsed = stop - start;
+  return elapsed.count() / static_cast<double>(iterations);
+}
+
+inline void print_result(std::string_view bench, std::string_view variant, double ns_per_op) {
+  std::cout << std::left << std::setw(28) << bench << std::setw(32) << variant << std::right << std::fixed
+            << std::setprecision(2) << std::setw(12) << ns_per_op << " ns/op\n";
+}
+
+} // namespace ualink::bench
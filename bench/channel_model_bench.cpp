@@ -0,0 +1,59 @@
+// DlBitErrorChannel cost per flit and observed flit error rate across BERs.
+// Implied goodput assumes go-back-N recovery that resends kReplayWindow flits
+// per corrupted flit.
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+
+#include "ualink/dl_channel_model.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kFlits = 20'000'000;
+constexpr double kReplayWindow = 32.0;
+
+struct ChannelCase {
+  const char *label;
+  double bit_error_rate;
+  double mean_burst_length;
+};
+
+static void run_case(const ChannelCase &channel_case) {
+  DlBitErrorChannel channel({.bit_error_rate = channel_case.bit_error_rate,
+                             .mean_burst_length = channel_case.mean_burst_length,
+                             .seed = 0xC0FFEEULL});
+  DlFlit wire{};
+
+  const double ns_per_flit = measure_ns_per_op(kFlits, [&]() { do_not_optimize(channel.transmit(wire)); });
+  print_result("channel_per_flit", channel_case.label, ns_per_flit);
+
+  const auto stats = channel.get_stats();
+  const double flit_error_rate = static_cast<double>(stats.flits_corrupted) / static_cast<double>(stats.flits);
+  const double goodput = 1.0 / (1.0 + (flit_error_rate * kReplayWindow));
+  std::cout << "  flits=" << stats.flits << " corrupted=" << stats.flits_corrupted
+            << " bits_flipped=" << stats.bits_flipped << std::scientific << std::setprecision(3)
+            << " FER=" << flit_error_rate << std::fixed << std::setprecision(6) << " goodput(W=32)=" << goodput
+            << "\n";
+}
+
+int main() {
+  constexpr std::array<ChannelCase, 5> kCases = {{
+      {"BER 1e-12", 1e-12, 1.0},
+      {"BER 1e-9", 1e-9, 1.0},
+      {"BER 1e-6", 1e-6, 1.0},
+      {"BER 1e-6 burst 8", 1e-6, 8.0},
+      {"BER 1e-4", 1e-4, 1.0},
+  }};
+
+  for (const auto &channel_case : kCases) {
+    run_case(channel_case);
+  }
+  return 0;
+}
@@ -0,0 +1,176 @@
+// Credit-return message rate and sender stalls under sustained load. One
+// port, four VCs with kCreditsPerVc credits each, and a sender offering one
+// Request beat per cycle. Beats and credit returns each take kLinkCycles,
+// and the receiver frees buffers kServiceCycles after arrival, in bursts
+// every kFreeInterval cycles (a batched drain, as a memory controller
+// retires work). The credit return interface carries at most one
+// UpliCreditReturn per cycle.
+//
+//   single  : one credit per message, lowest owed VC first
+//   batched : UpliCreditManager::generate_credit_return (up to 4 credits,
+//             round-robin over VCs and pool)
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "ualink/prng.h"
+#include "ualink/upli_credit.h"
+
+using namespace ualink::upli;
+
+constexpr std::size_t kCycles = 500'000;
+constexpr std::uint64_t kLinkCycles = 8;
+constexpr std::uint64_t kServiceCycles = 16;
+constexpr std::uint64_t kFreeInterval = 8;
+constexpr std::size_t kCreditsPerVc = 12;
+
+enum class Policy { kSingle, kBatched };
+
+struct Result {
+  double messages_per_credit{0};
+  double stall_fraction{0};  // Cycles the sender's next beat had no credit
+  std::array<double, kMaxVirtualChannels> mean_return_cycles{};
+};
+
+// The single-credit baseline, built from the same owed counters
+static std::optional<UpliCreditReturn> single_credit_return(std::array<std::size_t, kMaxVirtualChannels> &owed) {
+  for (std::size_t vc = 0; vc < kMaxVirtualChannels; ++vc) {
+    if (owed[vc] != 0) {
+      owed[vc]--;
+      UpliCreditReturn credits{};
+      credits.credit_init_done[0] = true;
+      credits.ports[0].credit_vld = true;
+      credits.ports[0].credit_vc = static_cast<std::uint8_t>(vc);
+      return credits;
+    }
+  }
+  return std::nullopt;
+}
+
+static Result run(Policy policy, const std::array<unsigned, kMaxVirtualChannels> &vc_weights) {
+  PortCreditConfig config{};
+  for (auto &vc : config.vc_config) {
+    vc.initial_credits = kCreditsPerVc;
+  }
+  UpliCreditManager sender;
+  sender.configure_port(0, config);
+  sender.initialize_credits();
+  UpliCreditManager receiver;
+  receiver.initialize_credits();
+  std::array<std::size_t, kMaxVirtualChannels> single_owed{};
+
+  std::deque<std::pair<std::uint64_t, std::uint8_t>> beats_in_flight;  // (free cycle, vc)
+  std::deque<std::pair<std::uint64_t, UpliCreditReturn>> returns_in_flight;
+  std::array<std::deque<std::uint64_t>, kMaxVirtualChannels> freed_at;  // For return latency
+  std::array<std::uint64_t, kMaxVirtualChannels> return_latency{};
+  std::array<std::size_t, kMaxVirtualChannels> returned{};
+
+  ualink::Xoshiro256StarStar rng(11);
+  unsigned weight_total = 0;
+  for (const unsigned weight : vc_weights) {
+    weight_total += weight;
+  }
+  const auto pick_vc = [&]() {
+    unsigned draw = static_cast<unsigned>(rng() % weight_total);
+    std::uint8_t vc = 0;
+    while (draw >= vc_weights[vc]) {
+      draw -= vc_weights[vc];
+      vc++;
+    }
+    return vc;
+  };
+
+  std::size_t messages = 0;
+  std::size_t stalls = 0;
+  std::uint8_t next_vc = pick_vc();
+
+  for (std::uint64_t now = 0; now < kCycles; ++now) {
+    // Credit returns arriving at the sender
+    while (!returns_in_flight.empty() && returns_in_flight.front().first <= now) {
+      const UpliCreditReturn &credits = returns_in_flight.front().second;
+      const auto &port_credit = credits.ports[0];
+      for (std::size_t credit = 0; credit <= port_credit.credit_num; ++credit) {
+        return_latency[port_credit.credit_vc] += now - freed_at[port_credit.credit_vc].front();
+        freed_at[port_credit.credit_vc].pop_front();
+        returned[port_credit.credit_vc]++;
+      }
+      sender.process_credit_return(credits);
+      returns_in_flight.pop_front();
+    }
+
+    // Receiver frees buffers, then sends at most one credit return
+    while (now % kFreeInterval == 0 && !beats_in_flight.empty() && beats_in_flight.front().first <= now) {
+      const std::uint8_t vc = beats_in_flight.front().second;
+      freed_at[vc].push_back(now);
+      if (policy == Policy::kBatched) {
+        receiver.owe_credits(0, vc, 1);
+      } else {
+        single_owed[vc]++;
+      }
+      beats_in_flight.pop_front();
+    }
+    std::optional<UpliCreditReturn> credits;
+    if (policy == Policy::kBatched) {
+      credits = receiver.generate_credit_return();
+    } else {
+      credits = single_credit_return(single_owed);
+    }
+    if (credits.has_value()) {
+      messages++;
+      returns_in_flight.emplace_back(now + kLinkCycles, *credits);
+    }
+
+    // Sender: one beat per cycle, in order
+    if (sender.consume_credit(0, next_vc)) {
+      beats_in_flight.emplace_back(now + kLinkCycles + kServiceCycles, next_vc);
+      next_vc = pick_vc();
+    } else {
+      stalls++;
+    }
+  }
+
+  Result result;
+  std::size_t total_returned = 0;
+  for (std::size_t vc = 0; vc < kMaxVirtualChannels; ++vc) {
+    total_returned += returned[vc];
+    if (returned[vc] != 0) {
+      result.mean_return_cycles[vc] = static_cast<double>(return_latency[vc]) / static_cast<double>(returned[vc]);
+    }
+  }
+  result.messages_per_credit = static_cast<double>(messages) / static_cast<double>(total_returned);
+  result.stall_fraction = static_cast<double>(stalls) / static_cast<double>(kCycles);
+  return result;
+}
+
+static void report(std::string_view load, std::string_view policy, const Result &result) {
+  std::cout << std::left << std::setw(12) << load << std::setw(10) << policy << std::right << std::fixed
+            << std::setprecision(3) << std::setw(10) << result.messages_per_credit << std::setw(10)
+            << result.stall_fraction << std::setprecision(1);
+  for (const double cycles : result.mean_return_cycles) {
+    std::cout << std::setw(9) << cycles;
+  }
+  std::cout << "\n";
+}
+
+int main() {
+  std::cout << std::left << std::setw(12) << "load" << std::setw(10) << "policy" << std::right << std::setw(10)
+            << "msg/cred" << std::setw(10) << "stall" << std::setw(9) << "ret_vc0" << std::setw(9) << "ret_vc1"
+            << std::setw(9) << "ret_vc2" << std::setw(9) << "ret_vc3" << "\n";
+
+  const std::array<unsigned, kMaxVirtualChannels> uniform{1, 1, 1, 1};
+  const std::array<unsigned, kMaxVirtualChannels> skewed{7, 1, 1, 1};
+  report("uniform", "single", run(Policy::kSingle, uniform));
+  report("uniform", "batched", run(Policy::kBatched, uniform));
+  report("vc0 70%", "single", run(Policy::kSingle, skewed));
+  report("vc0 70%", "batched", run(Policy::kBatched, skewed));
+  return 0;
+}
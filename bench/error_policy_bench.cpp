@@ -0,0 +1,41 @@
+// Per-flit cost of RandomErrorPolicy (mt19937 + uniform draw every flit)
+// versus GeometricErrorPolicy (skip sampling: a counter decrement per flit).
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "ualink/dl_error_injection.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kFlits = 50'000'000;
+constexpr std::uint64_t kSeed = 0x5EEDULL;
+
+template <typename Policy>
+static double run_policy(Policy &policy) {
+  return measure_ns_per_op(kFlits, [&]() { do_not_optimize(policy()); });
+}
+
+int main() {
+  constexpr std::array<double, 3> kProbabilities = {1e-3, 1e-6, 1e-12};
+  constexpr std::array<const char *, 3> kLabels = {" p=1e-3", " p=1e-6", " p=1e-12"};
+
+  for (std::size_t probability_index = 0; probability_index < kProbabilities.size(); ++probability_index) {
+    const double probability = kProbabilities[probability_index];
+    const std::string variant_suffix = kLabels[probability_index];
+
+    RandomErrorPolicy random_policy(probability);
+    print_result("error_policy_per_flit", "RandomErrorPolicy" + variant_suffix, run_policy(random_policy));
+
+    GeometricErrorPolicy geometric_policy(probability, kSeed);
+    print_result("error_policy_per_flit", "GeometricErrorPolicy" + variant_suffix, run_policy(geometric_policy));
+  }
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Wire bytes per read request: full 64-byte TL flits against half-flits
+// paired two per slot by TlHalfFlitPacker. Both are carried by the streaming
+// DlStreamPacker, so the DL flit count reflects the TL slot count directly.
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "ualink/dl_flit.h"
+#include "ualink/dl_stream_packer.h"
+#include "ualink/tl_flit.h"
+
+namespace dl = ualink::dl;
+namespace tl = ualink::tl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+
+constexpr std::size_t kRequests = 100'000;
+constexpr std::size_t kRuns = 20;
+
+static tl::TlReadRequest make_request(std::size_t index) {
+  tl::TlReadRequest request{};
+  request.header.size = 0x3F;
+  request.header.tag = static_cast<std::uint16_t>(index & 0xFFFU);
+  request.header.address = (static_cast<std::uint64_t>(index) * 256U) & 0x3FFFFFFFFFFULL;
+  return request;
+}
+
+static std::vector<dl::TlFlit> to_dl_slots(const std::vector<std::array<std::byte, tl::kTlFlitBytes>> &slots) {
+  std::vector<dl::TlFlit> tl_flits(slots.size());
+  for (std::size_t slot_index = 0; slot_index < slots.size(); ++slot_index) {
+    std::copy_n(slots[slot_index].begin(), tl::kTlFlitBytes, tl_flits[slot_index].data.begin());
+  }
+  return tl_flits;
+}
+
+// Drain every slot through the streaming DL packer; returns DL flits used
+static std::size_t pack_dl(const std::vector<dl::TlFlit> &tl_flits) {
+  dl::DlStreamPacker packer;
+  dl::ExplicitFlitHeaderFields header{};
+  header.flit_seq_no = 1;
+  std::size_t next = 0;
+  std::size_t dl_flits = 0;
+  while (next < tl_flits.size() || packer.has_partial_flit()) {
+    std::size_t consumed = 0;
+    const dl::DlFlit flit =
+        packer.pack(std::span<const dl::TlFlit>(tl_flits).subspan(next), header, nullptr, &consumed);
+    do_not_optimize(flit.crc);
+    next += consumed;
+    dl_flits++;
+  }
+  return dl_flits;
+}
+
+static void print_row(std::string_view variant, std::size_t slots, std::size_t dl_flits, double ns_per_request) {
+  const double wire_bytes = static_cast<double>(dl_flits * dl::kDlFlitBytes) / static_cast<double>(kRequests);
+  std::cout << std::left << std::setw(28) << variant << std::right << std::setw(10) << slots << std::setw(10)
+            << dl_flits << std::fixed << std::setprecision(1) << std::setw(14) << wire_bytes << std::setprecision(1)
+            << std::setw(14) << ns_per_request << "\n";
+}
+
+static void bench_full_flits() {
+  std::vector<std::array<std::byte, tl::kTlFlitBytes>> slots;
+  std::size_t dl_flits = 0;
+  const double ns_per_run = measure_ns_per_op(kRuns, [&]() {
+    slots.clear();
+    for (std::size_t index = 0; index < kRequests; ++index) {
+      slots.push_back(tl::TlSerializer::serialize_read_request(make_request(index)));
+    }
+    dl_flits = pack_dl(to_dl_slots(slots));
+  });
+  print_row("full 64B read requests", slots.size(), dl_flits, ns_per_run / static_cast<double>(kRequests));
+}
+
+static void bench_half_flits() {
+  std::vector<std::array<std::byte, tl::kTlFlitBytes>> slots;
+  std::size_t dl_flits = 0;
+  const double ns_per_run = measure_ns_per_op(kRuns, [&]() {
+    tl::TlHalfFlitPacker packer;
+    for (std::size_t index = 0; index < kRequests; ++index) {
+      packer.push_half_flit(tl::TlSerializer::serialize_read_request_half(make_request(index)));
+    }
+    packer.flush();
+    slots = packer.take_slots();
+    dl_flits = pack_dl(to_dl_slots(slots));
+  });
+  print_row("paired 32B half-flits", slots.size(), dl_flits, ns_per_run / static_cast<double>(kRequests));
+}
+
+int main() {
+  std::cout << std::left << std::setw(28) << "variant" << std::right << std::setw(10) << "slots" << std::setw(10)
+            << "dl_flits" << std::setw(14) << "wire_B/req" << std::setw(14) << "ns/req" << "\n";
+
+  bench_full_flits();
+  bench_half_flits();
+  return 0;
+}
@@ -0,0 +1,49 @@
+// DlMessageProcessor receive cost per DWord: valid messages, and a flood of
+// reserved-type DWords (rejected by the dispatch table without throwing).
+
+#include "bench_common.h"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "ualink/dl_message_processor.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kBatches = 200'000;
+constexpr std::size_t kDwordsPerBatch = 20; // one-DWord sectors: 5 segments x 4 flits
+
+static void bench_batch(std::string_view variant, const std::array<std::byte, 4> &dword) {
+  DlMessageProcessor processor;
+  processor.set_tl_rate_callback([](const TlRateNotification &msg) { do_not_optimize(msg.rate); });
+  const std::vector<std::array<std::byte, 4>> dwords(kDwordsPerBatch, dword);
+
+  const double ns_per_batch = measure_ns_per_op(kBatches, [&]() {
+    const DlMessageBatchResult result = processor.process_dwords(dwords, 0);
+    do_not_optimize(result.accepted);
+  });
+  print_result("message_processor_per_dword", variant, ns_per_batch / static_cast<double>(kDwordsPerBatch));
+}
+
+int main() {
+  TlRateNotification rate{};
+  rate.rate = 0x1234;
+  rate.common = make_common(DlBasicMessageType::kTlRateNotification);
+  bench_batch("TL rate notification", serialize_tl_rate_notification(rate));
+
+  // Basic class, reserved mtype 0b001
+  std::array<std::byte, 4> reserved_type{};
+  reserved_type[3] = std::byte{0b01000000};
+  bench_batch("reserved mtype flood", reserved_type);
+
+  // Reserved mclass 0b0011
+  std::array<std::byte, 4> reserved_class{};
+  reserved_class[3] = std::byte{0b00001100};
+  bench_batch("reserved mclass flood", reserved_class);
+  return 0;
+}
@@ -0,0 +1,114 @@
+// TL bytes per wire byte: fixed-slot DlSerializer against the cross-flit
+// DlStreamPacker, on an idle message path and with a DL message pending in
+// every segment. TL flits are always available, so each row shows the
+// steady-state payload a fully loaded link carries.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "ualink/dl_flit.h"
+#include "ualink/dl_message_queue.h"
+#include "ualink/dl_stream_packer.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+
+constexpr std::size_t kDlFlits = 100'000;
+constexpr std::size_t kFixedTlFlitsOffered = 8; // a 9th fixed slot would start inside segment 4's header space
+constexpr std::size_t kStreamTlFlitsOffered = 16;
+
+static ExplicitFlitHeaderFields make_header() {
+  ExplicitFlitHeaderFields header{};
+  header.flit_seq_no = 1;
+  return header;
+}
+
+// Keep one TL rate notification per segment queued
+static void top_up(DlMessageQueue &queue) {
+  TlRateNotification msg{};
+  msg.common = make_common(DlBasicMessageType::kTlRateNotification);
+  while (queue.get_stats().basic_enqueued - queue.get_stats().basic_sent < kDlSegmentCount) {
+    queue.enqueue(msg);
+  }
+}
+
+static void print_row(std::string_view variant, std::size_t tl_bytes, double ns_per_flit) {
+  const double tl_per_flit = static_cast<double>(tl_bytes) / static_cast<double>(kDlFlits);
+  std::cout << std::left << std::setw(36) << variant << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << tl_per_flit << std::setprecision(3) << std::setw(14)
+            << tl_per_flit / static_cast<double>(kDlFlitBytes) << std::setprecision(1) << std::setw(14) << ns_per_flit
+            << "\n";
+}
+
+static void bench_fixed(bool with_messages) {
+  const std::vector<TlFlit> tl_flits(kFixedTlFlitsOffered);
+  DlMessageQueue queue;
+  DlMessageQueue *queue_ptr = nullptr;
+  if (with_messages) {
+    queue_ptr = &queue;
+  }
+
+  std::size_t tl_bytes = 0;
+  const double ns_per_flit = measure_ns_per_op(kDlFlits, [&]() {
+    top_up(queue);
+    std::size_t packed = 0;
+    const DlFlit flit = DlSerializer::serialize(tl_flits, make_header(), queue_ptr, &packed);
+    tl_bytes += packed * kTlFlitBytes;
+    do_not_optimize(flit.crc);
+  });
+
+  if (with_messages) {
+    print_row("fixed slots, message per segment", tl_bytes, ns_per_flit);
+  } else {
+    print_row("fixed slots, no messages", tl_bytes, ns_per_flit);
+  }
+}
+
+static void bench_stream(bool with_messages, std::size_t sector_dwords) {
+  const std::vector<TlFlit> tl_flits(kStreamTlFlitsOffered);
+  const DlAltSectorConfig alt_sector{.dwords = sector_dwords};
+  DlStreamPacker packer(alt_sector);
+  DlStreamDepacker depacker(alt_sector);
+  DlMessageQueue queue;
+  DlMessageQueue *queue_ptr = nullptr;
+  if (with_messages) {
+    queue_ptr = &queue;
+  }
+
+  // Count TL bytes delivered by the depacker, so the straddling carry is verified too
+  std::size_t tl_bytes = 0;
+  const double ns_per_flit = measure_ns_per_op(kDlFlits, [&]() {
+    top_up(queue);
+    const DlFlit flit = packer.pack(tl_flits, make_header(), queue_ptr, nullptr);
+    const DlDeserializedResult result = depacker.unpack(flit);
+    tl_bytes += result.tl_flits.size() * kTlFlitBytes;
+    do_not_optimize(flit.crc);
+  });
+
+  if (!with_messages) {
+    print_row("stream pack+unpack, no messages", tl_bytes, ns_per_flit);
+  } else if (sector_dwords == 1) {
+    print_row("stream pack+unpack, 1DW sector", tl_bytes, ns_per_flit);
+  } else {
+    print_row("stream pack+unpack, 14DW sector", tl_bytes, ns_per_flit);
+  }
+}
+
+int main() {
+  std::cout << std::left << std::setw(36) << "variant" << std::right << std::setw(12) << "tl_B/flit" << std::setw(14)
+            << "tl_B/wire_B" << std::setw(14) << "ns/flit" << "\n";
+
+  bench_fixed(false);
+  bench_fixed(true);
+  bench_stream(false, 1);
+  bench_stream(true, 1);
+  bench_stream(true, 14);
+  return 0;
+}
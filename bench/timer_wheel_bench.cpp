@@ -0,0 +1,122 @@
+// Timeout tracking for many links: DlTimerWheel schedule/cancel/expiry cost,
+// against polling one DlMessageProcessor Basic timeout per link every tick
+// (polling wins when every link is busy, the wheel when few are).
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ualink/dl_message_processor.h"
+#include "ualink/dl_timer_wheel.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::uint32_t kLinks = 4096;
+constexpr std::uint64_t kTimeoutUs = 1;
+constexpr std::size_t kTicks = 2'000;
+
+// Each link sends one Basic request per tick; the response cancels it
+static void bench_wheel_schedule_cancel() {
+  DlTimerWheel wheel({.capacity = kLinks});
+  std::vector<DlTimerHandle> handles(kLinks);
+  std::uint64_t now = 0;
+
+  const double ns_per_tick = measure_ns_per_op(kTicks, [&]() {
+    for (std::uint32_t link = 0; link < kLinks; ++link) {
+      handles[link] = wheel.schedule(DlTimerKind::kBasicRequest, link, 0, now + kTimeoutUs);
+    }
+    for (std::uint32_t link = 0; link < kLinks; ++link) {
+      do_not_optimize(wheel.cancel(handles[link]));
+    }
+    now++;
+    do_not_optimize(wheel.advance(now, {}));
+  });
+  print_result("timer_wheel_per_timer", "schedule + cancel", ns_per_tick / static_cast<double>(kLinks));
+}
+
+// No responses: every request times out, delivered as one batch per tick
+static void bench_wheel_schedule_expire() {
+  DlTimerWheel wheel({.capacity = kLinks});
+  std::uint64_t now = 0;
+  std::size_t expired = 0;
+  const DlTimerWheel::ExpiryBatchCallback on_expired = [&expired](std::span<const DlTimerExpiry> batch) {
+    expired += batch.size();
+  };
+
+  const double ns_per_tick = measure_ns_per_op(kTicks, [&]() {
+    for (std::uint32_t link = 0; link < kLinks; ++link) {
+      [[maybe_unused]] const DlTimerHandle handle =
+          wheel.schedule(DlTimerKind::kBasicRequest, link, 0, now + kTimeoutUs);
+    }
+    now++;
+    do_not_optimize(wheel.advance(now, on_expired));
+  });
+  do_not_optimize(expired);
+  print_result("timer_wheel_per_timer", "schedule + batched expiry", ns_per_tick / static_cast<double>(kLinks));
+}
+
+// Baseline: one processor per link, each polled every tick
+static void bench_processor_polling() {
+  std::vector<DlMessageProcessor> processors(kLinks);
+  std::uint64_t now = 0;
+
+  const double ns_per_tick = measure_ns_per_op(kTicks, [&]() {
+    for (DlMessageProcessor &processor : processors) {
+      processor.start_basic_timeout(0, now);
+    }
+    now++;
+    for (DlMessageProcessor &processor : processors) {
+      do_not_optimize(processor.check_basic_timeout(now, kTimeoutUs));
+    }
+  });
+  print_result("timer_wheel_per_timer", "per-link processor polling", ns_per_tick / static_cast<double>(kLinks));
+}
+
+// Sparse load: 64 of the links have a request outstanding each tick. The
+// wheel only touches those; polling still visits every link.
+constexpr std::uint32_t kBusyLinks = 64;
+
+static void bench_sparse_wheel() {
+  DlTimerWheel wheel({.capacity = kLinks});
+  std::uint64_t now = 0;
+
+  const double ns_per_tick = measure_ns_per_op(kTicks, [&]() {
+    for (std::uint32_t link = 0; link < kBusyLinks; ++link) {
+      [[maybe_unused]] const DlTimerHandle handle =
+          wheel.schedule(DlTimerKind::kBasicRequest, link * (kLinks / kBusyLinks), 0, now + kTimeoutUs);
+    }
+    now++;
+    do_not_optimize(wheel.advance(now, {}));
+  });
+  print_result("timeouts_per_tick_sparse", "timer wheel", ns_per_tick);
+}
+
+static void bench_sparse_polling() {
+  std::vector<DlMessageProcessor> processors(kLinks);
+  std::uint64_t now = 0;
+
+  const double ns_per_tick = measure_ns_per_op(kTicks, [&]() {
+    for (std::uint32_t link = 0; link < kBusyLinks; ++link) {
+      processors[link * (kLinks / kBusyLinks)].start_basic_timeout(0, now);
+    }
+    now++;
+    for (DlMessageProcessor &processor : processors) {
+      do_not_optimize(processor.check_basic_timeout(now, kTimeoutUs));
+    }
+  });
+  print_result("timeouts_per_tick_sparse", "per-link processor polling", ns_per_tick);
+}
+
+int main() {
+  bench_wheel_schedule_cancel();
+  bench_wheel_schedule_expire();
+  bench_processor_polling();
+  bench_sparse_wheel();
+  bench_sparse_polling();
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Control-field compression on synthetic workloads: TlFieldPacker bytes and
+// flits against one uncompressed field per 64-byte TL flit (what
+// UaLinkEndpoint sends today). The ratio column is uncompressed field bytes
+// over encoded field bytes; flit_ratio also counts alignment and tail NOPs.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "ualink/prng.h"
+#include "ualink/tl_field_packer.h"
+
+using namespace ualink::tl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+
+constexpr std::size_t kFields = 100'000;
+constexpr std::size_t kRuns = 10;
+
+static UncompressedRequestField make_read(std::uint64_t byte_address, std::uint16_t tag, std::uint16_t srcaccid) {
+  UncompressedRequestField request{};
+  request.cmd = kTlReqCmdRead;
+  request.tag = tag & 0x7FFU;
+  request.attr = 0xFF;
+  request.len = 15;
+  request.addr = byte_address >> 2;
+  request.srcaccid = srcaccid;
+  request.dstaccid = 0x001;
+  return request;
+}
+
+static UncompressedResponseField make_response(std::uint16_t tag, bool write, std::uint8_t status) {
+  UncompressedResponseField response{};
+  response.tag = tag & 0x7FFU;
+  response.rd_wr = write;
+  response.status = status;
+  response.srcaccid = 0x001;
+  response.dstaccid = 0x002;
+  return response;
+}
+
+// Streaming reads: 8 accelerators each walking their own 1MB region
+static std::vector<TlControlField> sequential_reads() {
+  std::vector<TlControlField> fields;
+  for (std::size_t index = 0; index < kFields; ++index) {
+    const std::uint16_t stream = static_cast<std::uint16_t>(index % 8);
+    const std::uint64_t address = (static_cast<std::uint64_t>(stream) << 30) + ((index / 8) * 64 % (1U << 20));
+    fields.emplace_back(make_read(address, static_cast<std::uint16_t>(index), stream));
+  }
+  return fields;
+}
+
+// Uniformly random 64B reads over 1GB: almost every request misses
+static std::vector<TlControlField> random_reads() {
+  ualink::Xoshiro256StarStar rng(1);
+  std::vector<TlControlField> fields;
+  for (std::size_t index = 0; index < kFields; ++index) {
+    const std::uint64_t address = (rng() % (1ULL << 30)) & ~0x3FULL;
+    fields.emplace_back(make_read(address, static_cast<std::uint16_t>(index), 0));
+  }
+  return fields;
+}
+
+// Half requests over a 4MB working set, half responses, 1% error status
+static std::vector<TlControlField> mixed_traffic() {
+  ualink::Xoshiro256StarStar rng(2);
+  std::vector<TlControlField> fields;
+  for (std::size_t index = 0; index < kFields; ++index) {
+    const std::uint16_t tag = static_cast<std::uint16_t>(index);
+    if (index % 2 == 0) {
+      const std::uint64_t address = (rng() % (4ULL << 20)) & ~0x3FULL;
+      fields.emplace_back(make_read(address, tag, 0));
+    } else {
+      std::uint8_t status = 0;
+      if (rng() % 100 == 0) {
+        status = 0x2;
+      }
+      fields.emplace_back(make_response(tag, (rng() % 2) == 0, status));
+    }
+  }
+  return fields;
+}
+
+static void run(std::string_view workload, const std::vector<TlControlField> &fields) {
+  TlFieldPacker::Stats stats{};
+  const double ns_per_run = measure_ns_per_op(kRuns, [&]() {
+    TlFieldPacker packer;
+    TlFieldUnpacker unpacker;
+    for (const TlControlField &field : fields) {
+      packer.push(field);
+    }
+    packer.flush();
+    for (const auto &flit : packer.take_flits()) {
+      do_not_optimize(unpacker.unpack(flit).size());
+    }
+    stats = packer.get_stats();
+  });
+
+  const double compressed_share =
+      static_cast<double>(stats.requests_compressed + stats.responses_compressed) / static_cast<double>(fields.size());
+  const double ratio = static_cast<double>(stats.uncompressed_bytes) / static_cast<double>(stats.field_bytes);
+  const double flit_ratio = static_cast<double>(fields.size()) / static_cast<double>(stats.flits);
+  std::cout << std::left << std::setw(20) << workload << std::right << std::fixed << std::setprecision(3)
+            << std::setw(12) << compressed_share << std::setw(10) << ratio << std::setw(12) << flit_ratio
+            << std::setprecision(1) << std::setw(14) << ns_per_run / static_cast<double>(fields.size()) << "\n";
+}
+
+int main() {
+  std::cout << std::left << std::setw(20) << "workload" << std::right << std::setw(12) << "compressed" << std::setw(10)
+            << "ratio" << std::setw(12) << "flit_ratio" << std::setw(14) << "ns/field" << "\n";
+
+  run("sequential reads", sequential_reads());
+  run("random reads", random_reads());
+  run("mixed req/rsp", mixed_traffic());
+  return 0;
+}
@@ -0,0 +1,106 @@
+// Compares std::function-based pacing / error injection (DlPacingController,
+// DlErrorInjector) against the same policies bound at compile time
+// (PolicyTxPacing / PolicyTxErrors), and against the no-op policies.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ualink/dl_tx_pipeline.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kDecisionIterations = 20'000'000;
+constexpr std::size_t kPipelineIterations = 200'000;
+constexpr std::size_t kUnlimited = std::numeric_limits<std::size_t>::max();
+
+static void bench_policy_decisions() {
+  DlPacingController pacing;
+  pacing.set_tx_callback(SimpleTxRateLimiter(kUnlimited));
+  DlErrorInjector injector;
+  injector.enable();
+  injector.set_policy(RandomErrorPolicy(0.0));
+
+  const double type_erased_ns = measure_ns_per_op(kDecisionIterations, [&]() {
+    do_not_optimize(pacing.check_tx_pacing(1, kTlFlitBytes));
+    do_not_optimize(injector.get_next_error());
+  });
+  print_result("policy_decision", "std::function", type_erased_ns);
+
+  SimpleTxRateLimiter limiter(kUnlimited);
+  RandomErrorPolicy errors(0.0);
+  PolicyTxPacing pacing_stage{limiter};
+  PolicyTxErrors error_stage{errors};
+  const double templated_ns = measure_ns_per_op(kDecisionIterations, [&]() {
+    do_not_optimize(pacing_stage.check(1, kTlFlitBytes));
+    do_not_optimize(error_stage.next_error());
+  });
+  print_result("policy_decision", "template policy", templated_ns);
+
+  NoTxPacingPolicy no_pacing;
+  NoErrorPolicy no_errors;
+  PolicyTxPacing no_pacing_stage{no_pacing};
+  PolicyTxErrors no_error_stage{no_errors};
+  const double no_op_ns = measure_ns_per_op(kDecisionIterations, [&]() {
+    do_not_optimize(no_pacing_stage.check(1, kTlFlitBytes));
+    do_not_optimize(no_error_stage.next_error());
+  });
+  print_result("policy_decision", "template no-op", no_op_ns);
+}
+
+template <typename PacingStage, typename ErrorStage>
+static double run_pipeline(PacingStage pacing_stage, ErrorStage error_stage) {
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlTxPipeline pipeline{tx_controller, replay_buffer, pacing_stage, error_stage, NoTxMessages{}};
+
+  const std::vector<TlFlit> tl_flits(kMaxTlFlitsPerDlFlit);
+  std::size_t wire_flits = 0;
+  const auto transmit = [&](const DlFlit &flit) {
+    do_not_optimize(flit.crc);
+    wire_flits++;
+  };
+
+  const double ns_per_flit = measure_ns_per_op(kPipelineIterations, [&]() {
+    const auto result = pipeline.transmit(tl_flits, transmit);
+    do_not_optimize(result.dl_flits_transmitted);
+    replay_buffer.clear();
+  });
+  if (wire_flits != kPipelineIterations) {
+    std::cerr << "run_pipeline: expected " << kPipelineIterations << " flits, got " << wire_flits << "\n";
+  }
+  return ns_per_flit;
+}
+
+static void bench_pipeline() {
+  DlPacingController pacing;
+  pacing.set_tx_callback(SimpleTxRateLimiter(kUnlimited));
+  DlErrorInjector injector;
+  injector.enable();
+  injector.set_policy(RandomErrorPolicy(0.0));
+  print_result("tx_pipeline_per_dl_flit", "std::function",
+               run_pipeline(ControllerTxPacing{pacing}, InjectorTxErrors{injector}));
+
+  SimpleTxRateLimiter limiter(kUnlimited);
+  RandomErrorPolicy errors(0.0);
+  print_result("tx_pipeline_per_dl_flit", "template policy",
+               run_pipeline(PolicyTxPacing{limiter}, PolicyTxErrors{errors}));
+
+  NoTxPacingPolicy no_pacing;
+  NoErrorPolicy no_errors;
+  print_result("tx_pipeline_per_dl_flit", "template no-op",
+               run_pipeline(PolicyTxPacing{no_pacing}, PolicyTxErrors{no_errors}));
+}
+
+int main() {
+  bench_policy_decisions();
+  bench_pipeline();
+  return 0;
+}
@@ -0,0 +1,90 @@
+// UART Stream Transport throughput: full-size (32-payload) transport messages
+// are enqueued and drained DWord by DWord, both straight from the queue and
+// through DlSerializer::serialize(..., DlMessageQueue*) with the default
+// one-DWord alternative sector and with a 14-DWord sector.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+#include "ualink/dl_flit.h"
+#include "ualink/dl_message_queue.h"
+
+using namespace ualink::dl;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kRounds = 200'000;
+constexpr std::size_t kMessagesPerRound = kDlMessageRingDwords / kMaxUartTransportDwords;
+constexpr std::size_t kDwordsPerRound = kMessagesPerRound * kMaxUartTransportDwords;
+
+static UartStreamTransportMessage make_transport_message() {
+  UartStreamTransportMessage msg{};
+  msg.stream_id = 0;
+  for (std::uint32_t payload_index = 0; payload_index < kMaxUartTransportDwords - 1; ++payload_index) {
+    msg.payload_dwords.push_back(0x5A000000U | payload_index);
+  }
+  return msg;
+}
+
+static void print_throughput(std::string_view variant, double ns_per_round) {
+  const double ns_per_dword = ns_per_round / static_cast<double>(kDwordsPerRound);
+  print_result("uart_stream_per_dword", variant, ns_per_dword);
+  std::cout << "  -> " << (1e3 / ns_per_dword) << " MDWords/s\n";
+}
+
+static void bench_queue_drain() {
+  const DlMessage msg = make_transport_message();
+  DlMessageQueue queue;
+
+  std::size_t dwords_drained = 0;
+  const double ns_per_round = measure_ns_per_op(kRounds, [&]() {
+    for (std::size_t message_index = 0; message_index < kMessagesPerRound; ++message_index) {
+      queue.enqueue(msg);
+    }
+    while (auto dword = queue.pop_next_dword()) {
+      do_not_optimize(*dword);
+      dwords_drained++;
+    }
+  });
+  if (dwords_drained != kRounds * kDwordsPerRound) {
+    std::cerr << "bench_queue_drain: expected " << kRounds * kDwordsPerRound << " DWords, got " << dwords_drained
+              << "\n";
+  }
+  print_throughput("enqueue + pop_next_dword", ns_per_round);
+}
+
+static void bench_serializer_drain(std::string_view variant, const DlAltSectorConfig &alt_sector) {
+  const DlMessage msg = make_transport_message();
+  DlMessageQueue queue;
+  ExplicitFlitHeaderFields header{};
+  header.op = 0;
+  header.payload = true;
+  header.flit_seq_no = 1;
+
+  std::size_t dl_flits = 0;
+  const double ns_per_round = measure_ns_per_op(kRounds, [&]() {
+    for (std::size_t message_index = 0; message_index < kMessagesPerRound; ++message_index) {
+      queue.enqueue(msg);
+    }
+    while (queue.has_pending_messages()) {
+      const DlFlit flit = DlSerializer::serialize({}, header, &queue, alt_sector);
+      do_not_optimize(flit.crc);
+      dl_flits++;
+    }
+  });
+  print_throughput(variant, ns_per_round);
+  std::cout << "  -> " << static_cast<double>(dl_flits) / static_cast<double>(kRounds) << " DL flits per "
+            << kDwordsPerRound << " DWords\n";
+}
+
+int main() {
+  bench_queue_drain();
+  bench_serializer_drain("enqueue + DlSerializer", DlAltSectorConfig{});
+  bench_serializer_drain("enqueue + DlSerializer 14DW", DlAltSectorConfig{.dwords = 14});
+  return 0;
+}
@@ -0,0 +1,155 @@
+// Cross-thread credit accounting: cost of one consume + return pair when
+// several sender threads share one credit manager. Each thread loops
+// try-consume / return on one port 0 VC, so every thread both takes and
+// gives back credits.
+//
+//   mutex  : UpliCreditManager behind one std::mutex
+//   packed : one std::atomic per (port, VC), adjacent in memory (4 VCs of a
+//            port share a cache line), CAS consume / fetch_add return
+//   padded : UpliConcurrentCreditManager (one cache line per counter)
+//
+// "distinct" gives each thread its own VC; "shared" puts all threads on VC 0.
+// On a single-CPU host the threads time-slice, so the numbers show overhead,
+// not cache-line contention.
+
+#include "bench_common.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ualink/upli_concurrent_credit.h"
+#include "ualink/upli_credit.h"
+
+using namespace ualink::upli;
+using ualink::bench::do_not_optimize;
+using ualink::bench::print_result;
+
+constexpr std::size_t kOpsPerThread = 1'000'000;
+constexpr std::size_t kCreditsPerVc = 64;
+
+static PortCreditConfig make_config() {
+  PortCreditConfig config{};
+  for (auto &vc_config : config.vc_config) {
+    vc_config.initial_credits = kCreditsPerVc;
+  }
+  return config;
+}
+
+class MutexCredits {
+public:
+  MutexCredits() {
+    manager_.configure_port(0, make_config());
+    manager_.initialize_credits();
+  }
+
+  bool try_consume(std::uint8_t vc) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return manager_.consume_credit(0, vc);
+  }
+
+  void give_back(std::uint8_t vc) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    manager_.return_credits(0, vc, 1);
+  }
+
+private:
+  std::mutex mutex_;
+  UpliCreditManager manager_;
+};
+
+class PackedCredits {
+public:
+  PackedCredits() {
+    for (auto &counter : available_) {
+      counter.store(kCreditsPerVc, std::memory_order_relaxed);
+    }
+  }
+
+  bool try_consume(std::uint8_t vc) {
+    std::size_t available = available_[vc].load(std::memory_order_relaxed);
+    while (available != 0) {
+      if (available_[vc].compare_exchange_weak(available, available - 1, std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void give_back(std::uint8_t vc) { available_[vc].fetch_add(1, std::memory_order_release); }
+
+private:
+  std::array<std::atomic<std::size_t>, kMaxVirtualChannels> available_{};
+};
+
+class PaddedCredits {
+public:
+  PaddedCredits() {
+    manager_.configure_port(0, make_config());
+    manager_.initialize_credits();
+  }
+
+  bool try_consume(std::uint8_t vc) { return manager_.try_consume_credit(0, vc); }
+
+  void give_back(std::uint8_t vc) { do_not_optimize(manager_.return_credits(0, vc, 1)); }
+
+private:
+  UpliConcurrentCreditManager manager_;
+};
+
+// ns per consume + return pair, over all threads' work
+template <typename Credits>
+static double run(std::size_t threads, bool shared_vc) {
+  Credits credits;
+  std::atomic<bool> go{false};
+  std::vector<std::thread> workers;
+  for (std::size_t thread_index = 0; thread_index < threads; ++thread_index) {
+    std::uint8_t vc = 0;
+    if (!shared_vc) {
+      vc = static_cast<std::uint8_t>(thread_index % kMaxVirtualChannels);
+    }
+    workers.emplace_back([&credits, &go, vc]() {
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (std::size_t op = 0; op < kOpsPerThread; ++op) {
+        if (credits.try_consume(vc)) {
+          credits.give_back(vc);
+        }
+      }
+    });
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  const auto stop = std::chrono::steady_clock::now();
+  const std::chrono::duration<double, std::nano> elapsed = stop - start;
+  return elapsed.count() / static_cast<double>(threads * kOpsPerThread);
+}
+
+int main() {
+  std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+  for (const bool shared_vc : {false, true}) {
+    std::string layout = "distinct VCs";
+    if (shared_vc) {
+      layout = "shared VC";
+    }
+    for (const std::size_t threads : {1, 2, 4}) {
+      const std::string bench = std::to_string(threads) + " threads, " + layout;
+      print_result(bench, "mutex", run<MutexCredits>(threads, shared_vc));
+      print_result(bench, "packed", run<PackedCredits>(threads, shared_vc));
+      print_result(bench, "padded", run<PaddedCredits>(threads, shared_vc));
+    }
+  }
+  return 0;
+}
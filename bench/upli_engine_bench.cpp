@@ -0,0 +1,159 @@
+// Closed-loop UPLI originator/completer throughput and latency. The
+// originator issues reads and writes to random 64B addresses in 1GB, keeping
+// up to `outstanding` tags in flight. Beats cross a link with kLinkCycles of
+// latency each way, and the completer's memory answers after kMemoryCycles.
+// The table reports transactions per UPLI cycle, mean and max round-trip
+// latency in cycles, and host-side simulation rate.
+
+#include "bench_common.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "ualink/prng.h"
+#include "ualink/upli_completer.h"
+#include "ualink/upli_originator.h"
+
+using namespace ualink::upli;
+using ualink::bench::do_not_optimize;
+
+constexpr std::size_t kCycles = 200'000;
+constexpr std::uint64_t kLinkCycles = 8;
+constexpr std::uint64_t kMemoryCycles = 32;
+
+// Fixed-latency pipe: items pushed at cycle c pop at c + latency
+template <typename T>
+class DelayLine {
+ public:
+  explicit DelayLine(std::uint64_t latency) : latency_(latency) {}
+  void push(std::uint64_t now, const T &item) { items_.emplace_back(now + latency_, item); }
+  template <typename Fn>
+  void drain(std::uint64_t now, Fn &&fn) {
+    while (!items_.empty() && items_.front().first <= now) {
+      const T item = items_.front().second;
+      items_.pop_front();
+      fn(item);
+    }
+  }
+
+ private:
+  std::uint64_t latency_;
+  std::deque<std::pair<std::uint64_t, T>> items_;
+};
+
+struct Result {
+  double transactions_per_cycle{0};
+  double mean_latency{0};
+  std::uint64_t max_latency{0};
+  double mtps{0};  // Simulated transactions per host second, millions
+};
+
+static Result run(unsigned write_percent, std::size_t outstanding) {
+  UpliOriginatorConfig originator_config{};
+  originator_config.max_outstanding_requests = outstanding;
+  originator_config.queue_depth = outstanding;
+  for (auto &vc : originator_config.request_credits.vc_config) {
+    vc.initial_credits = outstanding;
+  }
+  UpliOriginator originator(originator_config);
+  UpliCompleter completer(UpliCompleterConfig{.physical_acc_id = 1, .queue_depth = outstanding});
+
+  std::uint64_t now = 0;
+  DelayLine<UpliRequestFields> request_wire(kLinkCycles);
+  DelayLine<UpliOrigDataFields> data_wire(kLinkCycles);
+  DelayLine<UpliRdRspFields> rd_rsp_wire(kLinkCycles);
+  DelayLine<UpliWrRspFields> wr_rsp_wire(kLinkCycles);
+  DelayLine<UpliCreditReturn> credit_wire(kLinkCycles);
+  DelayLine<UpliCompleterRequest> memory(kMemoryCycles);
+
+  originator.set_request_sink([&](const UpliRequestFields &beat) { request_wire.push(now, beat); });
+  originator.set_orig_data_sink([&](const UpliOrigDataFields &beat) { data_wire.push(now, beat); });
+  completer.set_rd_rsp_sink([&](const UpliRdRspFields &beat) { rd_rsp_wire.push(now, beat); });
+  completer.set_wr_rsp_sink([&](const UpliWrRspFields &beat) { wr_rsp_wire.push(now, beat); });
+  completer.set_credit_return_sink([&](const UpliCreditReturn &credits) { credit_wire.push(now, credits); });
+  completer.set_request_callback(
+      [&](const UpliCompleterRequest &request, std::span<const std::byte>) { memory.push(now, request); });
+
+  std::size_t completed = 0;
+  originator.set_read_completion_callback([&](std::uint16_t, RspStatus, std::span<const std::byte> data) {
+    do_not_optimize(data[0]);
+    completed++;
+  });
+  originator.set_write_completion_callback([&](std::uint16_t, RspStatus) { completed++; });
+
+  ualink::Xoshiro256StarStar rng(write_percent + 1);
+  const std::array<std::byte, kUpliDataBeatBytes> payload{};
+
+  const auto start = std::chrono::steady_clock::now();
+  for (; now < kCycles; ++now) {
+    request_wire.drain(now, [&](const UpliRequestFields &beat) { completer.process_request(beat); });
+    data_wire.drain(now, [&](const UpliOrigDataFields &beat) { completer.process_orig_data(beat); });
+    memory.drain(now, [&](const UpliCompleterRequest &request) {
+      bool queued = false;
+      if (request.cmd == ReqCmd::kRead) {
+        queued = completer.send_read_response(request.port_id, request.tag, RspStatus::kOkay, payload);
+      } else {
+        queued = completer.send_write_response(request.port_id, request.tag, RspStatus::kOkay);
+      }
+      do_not_optimize(queued);
+    });
+    rd_rsp_wire.drain(now, [&](const UpliRdRspFields &beat) { originator.process_rd_rsp(beat); });
+    wr_rsp_wire.drain(now, [&](const UpliWrRspFields &beat) { originator.process_wr_rsp(beat); });
+    credit_wire.drain(now, [&](const UpliCreditReturn &credits) { originator.process_credit_return(credits); });
+
+    // Offer new requests until the originator pushes back
+    for (;;) {
+      const std::uint64_t address = (rng() % (1ULL << 30)) & ~0x3FULL;
+      const auto vc = static_cast<std::uint8_t>(rng() % kMaxVirtualChannels);
+      std::optional<std::uint16_t> tag;
+      if (rng() % 100 < write_percent) {
+        tag = originator.send_write(1, address, payload, vc);
+      } else {
+        tag = originator.send_read(1, address, vc);
+      }
+      if (!tag.has_value()) {
+        break;
+      }
+    }
+
+    originator.advance_cycle();
+    completer.advance_cycle();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  const auto stats = originator.get_stats();
+  Result result;
+  result.transactions_per_cycle = static_cast<double>(completed) / static_cast<double>(kCycles);
+  result.mean_latency = static_cast<double>(stats.total_latency_cycles) / static_cast<double>(completed);
+  result.max_latency = stats.max_latency_cycles;
+  result.mtps = static_cast<double>(completed) / elapsed.count() / 1e6;
+  return result;
+}
+
+int main() {
+  std::cout << "link " << kLinkCycles << " cycles each way, memory " << kMemoryCycles << " cycles\n";
+  std::cout << std::left << std::setw(10) << "writes" << std::right << std::setw(12) << "outstanding" << std::setw(12)
+            << "txn/cycle" << std::setw(14) << "mean_lat" << std::setw(10) << "max_lat" << std::setw(14)
+            << "Mtxn/s(host)" << "\n";
+
+  for (const unsigned write_percent : {0U, 30U, 50U, 100U}) {
+    for (const std::size_t outstanding : {8U, 32U, 128U}) {
+      const Result result = run(write_percent, outstanding);
+      std::cout << std::left << std::setw(10) << (std::to_string(write_percent) + "%") << std::right
+                << std::setw(12) << outstanding << std::fixed << std::setprecision(3) << std::setw(12)
+                << result.transactions_per_cycle << std::setprecision(1) << std::setw(14) << result.mean_latency
+                << std::setw(10) << result.max_latency << std::setprecision(2) << std::setw(14) << result.mtps
+                << "\n";
+    }
+  }
+  return 0;
+}
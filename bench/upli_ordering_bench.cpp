@@ -0,0 +1,127 @@
+// Issue cost against outstanding-request depth. Each op checks ordering,
+// tracks one new request and completes the oldest, holding `depth` requests
+// in flight over a 1MB working set on four VCs. "linear scan" is the
+// vector-of-in-flight design from docs/phase4-upli-design.md; "hash index" is
+// UpliOrderingManager.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ualink/prng.h"
+#include "ualink/upli_ordering.h"
+
+using namespace ualink::upli;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kOps = 200'000;
+constexpr std::uint64_t kWorkingSetBytes = 1ULL << 20;
+
+struct Request {
+  std::uint64_t address{0};
+  std::uint8_t vc{0};
+};
+
+// The design-doc sketch: O(outstanding) scans for conflicts and completion
+class LinearScanOrdering {
+ public:
+  [[nodiscard]] bool can_issue_request(std::uint64_t address, std::uint8_t vc) const {
+    const std::uint64_t region = address / kRegionAlignmentBytes;
+    for (const InFlight &request : in_flight_) {
+      if (request.address / kRegionAlignmentBytes == region && request.vc != vc) {
+        return false;
+      }
+    }
+    return true;
+  }
+  void track_request(std::uint64_t address, std::uint8_t vc, std::uint16_t tag) {
+    in_flight_.push_back(InFlight{address, vc, tag});
+  }
+  void complete_request(std::uint16_t tag) {
+    for (auto entry = in_flight_.begin(); entry != in_flight_.end(); ++entry) {
+      if (entry->tag == tag) {
+        in_flight_.erase(entry);
+        return;
+      }
+    }
+  }
+
+ private:
+  struct InFlight {
+    std::uint64_t address;
+    std::uint8_t vc;
+    std::uint16_t tag;
+  };
+  std::vector<InFlight> in_flight_;
+};
+
+static std::vector<Request> make_requests() {
+  ualink::Xoshiro256StarStar rng(7);
+  std::vector<Request> requests(kOps + kUpliTagCount);
+  for (Request &request : requests) {
+    request.address = (rng() % kWorkingSetBytes) & ~0x3FULL;
+    request.vc = static_cast<std::uint8_t>(rng() % kMaxVirtualChannels);
+  }
+  return requests;
+}
+
+// Tags cycle through [0, depth): the oldest in flight is always tag (op % depth)
+template <typename Ordering, typename CanIssue, typename Track>
+static double run(Ordering &ordering, std::size_t depth, const std::vector<Request> &requests, CanIssue can_issue,
+                  Track track) {
+  for (std::size_t index = 0; index < depth; ++index) {
+    track(ordering, requests[index], static_cast<std::uint16_t>(index));
+  }
+
+  std::size_t next = depth;
+  std::size_t issued = 0;
+  const double ns = measure_ns_per_op(kOps, [&]() {
+    const std::uint16_t tag = static_cast<std::uint16_t>(next % depth);
+    ordering.complete_request(tag);
+    const Request &request = requests[next % requests.size()];
+    if (can_issue(ordering, request)) {
+      issued++;
+    }
+    track(ordering, request, tag);
+    next++;
+  });
+  do_not_optimize(issued);
+  return ns;
+}
+
+int main() {
+  const std::vector<Request> requests = make_requests();
+
+  for (const std::size_t depth : {16U, 64U, 256U, 1024U, 2048U}) {
+    const std::string variant = "depth " + std::to_string(depth);
+
+    LinearScanOrdering linear;
+    print_result("ordering linear scan", variant,
+                 run(
+                     linear, depth, requests,
+                     [](const LinearScanOrdering &ordering, const Request &request) {
+                       return ordering.can_issue_request(request.address, request.vc);
+                     },
+                     [](LinearScanOrdering &ordering, const Request &request, std::uint16_t tag) {
+                       ordering.track_request(request.address, request.vc, tag);
+                     }));
+
+    UpliOrderingManager indexed(OrderingMode::kRelaxed);
+    print_result("ordering hash index", variant,
+                 run(
+                     indexed, depth, requests,
+                     [](const UpliOrderingManager &ordering, const Request &request) {
+                       return ordering.can_issue_request(request.address, 0, request.vc);
+                     },
+                     [](UpliOrderingManager &ordering, const Request &request, std::uint16_t tag) {
+                       ordering.track_request(request.address, 0, request.vc, tag);
+                     }));
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+// Per-port bandwidth and head-of-line blocking under each bifurcation mode.
+// Every active port keeps its Request channel saturated. Port 0 sends one beat
+// in four on VC 1, whose credit only returns every 16 cycles; the other ports
+// never stall. The table shows the 1/N bandwidth split, the slots port 0
+// loses to credit stalls, and that the strict TDM slots isolate the other
+// ports from it.
+
+#include "bench_common.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "ualink/upli_tdm.h"
+
+using namespace ualink::upli;
+using ualink::bench::do_not_optimize;
+using ualink::bench::measure_ns_per_op;
+using ualink::bench::print_result;
+
+constexpr std::size_t kCycles = 100'000;
+constexpr std::size_t kQueueDepth = 32;
+constexpr std::uint64_t kVc1CreditInterval = 16;
+
+static void refill(UpliTdmScheduler &scheduler, std::uint16_t &next_tag) {
+  for (std::uint8_t port = 0; port < scheduler.num_active_ports(); ++port) {
+    while (scheduler.queue_size(port, UpliChannel::kRequest) < kQueueDepth) {
+      std::uint8_t vc = 0;
+      if (port == 0 && next_tag % 4 == 0) {
+        vc = 1;
+      }
+      const UpliTdmBeat beat{.tag = next_tag++, .vc = vc};
+      if (!scheduler.enqueue(port, UpliChannel::kRequest, beat)) {
+        return;
+      }
+    }
+  }
+}
+
+static void run(std::string_view name, BifurcationMode mode) {
+  UpliTdmScheduler scheduler(mode, kQueueDepth);
+  bool vc1_credit = false;
+  scheduler.set_ready_predicate([&](std::uint8_t, UpliChannel, const UpliTdmBeat &beat) {
+    return beat.vc != 1 || vc1_credit;
+  });
+  const auto on_grant = [&](std::uint8_t, UpliChannel, const UpliTdmBeat &beat) {
+    if (beat.vc == 1) {
+      vc1_credit = false;
+    }
+    do_not_optimize(beat.tag);
+  };
+
+  std::uint16_t next_tag = 0;
+  const double ns_per_run = measure_ns_per_op(1, [&]() {
+    for (std::size_t cycle = 0; cycle < kCycles; ++cycle) {
+      if (cycle % kVc1CreditInterval == 0) {
+        vc1_credit = true;
+      }
+      refill(scheduler, next_tag);
+      scheduler.advance_cycle(on_grant);
+    }
+  });
+
+  for (std::uint8_t port = 0; port < scheduler.num_active_ports(); ++port) {
+    const auto &stats = scheduler.get_stats(port, UpliChannel::kRequest);
+    const double hol_per_slot =
+        static_cast<double>(stats.hol_blocked_beats) / static_cast<double>(stats.slots_owned);
+    std::cout << std::left << std::setw(6) << name << std::right << std::setw(6) << static_cast<int>(port)
+              << std::fixed << std::setprecision(4) << std::setw(14) << scheduler.port_throughput(port)
+              << std::setw(12) << stats.beats_sent << std::setw(12) << stats.blocked_slots << std::setprecision(2)
+              << std::setw(14) << hol_per_slot << "\n";
+  }
+  print_result("upli_tdm", std::string(name) + " advance_cycle+refill", ns_per_run / static_cast<double>(kCycles));
+}
+
+int main() {
+  std::cout << std::left << std::setw(6) << "mode" << std::right << std::setw(6) << "port" << std::setw(14)
+            << "beats/cycle" << std::setw(12) << "beats" << std::setw(12) << "blocked" << std::setw(14)
+            << "hol/slot" << "\n";
+
+  run("x4", BifurcationMode::kX4);
+  run("x2", BifurcationMode::kX2);
+  run("x1", BifurcationMode::kX1);
+  return 0;
+}
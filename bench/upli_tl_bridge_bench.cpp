@@ -0,0 +1,230 @@
+// End-to-end UPLI traffic over the DL link. Each side is an originator or
+// completer, a UpliTlBridge and a UaLinkEndpoint; DL flits cross a wire that
+// delivers them the next cycle. The completer's memory answers after
+// kMemoryCycles. Credit returns travel beside the link, as UPLI sideband.
+// Both bridges flush every `flush_interval` cycles: a longer interval fills
+// more of each DL flit at the cost of latency. Transfers are 64 bytes (one
+// beat) or 256 bytes (four beats under one request). The table reports
+// transactions per UPLI cycle, payload bytes per cycle, mean round-trip
+// latency in cycles, TL and DL flits per transaction (both directions, ACKs
+// included), TL flits carried per data DL flit (kMaxTlFlitsPerDlFlit is
+// full), payload efficiency on the wire and host time per transaction.
+
+#include "bench_common.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+
+#include "ualink/prng.h"
+#include "ualink/ualink_endpoint.h"
+#include "ualink/upli_completer.h"
+#include "ualink/upli_originator.h"
+#include "ualink/upli_tl_bridge.h"
+
+using namespace ualink::upli;
+using ualink::UaLinkEndpoint;
+using ualink::bench::do_not_optimize;
+using ualink::dl::DlFlit;
+using ualink::dl::TlFlit;
+
+constexpr std::size_t kCycles = 20'000;
+constexpr std::size_t kOutstanding = 64;
+constexpr std::uint64_t kMemoryCycles = 32;
+
+struct Result {
+  double transactions_per_cycle{0};
+  double bytes_per_cycle{0};
+  double mean_latency{0};
+  double tl_flits_per_txn{0};
+  double dl_flits_per_txn{0};
+  double tl_flits_per_dl_flit{0};
+  double wire_efficiency{0};  // Payload bytes / DL flit bytes
+  double ns_per_txn{0};       // Host time
+};
+
+// Both sides of the link, wired up. Holds `this` in its callbacks, so it stays put.
+struct Link {
+  Link();
+  Link(const Link &) = delete;
+  Link &operator=(const Link &) = delete;
+
+  // Hand over the flits sent last cycle
+  void deliver() {
+    for (std::size_t count = to_completer.size(); count > 0; --count) {
+      completer_endpoint.receive_flit(to_completer.front());
+      to_completer.pop_front();
+    }
+    for (std::size_t count = to_originator.size(); count > 0; --count) {
+      originator_endpoint.receive_flit(to_originator.front());
+      to_originator.pop_front();
+    }
+  }
+
+  // Answer every request whose memory access is done
+  void answer_memory(std::span<const std::byte> payload) {
+    while (!memory.empty() && memory.front().first <= now) {
+      const UpliCompleterRequest request = memory.front().second;
+      memory.pop_front();
+      bool queued = false;
+      if (request.cmd == ReqCmd::kRead) {
+        queued = completer.send_read_response(request.port_id, request.tag, RspStatus::kOkay, payload);
+      } else {
+        queued = completer.send_write_response(request.port_id, request.tag, RspStatus::kOkay);
+      }
+      do_not_optimize(queued);
+    }
+  }
+
+  UpliOriginator originator;
+  UpliCompleter completer{UpliCompleterConfig{.physical_acc_id = 2, .queue_depth = kOutstanding}};
+  UpliTlBridge originator_bridge{{.physical_acc_id = 1}};
+  UpliTlBridge completer_bridge{{.physical_acc_id = 2}};
+  UaLinkEndpoint originator_endpoint;
+  UaLinkEndpoint completer_endpoint;
+  // Flits sent this cycle are received next cycle, so a receive never
+  // re-enters the sender
+  std::deque<DlFlit> to_completer;
+  std::deque<DlFlit> to_originator;
+  std::uint64_t now{0};
+  std::deque<std::pair<std::uint64_t, UpliCompleterRequest>> memory;
+  std::size_t completed{0};
+};
+
+static UpliOriginatorConfig make_originator_config() {
+  UpliOriginatorConfig config{};
+  config.physical_acc_id = 1;
+  config.max_outstanding_requests = kOutstanding;
+  config.queue_depth = kOutstanding;
+  for (auto &vc : config.request_credits.vc_config) {
+    vc.initial_credits = kOutstanding;
+  }
+  return config;
+}
+
+Link::Link() : originator(make_originator_config()) {
+  originator_endpoint.set_transmit_callback([this](const DlFlit &flit) { to_completer.push_back(flit); });
+  completer_endpoint.set_transmit_callback([this](const DlFlit &flit) { to_originator.push_back(flit); });
+
+  originator_bridge.set_tl_flit_sink([this](std::span<const TlFlit> flits) { return originator_endpoint.send_tl_flits(flits); });
+  completer_bridge.set_tl_flit_sink([this](std::span<const TlFlit> flits) { return completer_endpoint.send_tl_flits(flits); });
+  originator_endpoint.set_tl_flit_callback([this](const TlFlit &flit) { originator_bridge.receive_tl_flit(flit); });
+  completer_endpoint.set_tl_flit_callback([this](const TlFlit &flit) { completer_bridge.receive_tl_flit(flit); });
+
+  originator.set_request_sink([this](const UpliRequestFields &beat) { originator_bridge.send_request(beat); });
+  originator.set_orig_data_sink([this](const UpliOrigDataFields &beat) { originator_bridge.send_orig_data(beat); });
+  originator_bridge.set_rd_rsp_sink([this](const UpliRdRspFields &beat) { originator.process_rd_rsp(beat); });
+  originator_bridge.set_wr_rsp_sink([this](const UpliWrRspFields &beat) { originator.process_wr_rsp(beat); });
+
+  completer_bridge.set_request_sink([this](const UpliRequestFields &beat) { completer.process_request(beat); });
+  completer_bridge.set_orig_data_sink([this](const UpliOrigDataFields &beat) { completer.process_orig_data(beat); });
+  completer.set_rd_rsp_sink([this](const UpliRdRspFields &beat) { completer_bridge.send_rd_rsp(beat); });
+  completer.set_wr_rsp_sink([this](const UpliWrRspFields &beat) { completer_bridge.send_wr_rsp(beat); });
+  completer.set_credit_return_sink([this](const UpliCreditReturn &credits) { originator.process_credit_return(credits); });
+
+  completer.set_request_callback([this](const UpliCompleterRequest &request, std::span<const std::byte>) {
+    memory.emplace_back(now + kMemoryCycles, request);
+  });
+  originator.set_read_completion_callback([this](std::uint16_t, RspStatus, std::span<const std::byte> data) {
+    do_not_optimize(data[0]);
+    completed++;
+  });
+  originator.set_write_completion_callback([this](std::uint16_t, RspStatus) { completed++; });
+}
+
+// Offer new requests until the originator pushes back
+static void offer_requests(UpliOriginator &originator, ualink::Xoshiro256StarStar &rng, unsigned write_percent,
+                           std::span<const std::byte> payload) {
+  const std::size_t transfer_bytes = payload.size();
+  for (;;) {
+    const std::uint64_t address = (rng() % (1ULL << 30)) & ~(transfer_bytes - 1);
+    const auto vc = static_cast<std::uint8_t>(rng() % kMaxVirtualChannels);
+    std::optional<std::uint16_t> tag;
+    if (rng() % 100 < write_percent) {
+      tag = originator.send_write(2, address, payload, vc);
+    } else {
+      tag = originator.send_read(2, address, vc, transfer_bytes);
+    }
+    if (!tag.has_value()) {
+      break;
+    }
+  }
+}
+
+static Result summarize(const Link &link, double elapsed_ns, std::size_t transfer_bytes) {
+  const auto originator_stats = link.originator_endpoint.get_stats();
+  const auto completer_stats = link.completer_endpoint.get_stats();
+  const auto tl_flits = static_cast<double>(originator_stats.tx_tl_flits + completer_stats.tx_tl_flits);
+  const auto dl_flits = static_cast<double>(originator_stats.tx_dl_flits + completer_stats.tx_dl_flits +
+                                            originator_stats.tx_acks_sent + completer_stats.tx_acks_sent);
+  const auto data_flits = static_cast<double>(link.originator_bridge.get_stats().data_flits_sent +
+                                              link.completer_bridge.get_stats().data_flits_sent);
+  const auto txns = static_cast<double>(link.completed);
+
+  Result result;
+  result.transactions_per_cycle = txns / static_cast<double>(kCycles);
+  result.bytes_per_cycle = result.transactions_per_cycle * static_cast<double>(transfer_bytes);
+  result.mean_latency = static_cast<double>(link.originator.get_stats().total_latency_cycles) / txns;
+  result.tl_flits_per_txn = tl_flits / txns;
+  result.dl_flits_per_txn = dl_flits / txns;
+  result.tl_flits_per_dl_flit =
+      tl_flits / static_cast<double>(originator_stats.tx_dl_flits + completer_stats.tx_dl_flits);
+  result.wire_efficiency = (data_flits * kUpliDataBeatBytes) / (dl_flits * ualink::dl::kDlFlitBytes);
+  result.ns_per_txn = elapsed_ns / txns;
+  return result;
+}
+
+static Result run(unsigned write_percent, std::uint64_t flush_interval, std::size_t transfer_bytes) {
+  Link link;
+  ualink::Xoshiro256StarStar rng(write_percent + 1);
+  const std::array<std::byte, kUpliMaxTransferBytes> buffer{};
+  const std::span<const std::byte> payload = std::span<const std::byte>(buffer).first(transfer_bytes);
+
+  const auto start = std::chrono::steady_clock::now();
+  for (; link.now < kCycles; ++link.now) {
+    link.deliver();
+    link.answer_memory(payload);
+    offer_requests(link.originator, rng, write_percent, payload);
+
+    link.originator.advance_cycle();
+    link.completer.advance_cycle();
+    if ((link.now + 1) % flush_interval == 0) {
+      link.originator_bridge.flush();
+      link.completer_bridge.flush();
+    }
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return summarize(link, elapsed.count(), transfer_bytes);
+}
+
+int main() {
+  std::cout << kOutstanding << " outstanding, memory " << kMemoryCycles << " cycles\n";
+  std::cout << std::left << std::setw(8) << "writes" << std::right << std::setw(7) << "bytes" << std::setw(7)
+            << "flush" << std::setw(11) << "txn/cycle" << std::setw(9) << "B/cycle" << std::setw(10) << "mean_lat"
+            << std::setw(9) << "TL/txn" << std::setw(9) << "DL/txn" << std::setw(9) << "TL/DL" << std::setw(10)
+            << "wire_eff" << std::setw(14) << "ns/txn(host)" << "\n";
+
+  for (const unsigned write_percent : {0U, 50U, 100U}) {
+    for (const std::size_t transfer_bytes : {kUpliDataBeatBytes, kUpliMaxTransferBytes}) {
+      for (const std::uint64_t flush_interval : {1U, 16U}) {
+        const Result result = run(write_percent, flush_interval, transfer_bytes);
+        std::cout << std::left << std::setw(8) << (std::to_string(write_percent) + "%") << std::right << std::setw(7)
+                  << transfer_bytes << std::setw(7) << flush_interval << std::fixed << std::setprecision(3)
+                  << std::setw(11) << result.transactions_per_cycle << std::setprecision(1) << std::setw(9)
+                  << result.bytes_per_cycle << std::setw(10) << result.mean_latency << std::setprecision(3)
+                  << std::setw(9) << result.tl_flits_per_txn << std::setw(9) << result.dl_flits_per_txn
+                  << std::setw(9) << result.tl_flits_per_dl_flit << std::setw(10) << result.wire_efficiency
+                  << std::setprecision(1) << std::setw(14) << result.ns_per_txn << "\n";
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,177 @@
+// Achieved bandwidth of UpliTransferEngine against transfer size. The
+// application keeps `depth` transfers of one size in flight, each split into
+// 256-byte UPLI transactions. Beats cross a link with kLinkCycles of latency
+// each way, and the completer's memory answers after kMemoryCycles. The table
+// reports transactions per transfer, mean transfer latency in cycles, payload
+// bytes per UPLI cycle, GB/s at an assumed kUpliClockGhz, and host-side
+// simulation rate.
+//
+// The model has no clock of its own, so GB/s is bytes/cycle scaled by
+// kUpliClockGhz. One port carries at most one 64-byte data beat per cycle in
+// each direction, so 64 B/cycle is the ceiling.
+
+#include "bench_common.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ualink/upli_completer.h"
+#include "ualink/upli_transfer.h"
+
+using namespace ualink::upli;
+using ualink::bench::do_not_optimize;
+
+constexpr std::uint64_t kLinkCycles = 8;
+constexpr std::uint64_t kMemoryCycles = 32;
+constexpr double kUpliClockGhz = 2.0;  // Assumed
+constexpr std::size_t kBytesPerRun = 4 * 1024 * 1024;
+constexpr std::size_t kOutstanding = 128;
+
+// Fixed-latency pipe: items pushed at cycle c pop at c + latency
+template <typename T>
+class DelayLine {
+ public:
+  explicit DelayLine(std::uint64_t latency) : latency_(latency) {}
+  void push(std::uint64_t now, const T &item) { items_.emplace_back(now + latency_, item); }
+  template <typename Fn>
+  void drain(std::uint64_t now, Fn &&fn) {
+    while (!items_.empty() && items_.front().first <= now) {
+      const T item = items_.front().second;
+      items_.pop_front();
+      fn(item);
+    }
+  }
+
+ private:
+  std::uint64_t latency_;
+  std::deque<std::pair<std::uint64_t, T>> items_;
+};
+
+struct Result {
+  double transactions_per_transfer{0};
+  double mean_latency{0};
+  double bytes_per_cycle{0};
+  double host_mbps{0};  // Simulated payload per host second, MB
+};
+
+static Result run(bool write, std::size_t transfer_bytes, std::size_t depth) {
+  UpliTransferEngineConfig config{};
+  config.originator.max_outstanding_requests = kOutstanding;
+  config.originator.queue_depth = kOutstanding;
+  for (auto &vc : config.originator.request_credits.vc_config) {
+    vc.initial_credits = kOutstanding;
+  }
+  config.max_transfers = depth;
+  UpliTransferEngine engine(config);
+  UpliOriginator &originator = engine.originator();
+  UpliCompleter completer(
+      UpliCompleterConfig{.physical_acc_id = 1, .queue_depth = kOutstanding * kUpliMaxDataBeats});
+
+  std::uint64_t now = 0;
+  DelayLine<UpliRequestFields> request_wire(kLinkCycles);
+  DelayLine<UpliOrigDataFields> data_wire(kLinkCycles);
+  DelayLine<UpliRdRspFields> rd_rsp_wire(kLinkCycles);
+  DelayLine<UpliWrRspFields> wr_rsp_wire(kLinkCycles);
+  DelayLine<UpliCreditReturn> credit_wire(kLinkCycles);
+  DelayLine<UpliCompleterRequest> memory(kMemoryCycles);
+
+  originator.set_request_sink([&](const UpliRequestFields &beat) { request_wire.push(now, beat); });
+  originator.set_orig_data_sink([&](const UpliOrigDataFields &beat) { data_wire.push(now, beat); });
+  completer.set_rd_rsp_sink([&](const UpliRdRspFields &beat) { rd_rsp_wire.push(now, beat); });
+  completer.set_wr_rsp_sink([&](const UpliWrRspFields &beat) { wr_rsp_wire.push(now, beat); });
+  completer.set_credit_return_sink([&](const UpliCreditReturn &credits) { credit_wire.push(now, credits); });
+  completer.set_request_callback(
+      [&](const UpliCompleterRequest &request, std::span<const std::byte>) { memory.push(now, request); });
+
+  std::uint64_t total_latency = 0;
+  engine.set_completion_callback([&](const UpliTransferCompletion &completion) {
+    total_latency += completion.complete_cycle - completion.submit_cycle;
+  });
+
+  // One buffer per transfer slot; transfer k targets its own window of memory
+  std::vector<std::vector<std::byte>> buffers(depth, std::vector<std::byte>(transfer_bytes));
+  const std::array<std::byte, kUpliMaxTransferBytes> payload{};
+  const std::size_t transfers = (kBytesPerRun + transfer_bytes - 1) / transfer_bytes;
+  std::size_t submitted = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (; engine.get_stats().transfers_completed < transfers; ++now) {
+    request_wire.drain(now, [&](const UpliRequestFields &beat) { completer.process_request(beat); });
+    data_wire.drain(now, [&](const UpliOrigDataFields &beat) { completer.process_orig_data(beat); });
+    memory.drain(now, [&](const UpliCompleterRequest &request) {
+      bool queued = false;
+      if (request.cmd == ReqCmd::kRead) {
+        const std::size_t bytes = (static_cast<std::size_t>(request.len) + 1) * 4;
+        queued = completer.send_read_response(request.port_id, request.tag, RspStatus::kOkay,
+                                              std::span<const std::byte>(payload).first(bytes));
+      } else {
+        queued = completer.send_write_response(request.port_id, request.tag, RspStatus::kOkay);
+      }
+      do_not_optimize(queued);
+    });
+    rd_rsp_wire.drain(now, [&](const UpliRdRspFields &beat) { originator.process_rd_rsp(beat); });
+    wr_rsp_wire.drain(now, [&](const UpliWrRspFields &beat) { originator.process_wr_rsp(beat); });
+    credit_wire.drain(now, [&](const UpliCreditReturn &credits) { originator.process_credit_return(credits); });
+
+    // Start a new transfer in every free slot
+    while (submitted < transfers && engine.active() < depth) {
+      const std::uint64_t address = static_cast<std::uint64_t>(submitted) * transfer_bytes;
+      const std::span<std::byte> buffer(buffers[submitted % depth]);
+      std::optional<std::uint64_t> id;
+      if (write) {
+        id = engine.write(1, address, buffer);
+      } else {
+        id = engine.read(1, address, buffer);
+      }
+      do_not_optimize(id);
+      submitted++;
+    }
+
+    engine.advance_cycle();
+    completer.advance_cycle();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  const auto stats = engine.get_stats();
+  const auto bytes = static_cast<double>(stats.bytes_read + stats.bytes_written);
+  Result result;
+  result.transactions_per_transfer =
+      static_cast<double>(stats.transactions_issued) / static_cast<double>(stats.transfers_completed);
+  result.mean_latency = static_cast<double>(total_latency) / static_cast<double>(stats.transfers_completed);
+  result.bytes_per_cycle = bytes / static_cast<double>(now);
+  result.host_mbps = bytes / elapsed.count() / 1e6;
+  return result;
+}
+
+int main() {
+  std::cout << "link " << kLinkCycles << " cycles each way, memory " << kMemoryCycles << " cycles, " << kOutstanding
+            << " tags, GB/s at an assumed " << kUpliClockGhz << " GHz UPLI clock\n";
+  std::cout << std::left << std::setw(8) << "op" << std::right << std::setw(10) << "size" << std::setw(8) << "depth"
+            << std::setw(10) << "txn/xfer" << std::setw(12) << "mean_lat" << std::setw(10) << "B/cycle" << std::setw(10)
+            << "GB/s" << std::setw(14) << "MB/s(host)" << "\n";
+
+  for (const bool write : {false, true}) {
+    for (const std::size_t depth : {1U, 4U}) {
+      for (const std::size_t size : {64U, 256U, 1024U, 4096U, 16384U, 65536U}) {
+        const Result result = run(write, size, depth);
+        std::cout << std::left << std::setw(8) << (write ? "write" : "read") << std::right << std::setw(10) << size
+                  << std::setw(8) << depth << std::fixed << std::setprecision(1) << std::setw(10)
+                  << result.transactions_per_transfer << std::setw(12) << result.mean_latency << std::setprecision(2)
+                  << std::setw(10) << result.bytes_per_cycle << std::setw(10)
+                  << result.bytes_per_cycle * kUpliClockGhz << std::setprecision(1) << std::setw(14)
+                  << result.host_mbps << "\n";
+      }
+    }
+  }
+  return 0;
+}
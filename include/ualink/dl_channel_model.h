@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ualink/dl_flit.h"
+#include "ualink/prng.h"
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// DlBitErrorChannel: Bit-Error-Rate Wire Model
+// =============================================================================
+//
+// Models the physical channel between two DL endpoints by flipping real bits of
+// the 640-byte wire image (flit header, segment headers, payload, CRC - in that
+// order, MSB first within each byte). Unlike DlErrorInjector, nothing is
+// special-cased: the receiver's CRC check finds the damage on its own, and the
+// normal Replay Request path recovers it.
+//
+// Error events are placed with geometric skip sampling over a continuous bit
+// stream, so the gap to the next event carries across flits and a clean flit
+// costs a single compare and subtract.
+//
+// Burst model: each event corrupts a burst whose length is geometric with mean
+// mean_burst_length. The first and last bits of a burst are always flipped;
+// interior bits flip with burst_bit_flip_probability. A burst is truncated at
+// the end of the flit. mean_burst_length == 1 gives independent single-bit
+// errors, i.e. a plain BER channel.
+//
+// Usage:
+//   DlBitErrorChannel channel({.bit_error_rate = 1e-9, .seed = 42});
+//   pipeline.transmit(tl_flits, [&](const DlFlit &flit) {
+//     DlFlit wire = flit;
+//     channel.transmit(wire);
+//     receiver.receive_flit(wire);
+//   });
+
+constexpr std::size_t kDlFlitBits = kDlFlitBytes * 8;
+
+struct BitErrorChannelConfig {
+  double bit_error_rate{0.0};               // Probability that a wire bit starts an error event
+  double mean_burst_length{1.0};            // Mean bits per error event (1 = single-bit errors)
+  double burst_bit_flip_probability{0.5};   // Flip probability for interior burst bits
+  std::uint64_t seed{1};
+};
+
+// Flip one bit of the wire image; bit_index 0 is the MSB of flit_header[0]
+void flip_wire_bit(DlFlit &flit, std::size_t bit_index);
+
+class DlBitErrorChannel {
+public:
+  explicit DlBitErrorChannel(const BitErrorChannelConfig &config);
+
+  // Carry one flit across the channel, corrupting it in place
+  // Returns the number of bits flipped (0 for a clean flit)
+  std::size_t transmit(DlFlit &flit) {
+    stats_.flits++;
+    if (bits_until_error_ >= kDlFlitBits) {
+      bits_until_error_ -= kDlFlitBits;
+      return 0;
+    }
+    return corrupt_flit(flit);
+  }
+
+  // Restart the error sequence from a new seed
+  void reseed(std::uint64_t seed) noexcept;
+
+  [[nodiscard]] const BitErrorChannelConfig &get_config() const noexcept { return config_; }
+
+  // Statistics
+  struct Stats {
+    std::size_t flits{0};
+    std::size_t flits_corrupted{0};
+    std::size_t error_events{0};
+    std::size_t bits_flipped{0};
+  };
+
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept;
+
+private:
+  BitErrorChannelConfig config_;
+  ualink::Xoshiro256StarStar rng_;
+  std::uint64_t bits_until_error_{0};
+  Stats stats_{};
+
+  [[nodiscard]] std::size_t corrupt_flit(DlFlit &flit);
+  [[nodiscard]] std::size_t apply_burst(DlFlit &flit, std::size_t start_bit, std::size_t burst_length);
+  [[nodiscard]] std::size_t sample_burst_length();
+};
+
+} // namespace ualink::dl
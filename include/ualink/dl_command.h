@@ -81,7 +81,17 @@ private:
   Stats stats_{};
 };
 
+// Default number of flit times to wait for a gap to be filled before the
+// outstanding Replay Request is re-sent
+constexpr std::size_t kDefaultReplayRetryFlits = 64;
+
 // DL command manager - combines sequence tracking with command generation
+//
+// Replay storm suppression: after a loss, every in-flight flit behind the gap
+// arrives out of order. Only the first one generates a Replay Request; the rest
+// are counted as suppressed until the gap is filled or the retry timer expires.
+// Duplicates (the tail of a go-back-N replay) are re-ACKed once per ACK value so
+// a lost ACK cannot stall the sender.
 class DlAckNakManager {
 public:
   DlAckNakManager();
@@ -90,6 +100,17 @@ public:
   // Returns std::nullopt if no command needed, or the command flit to send
   [[nodiscard]] std::optional<DlFlit> process_received_flit(std::uint16_t received_seq, std::uint8_t our_tx_seq_lo);
 
+  // Advance the replay retry timer by one flit time without receiving a flit
+  // (e.g. idle link). Returns a re-sent Replay Request if the timer expired.
+  [[nodiscard]] std::optional<DlFlit> tick(std::uint8_t our_tx_seq_lo);
+
+  // Configure replay retry timer (in flit times, 0 = never retry)
+  void set_replay_retry_flits(std::size_t flits) noexcept;
+  [[nodiscard]] std::size_t get_replay_retry_flits() const noexcept;
+
+  // Check if a Replay Request is outstanding for the current gap
+  [[nodiscard]] bool is_replay_outstanding() const noexcept { return replay_outstanding_; }
+
   // Get expected receive sequence number
   [[nodiscard]] std::uint16_t expected_rx_seq() const noexcept;
 
@@ -106,10 +127,47 @@ public:
   void set_ack_every_n_flits(std::size_t n) noexcept; // 0 = ACK every flit
   [[nodiscard]] std::size_t get_ack_every_n_flits() const noexcept;
 
+  // Statistics
+  // Goodput under loss is flits_accepted / flits_received; for go-back-N with a
+  // window of W flits each loss should cost about W received flits and exactly
+  // one Replay Request (plus retries if the replay itself is lost).
+  struct Stats {
+    std::size_t flits_received{0};
+    std::size_t flits_accepted{0};
+    std::size_t duplicates_received{0};
+    std::size_t out_of_order_received{0};
+    std::size_t acks_sent{0};
+    std::size_t reacks_sent{0};
+    std::size_t replay_requests_sent{0};
+    std::size_t replay_requests_suppressed{0};
+    std::size_t replay_request_retries{0};
+  };
+
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept;
+
 private:
   DlSequenceTracker rx_seq_tracker_{};
+  bool flit_accepted_{false}; // Any flit received in sequence since reset
   std::size_t ack_every_n_{0}; // 0 = ACK immediately, N = ACK every N flits
   std::size_t flits_since_ack_{0};
+
+  // Replay Request suppression state (one outstanding request per gap)
+  bool replay_outstanding_{false};
+  std::uint16_t replay_outstanding_seq_{0};
+  std::size_t replay_retry_flits_{kDefaultReplayRetryFlits};
+  std::size_t flits_since_replay_request_{0};
+
+  // Last ACK value re-sent in response to a duplicate (0 = none)
+  std::uint16_t last_reack_seq_{0};
+
+  Stats stats_{};
+
+  [[nodiscard]] std::optional<DlFlit> handle_expected(std::uint16_t received_seq, std::uint8_t our_tx_seq_lo);
+  [[nodiscard]] std::optional<DlFlit> handle_duplicate(std::uint8_t our_tx_seq_lo);
+  [[nodiscard]] std::optional<DlFlit> handle_out_of_order(std::uint8_t our_tx_seq_lo);
+  [[nodiscard]] bool replay_retry_expired() noexcept;
+  [[nodiscard]] DlFlit send_replay_request(std::uint8_t our_tx_seq_lo);
 };
 
 } // namespace ualink::dl
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "ualink/dl_message_queue.h"
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// DlConcurrentMessageQueue: Multi-Producer / Single-Consumer DL Message Queue
+// =============================================================================
+//
+// Same arbitration as DlMessageQueue (round-robin across the Basic, Control
+// and UART groups; a UART Stream Transport blocks the other groups until its
+// last DWord is sent), but enqueue() may be called from any number of
+// control-plane threads while the serializer thread drains it.
+//
+// Thread roles:
+//   Producers (any thread): enqueue(), try_enqueue(), get_stats()
+//   Consumer (one thread):  pop_next_dword(), has_pending_messages(), reset_stats()
+//
+// Each group is a bounded lock-free ring of whole serialized messages. A
+// producer serializes on its own thread, claims a slot with one CAS and
+// publishes it with a release store; the consumer streams DWords straight out
+// of the head slot and only frees it after the message's last DWord. A full
+// ring is reported to the producer - nothing blocks and nothing allocates.
+//
+// Order is FIFO per group across all producers (the order slots were claimed).
+//
+// Usage:
+//   DlConcurrentMessageQueue queue;
+//   // control-plane thread
+//   queue.enqueue(TlRateNotification{...});
+//   // serializer thread
+//   const DlFlit flit = DlSerializer::serialize(tl_flits, header, &queue);
+
+// Message slots per group ring (power of two)
+constexpr std::size_t kConcurrentDlMessageSlots = 64;
+
+// Bounded lock-free multi-producer / single-consumer ring (D. Vyukov's
+// sequence-numbered cells). Slot i is free for the producer holding position
+// p when sequence == p, and holds a published value when sequence == p + 1.
+template <typename T, std::size_t Capacity>
+class MpscSlotRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpscSlotRing: capacity must be a power of two");
+
+public:
+  MpscSlotRing() noexcept;
+
+  // Any thread. Returns false if the ring is full.
+  [[nodiscard]] bool try_push(const T &value) noexcept;
+
+  // Consumer only. front() requires ready().
+  [[nodiscard]] bool ready() const noexcept;
+  [[nodiscard]] const T &front() const noexcept { return cells_[dequeue_pos_ & kMask].value; }
+  void pop() noexcept;
+
+private:
+  static constexpr std::size_t kMask = Capacity - 1;
+  static constexpr std::size_t kCacheLineBytes = 64;
+
+  struct Cell {
+    std::atomic<std::size_t> sequence{0};
+    T value{};
+  };
+
+  std::array<Cell, Capacity> cells_;
+  alignas(kCacheLineBytes) std::atomic<std::size_t> enqueue_pos_{0};
+  alignas(kCacheLineBytes) std::size_t dequeue_pos_{0};
+};
+
+class DlConcurrentMessageQueue {
+public:
+  // Any thread. Throws std::invalid_argument for a malformed message and
+  // std::length_error if the message's group ring is full.
+  void enqueue(const DlMessage &msg);
+
+  // Any thread. Returns false (and enqueues nothing) if the group ring is full.
+  [[nodiscard]] bool try_enqueue(const DlMessage &msg);
+
+  // Consumer only. Pop next DWord using round-robin arbitration.
+  // Returns nullopt if no published message is available.
+  std::optional<std::array<std::byte, 4>> pop_next_dword();
+
+  // Consumer only. True if a message is mid-stream or published in any group.
+  [[nodiscard]] bool has_pending_messages() const;
+
+  // Statistics (same counters as DlMessageQueue; counts are relaxed snapshots)
+  using Stats = DlMessageQueue::Stats;
+  [[nodiscard]] Stats get_stats() const;
+  void reset_stats();
+
+private:
+  using SlotRing = MpscSlotRing<SerializedDlMessage, kConcurrentDlMessageSlots>;
+
+  SlotRing basic_ring_;
+  SlotRing control_ring_;
+  SlotRing uart_ring_;
+
+  // Consumer state: group whose head message is being streamed, and the next
+  // DWord of it to send (kNone = between messages)
+  MessageGroup in_progress_group_{MessageGroup::kNone};
+  std::size_t dword_cursor_{0};
+  MessageGroup last_served_group_{MessageGroup::kNone};
+
+  struct AtomicStats {
+    std::atomic<std::size_t> basic_enqueued{0};
+    std::atomic<std::size_t> control_enqueued{0};
+    std::atomic<std::size_t> uart_enqueued{0};
+    std::atomic<std::size_t> basic_sent{0};
+    std::atomic<std::size_t> control_sent{0};
+    std::atomic<std::size_t> uart_sent{0};
+    std::atomic<std::size_t> uart_multi_flit_count{0};
+  };
+  AtomicStats stats_;
+
+  // Helper: ring backing a group
+  [[nodiscard]] SlotRing &ring_for_group(MessageGroup group);
+  [[nodiscard]] const SlotRing &ring_for_group(MessageGroup group) const;
+
+  // Helper: start streaming the next message chosen by round-robin
+  [[nodiscard]] bool start_next_message();
+};
+
+template <typename T, std::size_t Capacity>
+MpscSlotRing<T, Capacity>::MpscSlotRing() noexcept {
+  for (std::size_t slot = 0; slot < Capacity; ++slot) {
+    cells_[slot].sequence.store(slot, std::memory_order_relaxed);
+  }
+}
+
+template <typename T, std::size_t Capacity>
+bool MpscSlotRing<T, Capacity>::try_push(const T &value) noexcept {
+  std::size_t position = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell &cell = cells_[position & kMask];
+    const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    const auto lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+    if (lag == 0) {
+      // Slot free at our position: claim it
+      if (enqueue_pos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        cell.value = value;
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (lag < 0) {
+      // Slot still holds a value from the previous lap: full
+      return false;
+    } else {
+      // Another producer claimed this position first
+      position = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T, std::size_t Capacity>
+bool MpscSlotRing<T, Capacity>::ready() const noexcept {
+  const std::size_t sequence = cells_[dequeue_pos_ & kMask].sequence.load(std::memory_order_acquire);
+  return sequence == dequeue_pos_ + 1;
+}
+
+template <typename T, std::size_t Capacity>
+void MpscSlotRing<T, Capacity>::pop() noexcept {
+  // Hand the slot to the producer that will reach it on the next lap
+  cells_[dequeue_pos_ & kMask].sequence.store(dequeue_pos_ + Capacity, std::memory_order_release);
+  dequeue_pos_++;
+}
+
+} // namespace ualink::dl
@@ -6,6 +6,7 @@
 #include <random>
 
 #include "ualink/dl_flit.h"
+#include "ualink/prng.h"
 #include "ualink/trace.h"
 
 namespace ualink::dl {
@@ -53,8 +54,18 @@ private:
   std::uint16_t last_seq_{0};
 };
 
+// Apply error_type to a copy of flit (kNone / kPacketDrop / sequence errors
+// leave the flit bytes unchanged)
+[[nodiscard]] DlFlit inject_flit_error(const DlFlit& flit, ErrorType error_type);
+
 // Built-in error injection policies
 
+// No-op error policy - never injects; lets templated pipelines compile the
+// error stage out entirely
+struct NoErrorPolicy {
+  [[nodiscard]] constexpr ErrorType operator()() const noexcept { return ErrorType::kNone; }
+};
+
 // Random error policy - injects errors with specified probability
 class RandomErrorPolicy {
 public:
@@ -76,6 +87,47 @@ private:
   double sequence_error_prob_{0.0};
 };
 
+// Geometric error policy - same error model as RandomErrorPolicy, but samples
+// the number of clean flits until the next error once (skip sampling), so the
+// per-flit cost is a counter decrement. Explicitly seeded: equal seeds give
+// identical error sequences.
+class GeometricErrorPolicy {
+public:
+  GeometricErrorPolicy(double error_probability, std::uint64_t seed);
+
+  [[nodiscard]] ErrorType operator()() noexcept {
+    if (flits_until_error_ > 0) {
+      --flits_until_error_;
+      return ErrorType::kNone;
+    }
+    return next_error_event();
+  }
+
+  // Set probabilities for specific error types (resamples the current gap)
+  void set_crc_corruption_probability(double prob) noexcept;
+  void set_packet_drop_probability(double prob) noexcept;
+  void set_sequence_error_probability(double prob) noexcept;
+
+  // Restart the error sequence from a new seed
+  void reseed(std::uint64_t seed) noexcept;
+
+  // Clean flits remaining before the next error
+  [[nodiscard]] std::uint64_t flits_until_error() const noexcept { return flits_until_error_; }
+
+private:
+  ualink::Xoshiro256StarStar rng_;
+
+  double crc_corruption_prob_{0.0};
+  double packet_drop_prob_{0.0};
+  double sequence_error_prob_{0.0};
+
+  std::uint64_t flits_until_error_{0};
+
+  [[nodiscard]] double total_probability() const noexcept;
+  [[nodiscard]] ErrorType next_error_event() noexcept;
+  void resample_gap() noexcept;
+};
+
 // Periodic error policy - injects error every N flits
 class PeriodicErrorPolicy {
 public:
@@ -93,10 +93,30 @@ struct DlFlit {
 [[nodiscard]] std::byte serialize_segment_header(const SegmentHeaderFields &fields);
 [[nodiscard]] SegmentHeaderFields deserialize_segment_header(std::byte value);
 
+// DL message alternative sector: the DWords at the start of a segment whose
+// dl_alt_sector bit is set. Both link partners must be configured with the
+// same size. Any sector of up to 14 DWords leaves room for exactly one TL flit
+// in every segment - the same TL cost as a single DWord - so larger sectors
+// raise DL message bandwidth for free up to that point. A segment smaller than
+// the configured sector uses all of its payload. Sector DWords left over when
+// the queue runs dry are sent as No-Op messages (the all-zero DWord).
+constexpr std::size_t kMaxAltSectorDwords = 32;
+
+struct DlAltSectorConfig {
+  std::size_t dwords{1};
+};
+
+// Throws std::invalid_argument for a size of 0 or more than kMaxAltSectorDwords
+void validate_alt_sector(const DlAltSectorConfig &config);
+
+// Sector bytes in one segment; throws like validate_alt_sector()
+[[nodiscard]] std::size_t alt_sector_bytes(const DlAltSectorConfig &config, std::size_t segment_index);
+
 // Forward declarations to avoid circular dependency
 class DlPacingController;
 class DlErrorInjector;
 class DlMessageQueue;
+class DlConcurrentMessageQueue;
 
 // Result structure for deserializer with DL messages
 struct DlDeserializedResult {
@@ -113,6 +133,19 @@ public:
   [[nodiscard]] static DlFlit serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
                                         DlMessageQueue *message_queue, std::size_t *flits_serialized = nullptr);
 
+  // Serialize with a DL message queue, filling an alternative sector of the
+  // configured size in every segment while messages are pending
+  [[nodiscard]] static DlFlit serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                        DlMessageQueue *message_queue, const DlAltSectorConfig &alt_sector,
+                                        std::size_t *flits_serialized = nullptr);
+
+  // Serialize with a multi-producer DL message queue (call from its consumer thread)
+  [[nodiscard]] static DlFlit serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                        DlConcurrentMessageQueue *message_queue, std::size_t *flits_serialized = nullptr);
+  [[nodiscard]] static DlFlit serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                        DlConcurrentMessageQueue *message_queue, const DlAltSectorConfig &alt_sector,
+                                        std::size_t *flits_serialized = nullptr);
+
   // Serialize with pacing controller
   [[nodiscard]] static DlFlit serialize_with_pacing(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
                                                     DlPacingController &pacing, std::size_t *flits_serialized = nullptr);
@@ -133,6 +166,11 @@ public:
   [[nodiscard]] static DlDeserializedResult deserialize_ex(const DlFlit &flit);
   [[nodiscard]] static std::optional<DlDeserializedResult> deserialize_ex_with_crc_check(const DlFlit &flit);
 
+  // Deserialize with DL message extraction for a non-default alternative sector size
+  [[nodiscard]] static DlDeserializedResult deserialize_ex(const DlFlit &flit, const DlAltSectorConfig &alt_sector);
+  [[nodiscard]] static std::optional<DlDeserializedResult>
+  deserialize_ex_with_crc_check(const DlFlit &flit, const DlAltSectorConfig &alt_sector);
+
   // Deserialize with pacing controller for Rx rate adaptation
   [[nodiscard]] static std::vector<TlFlit> deserialize_with_pacing(const DlFlit &flit, DlPacingController &pacing);
   [[nodiscard]] static std::optional<std::vector<TlFlit>> deserialize_with_crc_and_pacing(const DlFlit &flit,
@@ -6,9 +6,11 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "ualink/dl_messages.h"
+#include "ualink/dl_uart_reassembly.h"
 #include "ualink/trace.h"
 
 namespace ualink::dl {
@@ -21,18 +23,22 @@ namespace ualink::dl {
 // - Deserialize raw DWords into typed messages
 // - Track request/response timeouts (1µs requirement for Basic messages)
 // - Manage channel negotiation state machine (Control messages)
-// - Reassemble multi-DWord UART Stream Transport messages
+// - Reassemble multi-DWord UART Stream Transport messages (per stream ID, in
+//   the fixed buffers of a UartStreamReassemblyPool)
 // - Dispatch to type-specific callbacks
 //
+// Dispatch is a constexpr table indexed by the DWord's (mclass, mtype) fields.
+// Reserved classes/types and malformed DWords are reported as a
+// DlMessageStatus and counted in Stats::deserialization_errors; nothing on the
+// receive path throws, so a flood of bad DWords costs a table lookup each.
+//
 // Usage:
 //   DlMessageProcessor processor;
-//   processor.set_basic_callback([](const auto& msg) { /* handle */ });
+//   processor.set_tl_rate_callback([](const TlRateNotification& msg) { /* handle */ });
 //
 //   // After receiving DL flit:
 //   auto result = DlDeserializer::deserialize_ex(flit);
-//   for (const auto& dword : result.dl_message_dwords) {
-//     processor.process_dword(dword, current_time_us);
-//   }
+//   processor.process_dwords(result.dl_message_dwords, current_time_us);
 
 // =============================================================================
 // Timeout Tracking for Basic Messages (Request/Response)
@@ -67,13 +73,18 @@ struct ChannelNegotiationState {
 };
 
 // =============================================================================
-// UART Stream Reassembly (Multi-DWord Messages)
+// Receive Status
 // =============================================================================
 
-struct UartStreamReassembly {
-  std::uint8_t stream_id{0};
-  std::vector<std::uint32_t> accumulated_dwords;
-  bool in_progress{false};
+enum class DlMessageStatus : std::uint8_t {
+  kOk,
+  kUnknownMessage, // Reserved / unsupported (mclass, mtype)
+  kMalformed,      // Known type, but the DWord failed to deserialize (e.g. compressed=1)
+};
+
+struct DlMessageBatchResult {
+  std::size_t accepted{0};
+  std::size_t rejected{0};
 };
 
 // =============================================================================
@@ -93,6 +104,7 @@ public:
   using UartResetReqCallback = std::function<void(const UartStreamResetRequest&)>;
   using UartResetRspCallback = std::function<void(const UartStreamResetResponse&)>;
   using UartTransportCallback = std::function<void(const UartStreamTransportMessage&)>;
+  using UartTransportViewCallback = std::function<void(const UartStreamTransportView&)>;
   using UartCreditCallback = std::function<void(const UartStreamCreditUpdate&)>;
 
   // Set callbacks
@@ -104,12 +116,21 @@ public:
   void set_uart_reset_req_callback(UartResetReqCallback callback) { uart_reset_req_callback_ = std::move(callback); }
   void set_uart_reset_rsp_callback(UartResetRspCallback callback) { uart_reset_rsp_callback_ = std::move(callback); }
   void set_uart_transport_callback(UartTransportCallback callback) { uart_transport_callback_ = std::move(callback); }
+  void set_uart_transport_view_callback(UartTransportViewCallback callback) {
+    uart_transport_view_callback_ = std::move(callback);
+  }
   void set_uart_credit_callback(UartCreditCallback callback) { uart_credit_callback_ = std::move(callback); }
 
   // Process a received DWord
   // Returns true if successfully processed, false if deserialization failed
   bool process_dword(const std::array<std::byte, 4>& dword, std::uint64_t current_time_us);
 
+  // Process a received DWord, reporting why it was rejected
+  [[nodiscard]] DlMessageStatus process_dword_ex(const std::array<std::byte, 4>& dword, std::uint64_t current_time_us);
+
+  // Process every DL message DWord of a flit (DlDeserializedResult::dl_message_dwords), in order
+  DlMessageBatchResult process_dwords(std::span<const std::array<std::byte, 4>> dwords, std::uint64_t current_time_us);
+
   // Timeout tracking for Basic messages
   void start_basic_timeout(std::uint16_t sequence_id, std::uint64_t current_time_us);
   TimeoutResult check_basic_timeout(std::uint64_t current_time_us, std::uint64_t timeout_us = 1);
@@ -119,8 +140,14 @@ public:
   [[nodiscard]] ChannelState get_channel_state() const { return channel_state_.state; }
   void transition_channel_state(ChannelState new_state, std::uint64_t current_time_us);
 
-  // UART stream reassembly
-  [[nodiscard]] bool is_uart_reassembly_in_progress() const { return uart_reassembly_.in_progress; }
+  // UART stream reassembly. A completed message goes to the view callback by
+  // reference (valid only during the call); the UartStreamTransportMessage
+  // callback, if set, receives a copy.
+  [[nodiscard]] bool is_uart_reassembly_in_progress() const { return uart_streams_.any_in_progress(); }
+  [[nodiscard]] bool is_uart_reassembly_in_progress(std::uint8_t stream_id) const {
+    return uart_streams_.in_progress(stream_id);
+  }
+  [[nodiscard]] const UartStreamReassemblyPool& get_uart_reassembly_pool() const { return uart_streams_; }
   void reset_uart_reassembly();
 
   // Statistics
@@ -144,18 +171,42 @@ private:
   UartResetReqCallback uart_reset_req_callback_;
   UartResetRspCallback uart_reset_rsp_callback_;
   UartTransportCallback uart_transport_callback_;
+  UartTransportViewCallback uart_transport_view_callback_;
   UartCreditCallback uart_credit_callback_;
 
   // State tracking
   BasicMessageTimeout basic_timeout_;
   ChannelNegotiationState channel_state_;
-  UartStreamReassembly uart_reassembly_;
+  UartStreamReassemblyPool uart_streams_;
+  std::uint8_t uart_receiving_stream_{0}; // Stream whose payload DWords are arriving
   Stats stats_;
 
-  // Helper: dispatch to appropriate callback based on message type
-  void dispatch_basic_message(const std::array<std::byte, 4>& dword);
-  void dispatch_control_message(const std::array<std::byte, 4>& dword);
-  void dispatch_uart_message(const std::array<std::byte, 4>& dword);
+  // Dispatch table: one entry per (mclass, mtype); null handler = reserved
+  using Handler = DlMessageStatus (DlMessageProcessor::*)(const std::array<std::byte, 4>&);
+  struct DispatchEntry {
+    Handler handler{nullptr};
+    std::size_t Stats::*received{nullptr};
+  };
+  static constexpr std::size_t kDispatchTableSize = 16 * 8; // 4-bit mclass x 3-bit mtype
+
+  [[nodiscard]] static constexpr std::array<DispatchEntry, kDispatchTableSize> build_dispatch_table();
+
+  // Per-type handlers
+  [[nodiscard]] DlMessageStatus handle_no_op(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_tl_rate(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_device_id(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_port_id(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_channel_negotiation(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_uart_reset_request(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_uart_reset_response(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_uart_transport_header(const std::array<std::byte, 4>& dword);
+  [[nodiscard]] DlMessageStatus handle_uart_credit(const std::array<std::byte, 4>& dword);
+
+  // Helper: payload DWord of an in-progress UART Stream Transport
+  void accept_uart_payload_dword(const std::array<std::byte, 4>& dword);
+
+  // Helper: apply a received Channel Negotiation command to the state machine
+  void apply_channel_command(std::uint8_t command);
 };
 
 } // namespace ualink::dl
@@ -4,7 +4,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
-#include <queue>
 #include <variant>
 #include <vector>
 
@@ -29,10 +28,74 @@ enum class MessageGroup {
   kNone // No messages available
 };
 
+// Largest DL message: UART Stream Transport header + 32 payload DWords
+constexpr std::size_t kMaxUartTransportDwords = 33;
+
+// A message serialized to wire DWords (at most one UART Stream Transport)
+struct SerializedDlMessage {
+  std::array<std::array<std::byte, 4>, kMaxUartTransportDwords> dwords{};
+  std::size_t dword_count{0};
+};
+
+// Determine which group a message belongs to
+[[nodiscard]] MessageGroup get_message_group(const DlMessage &msg);
+
+// Serialize any DL message to its wire DWords; throws std::invalid_argument
+// for malformed messages (same checks as the per-type serializers)
+[[nodiscard]] SerializedDlMessage serialize_dl_message(const DlMessage &msg);
+
+// Round-robin arbitration: first group after last_served, in the order
+// kBasic -> kControl -> kUart, for which has_messages(group) is true
+template <typename HasMessagesFn>
+[[nodiscard]] MessageGroup select_round_robin_group(MessageGroup last_served, HasMessagesFn &&has_messages);
+
+// Per-group DWord ring capacity (holds several maximum-size messages, and more
+// than one DL flit drains even with the largest alternative sector)
+constexpr std::size_t kDlMessageRingDwords = 256;
+static_assert(kDlMessageRingDwords >= kMaxUartTransportDwords);
+
+// Fixed-capacity FIFO of serialized message DWords
+// Each entry records how many DWords of the same message follow it, so a
+// multi-DWord message can be sent back to back.
+class DlDwordRing {
+public:
+  struct Entry {
+    std::array<std::byte, 4> dword{};
+    std::uint8_t dwords_following{0};
+  };
+
+  [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+  [[nodiscard]] std::size_t size() const noexcept { return count_; }
+  [[nodiscard]] std::size_t free_space() const noexcept { return kDlMessageRingDwords - count_; }
+
+  // Caller checks free_space() first
+  void push(const Entry &entry) noexcept {
+    entries_[(head_ + count_) % kDlMessageRingDwords] = entry;
+    count_++;
+  }
+
+  // Caller checks !empty() first
+  [[nodiscard]] Entry pop() noexcept {
+    const Entry entry = entries_[head_];
+    head_ = (head_ + 1) % kDlMessageRingDwords;
+    count_--;
+    return entry;
+  }
+
+private:
+  std::array<Entry, kDlMessageRingDwords> entries_{};
+  std::size_t head_{0};
+  std::size_t count_{0};
+};
+
+// Messages are serialized into their group's DWord ring at enqueue time;
+// pop_next_dword() is a ring pop plus round-robin group selection and never
+// allocates.
 class DlMessageQueue {
 public:
   // Enqueue a message (determines group automatically)
-  void enqueue(DlMessage msg);
+  // Throws std::length_error if the group's ring cannot hold the whole message
+  void enqueue(const DlMessage &msg);
 
   // Pop next DWord using round-robin arbitration
   // Returns nullopt if no messages available
@@ -55,33 +118,53 @@ public:
   void reset_stats();
 
 private:
-  std::queue<DlMessage> basic_queue_;
-  std::queue<DlMessage> control_queue_;
-  std::queue<DlMessage> uart_queue_;
+  DlDwordRing basic_ring_;
+  DlDwordRing control_ring_;
+  DlDwordRing uart_ring_;
 
   // Round-robin state: which group was last serviced
   MessageGroup last_served_group_{MessageGroup::kNone};
 
-  // UART Stream Transport multi-DWord state
-  struct UartTransportState {
-    std::vector<std::uint32_t> remaining_dwords; // Payload DWords not yet sent
-    bool in_progress{false};
-  };
-  UartTransportState uart_transport_state_;
+  // DWords of the current UART Stream Transport message still to send; other
+  // groups are blocked until this reaches zero
+  std::size_t uart_dwords_in_progress_{0};
 
   Stats stats_;
 
-  // Helper: determine which group a message belongs to
-  [[nodiscard]] static MessageGroup get_message_group(const DlMessage &msg);
+  // Helper: ring backing a group
+  [[nodiscard]] DlDwordRing &ring_for_group(MessageGroup group);
+  [[nodiscard]] const DlDwordRing &ring_for_group(MessageGroup group) const;
 
   // Helper: get next group to service (round-robin)
-  [[nodiscard]] MessageGroup select_next_group();
-
-  // Helper: pop message from specific group queue
-  [[nodiscard]] std::optional<DlMessage> pop_from_group(MessageGroup group);
+  [[nodiscard]] MessageGroup select_next_group() const;
 
-  // Helper: serialize a message to DWord(s)
-  [[nodiscard]] static std::vector<std::array<std::byte, 4>> serialize_message(const DlMessage &msg);
+  // Helper: copy a serialized message into a ring
+  static void push_into_ring(const SerializedDlMessage &serialized, DlDwordRing &ring);
 };
 
-} // namespace ualink::dl
\ No newline at end of file
+template <typename HasMessagesFn>
+MessageGroup select_round_robin_group(MessageGroup last_served, HasMessagesFn &&has_messages) {
+  constexpr std::array<MessageGroup, 3> kGroupOrder = {MessageGroup::kBasic, MessageGroup::kControl,
+                                                       MessageGroup::kUart};
+
+  // Find starting point (after last served)
+  std::size_t start_index = 0;
+  for (std::size_t group_index = 0; group_index < kGroupOrder.size(); ++group_index) {
+    if (kGroupOrder[group_index] == last_served) {
+      start_index = (group_index + 1) % kGroupOrder.size();
+      break;
+    }
+  }
+
+  // Check each group in round-robin order
+  for (std::size_t offset = 0; offset < kGroupOrder.size(); ++offset) {
+    const MessageGroup group = kGroupOrder[(start_index + offset) % kGroupOrder.size()];
+    if (has_messages(group)) {
+      return group;
+    }
+  }
+
+  return MessageGroup::kNone;
+}
+
+} // namespace ualink::dl
@@ -200,6 +200,13 @@ struct UartStreamTransportMessage {
   std::vector<std::uint32_t> payload_dwords{}; // 1..32
 };
 
+// Header DWord of a UART Stream Transport message
+struct UartStreamTransportHeader {
+  std::uint8_t payload_dwords{1}; // 1..32 (length field + 1)
+  std::uint8_t stream_id{0};
+  DlMsgCommon common{};
+};
+
 struct UartStreamCreditUpdate {
   std::uint16_t data_fc_seq{0}; // 12 bits
   std::uint8_t stream_id{0};
@@ -251,7 +258,13 @@ struct VendorDefinedPacketTypeLength {
 [[nodiscard]] std::optional<UartStreamResetResponse> deserialize_uart_stream_reset_response(std::span<const std::byte, 4> bytes);
 
 [[nodiscard]] std::vector<std::byte> serialize_uart_stream_transport_message(const UartStreamTransportMessage &msg);
+// Allocation-free pieces of the above: header DWord (validates msg), then one big-endian DWord per payload word
+[[nodiscard]] std::array<std::byte, 4> serialize_uart_stream_transport_header(const UartStreamTransportMessage &msg);
+[[nodiscard]] std::array<std::byte, 4> serialize_uart_stream_payload_dword(std::uint32_t value);
 [[nodiscard]] std::optional<UartStreamTransportMessage> deserialize_uart_stream_transport_message(std::span<const std::byte> bytes);
+// Receive-side pieces for DWord-at-a-time reassembly: header DWord (nullopt if compressed), then payload DWords
+[[nodiscard]] std::optional<UartStreamTransportHeader> deserialize_uart_stream_transport_header(std::span<const std::byte, 4> bytes);
+[[nodiscard]] std::uint32_t deserialize_uart_stream_payload_dword(std::span<const std::byte, 4> bytes);
 
 [[nodiscard]] std::array<std::byte, 4> serialize_uart_stream_credit_update(const UartStreamCreditUpdate &msg);
 [[nodiscard]] std::optional<UartStreamCreditUpdate> deserialize_uart_stream_credit_update(std::span<const std::byte, 4> bytes);
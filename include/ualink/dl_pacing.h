@@ -60,6 +60,14 @@ private:
 
 // Built-in pacing policies for common scenarios
 
+// No-op Tx pacing policy - always allows; lets templated pipelines compile the
+// pacing stage out entirely
+struct NoTxPacingPolicy {
+  [[nodiscard]] constexpr PacingDecision operator()(std::size_t, std::size_t) const noexcept {
+    return PacingDecision::kAllow;
+  }
+};
+
 // Simple rate limiter - allows N flits per window
 class SimpleTxRateLimiter {
 public:
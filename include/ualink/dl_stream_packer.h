@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "ualink/dl_flit.h"
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// DlStreamPacker / DlStreamDepacker: Cross-Flit Streaming TL Packing
+// =============================================================================
+//
+// DlSerializer places whole TL flits at fixed 64-byte slots. In segments 3
+// and 4 (124/120 bytes), and in any segment carrying a DL message sector,
+// only one slot fits and the rest of the segment is wasted. With no messages
+// it also stops at kDlPayloadBytes / kTlFlitBytes flits, leaving the 628-byte
+// payload's tail empty.
+//
+// The streaming mode treats the TL flits as one byte stream. Each segment's
+// TL region (everything after its alternative sector) is filled back to back.
+// A TL flit that does not fit is carried into the next segment or the next
+// DL flit. Payload is only padded when the packer runs out of TL flits.
+//
+// Segment header encoding (both link partners must use the streaming mode):
+//   - The region first finishes the TL flit carried in from before, if any.
+//     That needs no header bits.
+//   - tl_flit0 / tl_flit1 mark the first and second TL flits that *start* in
+//     the segment. Starts follow each other directly, and a 128-byte region
+//     holds at most two. message0 / message1 carry those flits' message
+//     fields.
+//
+// Replay resends identical DL flits, so the carry state stays consistent as
+// long as the depacker only sees flits in sequence order. unpack_with_crc_check()
+// leaves the carry untouched on a CRC failure.
+//
+// Usage:
+//   DlStreamPacker packer;
+//   std::size_t consumed = 0;
+//   const DlFlit flit = packer.pack(pending_tl_flits, header, &message_queue, &consumed);
+//   // drop `consumed` flits from pending_tl_flits
+//
+//   DlStreamDepacker depacker;
+//   const auto result = depacker.unpack_with_crc_check(flit); // complete TL flits only
+
+class DlMessageQueue;
+
+class DlStreamPacker {
+public:
+  explicit DlStreamPacker(const DlAltSectorConfig &alt_sector = {});
+
+  // Build the next DL flit: finish any carried TL flit, then start TL flits
+  // from tl_flits in order. *flits_consumed is the number of tl_flits started
+  // (a straddling one is kept internally until fully sent). DL messages, if
+  // message_queue is non-null, fill each segment's alternative sector first.
+  [[nodiscard]] DlFlit pack(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                            DlMessageQueue *message_queue = nullptr, std::size_t *flits_consumed = nullptr);
+
+  // True while part of a TL flit is still waiting for the next DL flit
+  [[nodiscard]] bool has_partial_flit() const noexcept { return carry_bytes_sent_ != 0; }
+
+  // Drop the carried partial TL flit (e.g. after link retrain)
+  void reset() noexcept { carry_bytes_sent_ = 0; }
+
+  // Statistics
+  struct Stats {
+    std::size_t dl_flits{0};
+    std::size_t tl_flits_started{0};
+    std::size_t tl_bytes{0};      // TL stream bytes placed in payload
+    std::size_t message_bytes{0}; // Alternative sector bytes
+    std::size_t padding_bytes{0}; // Payload left empty (no TL flits pending)
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  DlAltSectorConfig alt_sector_;
+  TlFlit carry_{};
+  std::size_t carry_bytes_sent_{0}; // 0 = nothing carried
+  Stats stats_;
+};
+
+class DlStreamDepacker {
+public:
+  explicit DlStreamDepacker(const DlAltSectorConfig &alt_sector = {});
+
+  // Extract DL message DWords and every TL flit completed by this DL flit.
+  // Throws std::invalid_argument if a segment header starts a TL flit while
+  // the carried one is still incomplete; the carry is left unchanged.
+  [[nodiscard]] DlDeserializedResult unpack(const DlFlit &flit);
+
+  // As unpack(), after a CRC check; nullopt (carry unchanged) on failure
+  [[nodiscard]] std::optional<DlDeserializedResult> unpack_with_crc_check(const DlFlit &flit);
+
+  [[nodiscard]] bool has_partial_flit() const noexcept { return carry_bytes_received_ != 0; }
+  void reset() noexcept { carry_bytes_received_ = 0; }
+
+  // Statistics
+  struct Stats {
+    std::size_t dl_flits{0};
+    std::size_t tl_flits{0};
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  DlAltSectorConfig alt_sector_;
+  TlFlit carry_{};
+  std::size_t carry_bytes_received_{0}; // 0 = nothing carried
+  Stats stats_;
+};
+
+} // namespace ualink::dl
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// DlTimerWheel: Hierarchical Timer Wheel for DL Message Timeouts
+// =============================================================================
+//
+// DlMessageProcessor tracks one Basic request timeout and one channel
+// negotiation timestamp per link. This wheel holds thousands of outstanding
+// timers (Basic message requests waiting for a response, per-channel
+// negotiation timers) for any number of links, keyed by
+// (kind, link_id, tag).
+//
+// Layout: 4 levels of 64 slots. Level 0 resolves single ticks, and each level
+// above covers 64x the range of the one below. Together they cover 2^24 ticks
+// (about 16.7 s at the default 1 us tick). A timer further out is parked in
+// the top level and re-placed when its slot cascades.
+//
+// Cost:
+// - schedule() and cancel() are O(1): timers are nodes of a preallocated pool
+//   linked into their slot with intrusive index links.
+// - advance() does O(1) work per tick, plus the timers it expires or cascades.
+// - Every timer expiring on the same tick is delivered in one batch callback.
+//
+// A handle carries the node's generation, so cancelling a timer that already
+// fired (or was cancelled) is a harmless no-op.
+//
+// Usage:
+//   DlTimerWheel wheel({.capacity = 4096});
+//   const DlTimerHandle handle = wheel.schedule(DlTimerKind::kBasicRequest, link, seq, now_us + 1);
+//   wheel.cancel(handle); // response arrived
+//   wheel.advance(now_us, [](std::span<const DlTimerExpiry> expired) { /* one tick's timeouts */ });
+
+enum class DlTimerKind : std::uint8_t {
+  kBasicRequest,       // Basic message request waiting for its response (1 us)
+  kChannelNegotiation, // Channel Online/Offline Negotiation request
+};
+
+struct DlTimerExpiry {
+  DlTimerKind kind{DlTimerKind::kBasicRequest};
+  std::uint32_t link_id{0};
+  std::uint16_t tag{0}; // Sequence ID (Basic) or channel (negotiation)
+  std::uint64_t deadline_us{0};
+};
+
+struct DlTimerHandle {
+  std::uint32_t index{0};
+  std::uint32_t generation{0}; // 0 = never scheduled
+};
+
+class DlTimerWheel {
+public:
+  struct Config {
+    std::size_t capacity{4096};  // Maximum outstanding timers
+    std::uint64_t tick_us{1};    // Wheel resolution
+    std::uint64_t start_us{0};   // Time of tick 0
+  };
+
+  using ExpiryBatchCallback = std::function<void(std::span<const DlTimerExpiry>)>;
+
+  // Throws std::invalid_argument for a zero capacity or tick
+  explicit DlTimerWheel(const Config &config);
+
+  // Arm a timer firing at the first tick at or after deadline_us (a deadline
+  // already passed fires on the next advance()). Throws std::length_error if
+  // capacity timers are outstanding.
+  [[nodiscard]] DlTimerHandle schedule(DlTimerKind kind, std::uint32_t link_id, std::uint16_t tag,
+                                       std::uint64_t deadline_us);
+
+  // Disarm a timer. Returns false if it already fired or was cancelled.
+  bool cancel(DlTimerHandle handle);
+
+  // Process every tick up to now_us. on_expired is called once per tick that
+  // has expirations, with all of them; it may schedule or cancel timers.
+  // Returns the number of timers expired.
+  std::size_t advance(std::uint64_t now_us, const ExpiryBatchCallback &on_expired);
+
+  [[nodiscard]] std::size_t size() const noexcept { return active_timers_; }
+  [[nodiscard]] bool empty() const noexcept { return active_timers_ == 0; }
+  [[nodiscard]] std::size_t capacity() const noexcept { return nodes_.size(); }
+
+  // Statistics
+  struct Stats {
+    std::size_t scheduled{0};
+    std::size_t cancelled{0};
+    std::size_t expired{0};
+    std::size_t cascaded{0};        // Timers moved down a level
+    std::size_t expiry_batches{0};  // Callback invocations
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  static constexpr std::size_t kLevels = 4;
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlotsPerLevel = std::size_t{1} << kSlotBits;
+  static constexpr std::uint64_t kSlotMask = kSlotsPerLevel - 1;
+  static constexpr std::uint64_t kMaxDeltaTicks = (std::uint64_t{1} << (kLevels * kSlotBits)) - 1;
+  static constexpr std::uint32_t kNil = UINT32_MAX;
+
+  struct Node {
+    DlTimerExpiry expiry{};
+    std::uint64_t expire_tick{0};
+    std::uint32_t prev{kNil};
+    std::uint32_t next{kNil};
+    std::uint32_t slot{kNil}; // kNil = free
+    std::uint32_t generation{1};
+  };
+
+  Config config_;
+  std::vector<Node> nodes_;
+  std::array<std::uint32_t, kLevels * kSlotsPerLevel> slot_heads_{};
+  std::uint32_t free_head_{kNil};
+  std::size_t active_timers_{0};
+  std::uint64_t next_tick_{0}; // Next tick advance() will process
+  std::vector<DlTimerExpiry> batch_;
+  Stats stats_;
+
+  // Helper: tick containing a time (rounding up for deadlines)
+  [[nodiscard]] std::uint64_t deadline_tick(std::uint64_t deadline_us) const;
+
+  // Helper: link a node into the slot for its expire tick
+  void place(std::uint32_t index);
+  void unlink(std::uint32_t index);
+  void release(std::uint32_t index);
+
+  // Helper: re-place every timer of a higher-level slot
+  void cascade(std::size_t level, std::uint64_t tick);
+
+  // Helper: process one tick, appending expirations to batch_
+  void run_tick();
+};
+
+} // namespace ualink::dl
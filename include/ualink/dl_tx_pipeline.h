@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "ualink/dl_concurrent_message_queue.h"
+#include "ualink/dl_error_injection.h"
+#include "ualink/dl_flit.h"
+#include "ualink/dl_message_queue.h"
+#include "ualink/dl_pacing.h"
+#include "ualink/dl_replay.h"
+#include "ualink/dl_tx_controller.h"
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// DlTxPipeline: Staged TL → DL Transmit Path
+// =============================================================================
+//
+// Each DL flit passes through the same fixed sequence of stages:
+//
+//   coalesce → pace → serialize (+ DL messages) → replay-store → inject errors → transmit
+//
+// Sequencing is owned by DlTxController. The optional stages (pacing, error
+// injection, DL messages) are template parameters, so a pipeline built with the
+// No* stages compiles those stages out entirely instead of testing a flag or an
+// empty std::function for every flit.
+//
+// Stage requirements:
+//   Pacing:   static constexpr bool kEnabled;
+//             PacingDecision check(std::size_t flit_count, std::size_t total_bytes);
+//   Errors:   static constexpr bool kEnabled;
+//             ErrorType next_error();
+//             DlFlit inject(const DlFlit &flit, ErrorType error);
+//   Messages: DlMessageQueue *queue() const noexcept;   (nullptr = no messages;
+//                                                        or DlConcurrentMessageQueue *)
+//             DlAltSectorConfig alt_sector() const noexcept;
+//
+// Usage:
+//   DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, NoTxErrors{}, NoTxMessages{}};
+//   const auto result = pipeline.transmit(tl_flits, [&](const DlFlit &flit) { wire.send(flit); });
+//
+// Use select_tx_pacing_stage() / select_tx_error_stage() / select_tx_message_stage()
+// to pick the stage types from runtime configuration once per call, or
+// DlPolicyTxPipeline to bind concrete pacing / error policies at compile time.
+
+// Maximum TL flits coalesced into one DL flit. DlSerializer lays 64-byte TL
+// flits out back to back; only the first seven slots (segments 0-3 slot 0)
+// start on a boundary DlDeserializer recognizes, so the pipeline stops there.
+constexpr std::size_t kMaxTlFlitsPerDlFlit = 7;
+
+// =============================================================================
+// Pacing Stages
+// =============================================================================
+
+struct NoTxPacing {
+  static constexpr bool kEnabled = false;
+
+  [[nodiscard]] PacingDecision check(std::size_t, std::size_t) const noexcept { return PacingDecision::kAllow; }
+};
+
+class ControllerTxPacing {
+public:
+  static constexpr bool kEnabled = true;
+
+  explicit ControllerTxPacing(const DlPacingController &controller) noexcept : controller_(&controller) {}
+
+  [[nodiscard]] PacingDecision check(std::size_t flit_count, std::size_t total_bytes) const {
+    return controller_->check_tx_pacing(flit_count, total_bytes);
+  }
+
+private:
+  const DlPacingController *controller_;
+};
+
+// Calls a pacing policy (e.g. SimpleTxRateLimiter) directly instead of through
+// DlPacingController's std::function, so the policy can be inlined. The policy
+// is held by reference; the caller keeps ownership (e.g. to reset_window()).
+template <typename Policy>
+class PolicyTxPacing {
+public:
+  static constexpr bool kEnabled = !std::is_same_v<Policy, NoTxPacingPolicy>;
+
+  explicit PolicyTxPacing(Policy &policy) noexcept : policy_(&policy) {}
+
+  [[nodiscard]] PacingDecision check(std::size_t flit_count, std::size_t total_bytes) {
+    return (*policy_)(flit_count, total_bytes);
+  }
+
+private:
+  Policy *policy_;
+};
+
+// =============================================================================
+// Error Injection Stages
+// =============================================================================
+
+struct NoTxErrors {
+  static constexpr bool kEnabled = false;
+
+  [[nodiscard]] ErrorType next_error() const noexcept { return ErrorType::kNone; }
+  [[nodiscard]] DlFlit inject(const DlFlit &flit, ErrorType) const { return flit; }
+};
+
+class InjectorTxErrors {
+public:
+  static constexpr bool kEnabled = true;
+
+  explicit InjectorTxErrors(DlErrorInjector &injector) noexcept : injector_(&injector) {}
+
+  [[nodiscard]] ErrorType next_error() { return injector_->get_next_error(); }
+  [[nodiscard]] DlFlit inject(const DlFlit &flit, ErrorType error) { return injector_->inject_error(flit, error); }
+
+private:
+  DlErrorInjector *injector_;
+};
+
+// Calls an error policy (e.g. RandomErrorPolicy) directly instead of through
+// DlErrorInjector's std::function. The policy is held by reference.
+template <typename Policy>
+class PolicyTxErrors {
+public:
+  static constexpr bool kEnabled = !std::is_same_v<Policy, NoErrorPolicy>;
+
+  explicit PolicyTxErrors(Policy &policy) noexcept : policy_(&policy) {}
+
+  [[nodiscard]] ErrorType next_error() { return (*policy_)(); }
+  [[nodiscard]] DlFlit inject(const DlFlit &flit, ErrorType error) const { return inject_flit_error(flit, error); }
+
+private:
+  Policy *policy_;
+};
+
+// =============================================================================
+// DL Message Stages
+// =============================================================================
+
+struct NoTxMessages {
+  [[nodiscard]] DlMessageQueue *queue() const noexcept { return nullptr; }
+  [[nodiscard]] DlAltSectorConfig alt_sector() const noexcept { return {}; }
+};
+
+class QueueTxMessages {
+public:
+  explicit QueueTxMessages(DlMessageQueue &message_queue, DlAltSectorConfig alt_sector = {}) noexcept
+      : message_queue_(&message_queue), alt_sector_(alt_sector) {}
+
+  [[nodiscard]] DlMessageQueue *queue() const noexcept { return message_queue_; }
+  [[nodiscard]] DlAltSectorConfig alt_sector() const noexcept { return alt_sector_; }
+
+private:
+  DlMessageQueue *message_queue_;
+  DlAltSectorConfig alt_sector_;
+};
+
+// Messages injected by other threads; the pipeline must run on the queue's consumer thread
+class ConcurrentQueueTxMessages {
+public:
+  explicit ConcurrentQueueTxMessages(DlConcurrentMessageQueue &message_queue, DlAltSectorConfig alt_sector = {}) noexcept
+      : message_queue_(&message_queue), alt_sector_(alt_sector) {}
+
+  [[nodiscard]] DlConcurrentMessageQueue *queue() const noexcept { return message_queue_; }
+  [[nodiscard]] DlAltSectorConfig alt_sector() const noexcept { return alt_sector_; }
+
+private:
+  DlConcurrentMessageQueue *message_queue_;
+  DlAltSectorConfig alt_sector_;
+};
+
+// =============================================================================
+// Pipeline
+// =============================================================================
+
+struct TxPipelineResult {
+  std::size_t dl_flits_transmitted{0};
+  std::size_t tl_flits_packed{0};
+  std::size_t dropped_by_pacing{0};
+  std::size_t dropped_by_error_injection{0};
+  std::size_t errors_injected{0};  // Flits transmitted with an injected error
+  bool stalled_on_replay_full{false};
+};
+
+template <typename PacingStage, typename ErrorStage, typename MessageStage>
+class DlTxPipeline {
+public:
+  DlTxPipeline(DlTxController &tx_controller, DlReplayBuffer &replay_buffer, PacingStage pacing, ErrorStage errors,
+               MessageStage messages)
+      : tx_controller_(tx_controller), replay_buffer_(replay_buffer), pacing_(std::move(pacing)),
+        errors_(std::move(errors)), messages_(std::move(messages)) {}
+
+  // Run tl_flits through the pipeline, calling transmit_fn(const DlFlit &) for
+  // each DL flit that reaches the wire.
+  //
+  // A pacing throttle or drop stops the call and discards the remaining TL
+  // flits (throttle is treated as drop). A full replay buffer also stops the
+  // call, before a sequence number is consumed. An injected packet drop happens
+  // after the replay store, so the flit consumes its sequence number and is
+  // recovered by the normal Replay Request path, exactly like a wire loss.
+  template <typename TransmitFn>
+  TxPipelineResult transmit(std::span<const TlFlit> tl_flits, TransmitFn &&transmit_fn);
+
+private:
+  DlTxController &tx_controller_;
+  DlReplayBuffer &replay_buffer_;
+  PacingStage pacing_;
+  ErrorStage errors_;
+  MessageStage messages_;
+
+  [[nodiscard]] DlFlit serialize_next(std::span<const TlFlit> chunk, std::uint16_t seq, std::size_t &packed);
+};
+
+// Pipeline with pacing and error policies bound at compile time:
+//   SimpleTxRateLimiter limiter(64);
+//   RandomErrorPolicy errors(1e-6);
+//   DlPolicyTxPipeline<SimpleTxRateLimiter, RandomErrorPolicy> pipeline{
+//       tx_controller, replay_buffer, PolicyTxPacing{limiter}, PolicyTxErrors{errors}, NoTxMessages{}};
+// NoTxPacingPolicy / NoErrorPolicy compile their stage out, like NoTxPacing / NoTxErrors.
+template <typename PacingPolicy, typename ErrorPolicy, typename MessageStage = NoTxMessages>
+using DlPolicyTxPipeline = DlTxPipeline<PolicyTxPacing<PacingPolicy>, PolicyTxErrors<ErrorPolicy>, MessageStage>;
+
+template <typename PacingStage, typename ErrorStage, typename MessageStage>
+template <typename TransmitFn>
+TxPipelineResult DlTxPipeline<PacingStage, ErrorStage, MessageStage>::transmit(std::span<const TlFlit> tl_flits,
+                                                                               TransmitFn &&transmit_fn) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TxPipelineResult result{};
+  std::size_t tl_flit_index = 0;
+
+  while (tl_flit_index < tl_flits.size()) {
+    // Stage 1: coalesce up to kMaxTlFlitsPerDlFlit TL flits
+    const std::size_t chunk_size = std::min(tl_flits.size() - tl_flit_index, kMaxTlFlitsPerDlFlit);
+    const std::span<const TlFlit> chunk = tl_flits.subspan(tl_flit_index, chunk_size);
+
+    // Stage 2: pace
+    if constexpr (PacingStage::kEnabled) {
+      if (pacing_.check(chunk.size(), chunk.size() * kTlFlitBytes) != PacingDecision::kAllow) {
+        result.dropped_by_pacing++;
+        break;
+      }
+    }
+
+    if (replay_buffer_.is_full()) {
+      result.stalled_on_replay_full = true;
+      break;
+    }
+
+    // Stage 3: sequence + serialize (DL messages take priority within each segment)
+    const auto [seq, should_add_to_replay] = tx_controller_.get_next_seq_for_payload();
+    std::size_t packed = 0;
+    DlFlit dl_flit = serialize_next(chunk, seq, packed);
+    tl_flit_index += packed;
+    result.tl_flits_packed += packed;
+
+    // Stage 4: replay-store (the clean flit, never the corrupted one)
+    if (should_add_to_replay) {
+      [[maybe_unused]] const bool added = replay_buffer_.add_flit(seq, dl_flit);
+    }
+
+    // Stage 5: inject errors - one policy draw per DL flit
+    if constexpr (ErrorStage::kEnabled) {
+      const ErrorType error = errors_.next_error();
+      if (error == ErrorType::kPacketDrop) {
+        result.dropped_by_error_injection++;
+        continue;
+      }
+      if (error != ErrorType::kNone) {
+        dl_flit = errors_.inject(dl_flit, error);
+        result.errors_injected++;
+      }
+    }
+
+    // Stage 6: transmit
+    transmit_fn(dl_flit);
+    result.dl_flits_transmitted++;
+  }
+
+  return result;
+}
+
+template <typename PacingStage, typename ErrorStage, typename MessageStage>
+DlFlit DlTxPipeline<PacingStage, ErrorStage, MessageStage>::serialize_next(std::span<const TlFlit> chunk,
+                                                                           std::uint16_t seq, std::size_t &packed) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  ExplicitFlitHeaderFields header{};
+  header.op = 0; // Explicit flit
+  header.payload = true;
+  header.flit_seq_no = seq;
+
+  return DlSerializer::serialize(chunk, header, messages_.queue(), messages_.alt_sector(), &packed);
+}
+
+// =============================================================================
+// Runtime → Compile-time Stage Selection
+// =============================================================================
+//
+// Each helper inspects one piece of runtime configuration and invokes fn with
+// the matching stage object, so callers can nest them to instantiate exactly
+// one pipeline type per call:
+//
+//   select_tx_pacing_stage(pacing, [&](auto pacing_stage) {
+//     return select_tx_error_stage(injector, [&](auto error_stage) { ... });
+//   });
+
+template <typename Fn>
+decltype(auto) select_tx_pacing_stage(const DlPacingController &pacing, Fn &&fn) {
+  if (pacing.has_tx_callback()) {
+    return fn(ControllerTxPacing{pacing});
+  }
+  return fn(NoTxPacing{});
+}
+
+template <typename Fn>
+decltype(auto) select_tx_error_stage(DlErrorInjector &injector, Fn &&fn) {
+  if (injector.is_enabled()) {
+    return fn(InjectorTxErrors{injector});
+  }
+  return fn(NoTxErrors{});
+}
+
+template <typename Fn>
+decltype(auto) select_tx_message_stage(DlMessageQueue &message_queue, Fn &&fn) {
+  if (message_queue.has_pending_messages()) {
+    return fn(QueueTxMessages{message_queue});
+  }
+  return fn(NoTxMessages{});
+}
+
+} // namespace ualink::dl
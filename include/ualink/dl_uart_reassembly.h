@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "ualink/dl_message_queue.h"
+#include "ualink/dl_messages.h"
+#include "ualink/trace.h"
+
+namespace ualink::dl {
+
+// =============================================================================
+// UartStreamReassemblyPool: Per-Stream UART Stream Transport Reassembly
+// =============================================================================
+//
+// The 3-bit stream_id allows 8 UART streams. Each stream owns a fixed
+// 33-DWord buffer (header + up to 32 payload DWords) in a pool allocated with
+// the object, and tracks its own progress, so a partial message on one stream
+// survives traffic and resets on the others. Nothing allocates after
+// construction.
+//
+// A completed message is handed out as a view into its stream's buffer. The
+// view stays valid until the next begin() or reset() on that stream.
+//
+// Usage:
+//   UartStreamReassemblyPool pool;
+//   const auto stream_id = pool.begin(header_dword); // nullopt = malformed header
+//   if (const UartStreamTransportView* msg = pool.append(*stream_id, payload)) {
+//     consume(msg->payload_dwords);
+//   }
+
+constexpr std::size_t kUartStreamCount = 8;
+
+// Completed UART Stream Transport message; payload_dwords points into the pool
+struct UartStreamTransportView {
+  std::uint8_t stream_id{0};
+  std::span<const std::uint32_t> payload_dwords;
+};
+
+class UartStreamReassemblyPool {
+public:
+  // Start a message from its received header DWord and return its stream ID.
+  // A message still in progress on the same stream is abandoned. Returns
+  // nullopt (and changes nothing) if the DWord is not a valid UART Stream
+  // Transport header.
+  [[nodiscard]] std::optional<std::uint8_t> begin(std::span<const std::byte, 4> header_dword);
+
+  // Append one payload DWord to a stream in progress. Returns the completed
+  // message after its last DWord, otherwise nullptr. Throws
+  // std::invalid_argument for a stream_id >= 8 and std::logic_error if no
+  // message is in progress on the stream.
+  [[nodiscard]] const UartStreamTransportView *append(std::uint8_t stream_id, std::uint32_t payload_dword);
+
+  [[nodiscard]] bool in_progress(std::uint8_t stream_id) const;
+  [[nodiscard]] bool any_in_progress() const noexcept { return active_streams_ != 0; }
+
+  // Payload DWords still expected on a stream (0 when idle)
+  [[nodiscard]] std::size_t payload_dwords_remaining(std::uint8_t stream_id) const;
+
+  // Drop a stream's partial message (or every stream's)
+  void reset(std::uint8_t stream_id);
+  void reset_all() noexcept;
+
+  // Statistics
+  struct Stats {
+    std::size_t messages_started{0};
+    std::size_t messages_completed{0};
+    std::size_t messages_abandoned{0}; // Restarted or reset while in progress
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  struct StreamBuffer {
+    // dwords[0] is the header; payload follows from dwords[1]
+    std::array<std::uint32_t, kMaxUartTransportDwords> dwords{};
+    std::size_t payload_expected{0};
+    std::size_t payload_received{0};
+    UartStreamTransportView completed{};
+  };
+
+  std::array<StreamBuffer, kUartStreamCount> pool_{};
+  std::uint8_t active_streams_{0}; // Bit n set = stream n in progress
+  Stats stats_;
+
+  // Helper: buffer for a stream ID (throws for stream_id >= 8)
+  [[nodiscard]] StreamBuffer &buffer_for(std::uint8_t stream_id);
+  [[nodiscard]] const StreamBuffer &buffer_for(std::uint8_t stream_id) const;
+};
+
+} // namespace ualink::dl
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ualink {
+
+// =============================================================================
+// Xoshiro256StarStar: fast, explicitly seeded PRNG for simulation
+// =============================================================================
+//
+// xoshiro256** (Blackman & Vigna). 256 bits of state, period 2^256 - 1, a few
+// cycles per 64-bit output. The state is expanded from a single 64-bit seed
+// with SplitMix64, so equal seeds give identical streams on every platform -
+// unlike std::random_device seeding, runs are reproducible.
+//
+// Satisfies UniformRandomBitGenerator, so it also works with <random>
+// distributions.
+
+class Xoshiro256StarStar {
+public:
+  using result_type = std::uint64_t;
+
+  explicit Xoshiro256StarStar(std::uint64_t seed) noexcept { reseed(seed); }
+
+  void reseed(std::uint64_t seed) noexcept;
+
+  [[nodiscard]] std::uint64_t operator()() noexcept;
+
+  // Uniform double in [0, 1) with 53 bits of precision
+  [[nodiscard]] double next_double() noexcept { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+  [[nodiscard]] static constexpr std::uint64_t min() noexcept { return 0; }
+  [[nodiscard]] static constexpr std::uint64_t max() noexcept { return std::numeric_limits<std::uint64_t>::max(); }
+
+private:
+  std::array<std::uint64_t, 4> state_{};
+
+  [[nodiscard]] static constexpr std::uint64_t rotl(std::uint64_t value, int shift) noexcept {
+    return (value << shift) | (value >> (64 - shift));
+  }
+};
+
+inline std::uint64_t Xoshiro256StarStar::operator()() noexcept {
+  const std::uint64_t result = rotl(state_[1] * 5, 7) * 9;
+  const std::uint64_t shifted = state_[1] << 17;
+
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= shifted;
+  state_[3] = rotl(state_[3], 45);
+
+  return result;
+}
+
+// =============================================================================
+// Geometric skip sampling
+// =============================================================================
+//
+// Number of Bernoulli(probability) failures before the next success, i.e. how
+// many trials to skip before the next event. Sampling the gap once replaces one
+// uniform draw per trial, which matters when probability is 1e-6 .. 1e-12.
+//
+// probability <= 0 never fires (returns max); probability >= 1 fires every trial.
+
+[[nodiscard]] std::uint64_t sample_geometric_gap(Xoshiro256StarStar &rng, double probability) noexcept;
+
+} // namespace ualink
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "ualink/tl_fields.h"
+#include "ualink/tl_flit.h"
+#include "ualink/trace.h"
+
+namespace ualink::tl {
+
+// =============================================================================
+// TlFieldPacker / TlFieldUnpacker: Compressed Control Field Packing
+// =============================================================================
+//
+// Callers describe every request and response in its uncompressed form. The
+// packer picks the compressed encoding (Tables 5-31..5-37) whenever the field
+// qualifies. It then packs fields back to back into 64-byte TL flits.
+//
+// Flit layout:
+//   - A flit is 16 four-byte sectors. Sector s occupies bytes [4s, 4s+4).
+//   - Each field starts at a sector aligned to its footprint: 4-sector fields
+//     at 0/4/8/12, 2-sector fields at even sectors.
+//   - Sectors skipped for alignment, and the tail of the last flit, are zero.
+//     Zero is the Flow Control NOP encoding.
+//   - Fields keep push order. The model has no data half-flits, so both
+//     32-byte halves carry control fields.
+//
+// Request compression (Table 5-32):
+//   - CMD must be Read, Write or WriteFull (kTlReqCmd* below).
+//   - ATTR must be 0xFF for reads and 0x00 for writes.
+//   - Length must be 64/128/192/256 bytes, and the address 64B-aligned
+//     without crossing 256B.
+//   - METADATA must fit in 3 bits. NUMBEATS must be 0 for reads and match
+//     the length for writes.
+//   - The 1MB region ReqAddr[56:20] must hit in the address cache.
+//
+// Address cache: each stream (SRCACCID) has kTlAddressCacheWays region bases.
+// A qualifying request that misses is sent uncompressed with CLOAD=1 and
+// CWAY naming a round-robin victim way. The Tx and Rx caches both load it,
+// so later requests to that region compress to a 14-bit ADDR
+// (ReqAddr[19:6]). The packer owns CLOAD/CWAY; callers leave them clear.
+//
+// Response compression (Tables 5-35, 5-37) requires STATUS == 0 and
+// SPARES == 0. SRCACCID is routing/debug only and is not carried, so it
+// unpacks as 0.
+//   - Single-beat read (RD/WR = 0, LEN = 0): FTYPE 0x4.
+//   - Write, or multi-beat read with OFFSET = 0 and LAST = 0: FTYPE 0x5.
+//
+// Usage:
+//   TlFieldPacker packer;
+//   packer.push(request_field);
+//   packer.push(response_field);
+//   packer.flush();
+//   for (const auto &flit : packer.take_flits()) { /* hand to the DL */ }
+//
+//   TlFieldUnpacker unpacker;
+//   const std::vector<TlControlField> fields = unpacker.unpack(flit);
+//
+// Streaming callers (e.g. UpliTlBridge) set a flit sink on the packer and use
+// the per-field unpack overload, so neither side builds a vector per flit.
+
+using TlControlField = std::variant<UncompressedRequestField, UncompressedResponseField, FlowControlNopField>;
+
+constexpr std::size_t kTlSectorBytes = 4;
+constexpr std::size_t kTlSectorsPerFlit = kTlFlitBytes / kTlSectorBytes;
+constexpr std::size_t kTlAddressCacheStreams = 1024; // 10-bit SRCACCID
+constexpr std::size_t kTlAddressCacheWays = 4;       // 2-bit CWAY
+
+// UPLI ReqCmd values the compressed CMD field can express (Table 5-33)
+constexpr std::uint8_t kTlReqCmdRead = 0x00;
+constexpr std::uint8_t kTlReqCmdWrite = 0x01;
+constexpr std::uint8_t kTlReqCmdWriteFull = 0x02;
+
+// Per-stream cache of 1MB region bases (ReqAddr[56:20]), one per way
+class TlAddressCache {
+public:
+  TlAddressCache();
+
+  // Way holding region for the stream, if any
+  [[nodiscard]] std::optional<std::uint8_t> lookup(std::uint16_t stream, std::uint64_t region) const;
+
+  // Region loaded in a way, if any
+  [[nodiscard]] std::optional<std::uint64_t> region(std::uint16_t stream, std::uint8_t way) const;
+
+  // Way the next allocate() for the stream will replace
+  [[nodiscard]] std::uint8_t victim(std::uint16_t stream) const;
+
+  // Load region into the round-robin victim way; returns the way
+  std::uint8_t allocate(std::uint16_t stream, std::uint64_t region);
+
+  // Load region into a specific way (Rx side, from CLOAD/CWAY)
+  void load(std::uint16_t stream, std::uint8_t way, std::uint64_t region);
+
+  void clear() noexcept;
+
+private:
+  static constexpr std::uint64_t kInvalidRegion = ~0ULL;
+  std::vector<std::uint64_t> regions_;   // [stream * kTlAddressCacheWays + way]
+  std::vector<std::uint8_t> next_victim_; // [stream]
+};
+
+class TlFieldPacker {
+public:
+  using FlitSink = std::function<void(std::span<const std::byte, kTlFlitBytes> flit)>;
+
+  // Append one field, compressed if it qualifies. Starts a new flit when the
+  // field does not fit in the current one. Throws std::invalid_argument if a
+  // field value is out of range for its format.
+  void push(const TlControlField &field);
+
+  // Close the partially filled flit, if any
+  void flush();
+
+  [[nodiscard]] bool has_partial_flit() const noexcept { return next_sector_ != 0; }
+
+  // Completed flits, in order; the internal list is emptied
+  [[nodiscard]] std::vector<std::array<std::byte, kTlFlitBytes>> take_flits();
+
+  // Hand each flit to sink as it closes instead of keeping it for take_flits()
+  void set_flit_sink(FlitSink sink) { flit_sink_ = std::move(sink); }
+
+  // Drop cached regions (both link partners must reset together)
+  void reset_address_cache() noexcept { address_cache_.clear(); }
+
+  // Statistics
+  struct Stats {
+    std::size_t flits{0};
+    std::size_t requests_compressed{0};
+    std::size_t requests_uncompressed{0};
+    std::size_t responses_compressed{0};
+    std::size_t responses_uncompressed{0};
+    std::size_t flow_control_fields{0};
+    std::size_t field_bytes{0};        // Bytes of fields as encoded
+    std::size_t uncompressed_bytes{0}; // Bytes the same fields take uncompressed
+    std::size_t padding_bytes{0};      // NOP sectors (alignment and flit tails)
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  void push_request(const UncompressedRequestField &request);
+  void push_response(const UncompressedResponseField &response);
+  void place(std::span<const std::byte> field_bytes);
+  void close_flit();
+
+  TlAddressCache address_cache_;
+  std::vector<std::array<std::byte, kTlFlitBytes>> flits_;
+  std::array<std::byte, kTlFlitBytes> current_{};
+  std::size_t next_sector_{0};
+  FlitSink flit_sink_;
+  Stats stats_;
+};
+
+class TlFieldUnpacker {
+public:
+  // Decode every non-NOP field in a flit, expanded to uncompressed form.
+  // Throws std::invalid_argument on a reserved FTYPE, a misaligned field, or
+  // a compressed request whose CWAY was never loaded; cache loads from
+  // earlier fields in the flit are kept.
+  [[nodiscard]] std::vector<TlControlField> unpack(std::span<const std::byte, kTlFlitBytes> flit);
+
+  // Same, calling on_field for each field in order instead of collecting them
+  void unpack(std::span<const std::byte, kTlFlitBytes> flit, const std::function<void(const TlControlField &)> &on_field);
+
+  void reset_address_cache() noexcept { address_cache_.clear(); }
+
+private:
+  TlAddressCache address_cache_;
+};
+
+} // namespace ualink::tl
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <optional>
 #include <span>
+#include <vector>
 
 #include "bit_fields/bit_fields.h"
 #include "ualink/trace.h"
@@ -114,6 +115,14 @@ public:
   [[nodiscard]] static std::array<std::byte, kTlFlitBytes> serialize_write_completion(
       const TlWriteCompletion& completion,
       TlMessageType message_type = TlMessageType::kNone);
+
+  // Serialize read request into a 32-byte half-flit (half_flit bit forced to 1)
+  [[nodiscard]] static std::array<std::byte, kTlHalfFlitBytes> serialize_read_request_half(
+      const TlReadRequest& request);
+
+  // Serialize write completion into a 32-byte half-flit (half_flit bit forced to 1)
+  [[nodiscard]] static std::array<std::byte, kTlHalfFlitBytes> serialize_write_completion_half(
+      const TlWriteCompletion& completion);
 };
 
 class TlDeserializer {
@@ -136,8 +145,94 @@ public:
   // Deserialize write completion from TL flit
   [[nodiscard]] static std::optional<TlWriteCompletion> deserialize_write_completion(
       std::span<const std::byte, kTlFlitBytes> flit);
+
+  // Deserialize TL opcode from half-flit
+  [[nodiscard]] static TlOpcode deserialize_opcode(std::span<const std::byte, kTlHalfFlitBytes> half_flit);
+
+  // Deserialize read request from half-flit (nullopt if opcode or half_flit bit mismatch)
+  [[nodiscard]] static std::optional<TlReadRequest> deserialize_read_request_half(
+      std::span<const std::byte, kTlHalfFlitBytes> half_flit);
+
+  // Deserialize write completion from half-flit (nullopt if opcode or half_flit bit mismatch)
+  [[nodiscard]] static std::optional<TlWriteCompletion> deserialize_write_completion_half(
+      std::span<const std::byte, kTlHalfFlitBytes> half_flit);
+};
+
+// =============================================================================
+// TlHalfFlitPacker: Two Half-Flits per 64-Byte TL Slot
+// =============================================================================
+//
+// Read requests (8-byte header) and write completions (4-byte header) carry
+// no data, so a full 64-byte TL flit is mostly zeros. Their half-flit forms
+// are 32 bytes, and two of them share one 64-byte slot. The DL carries the
+// slot like any other TL flit.
+//
+// The slot is self-describing through the half_flit header bit (bit 4 of the
+// first byte, in both request and response headers):
+//   - bit clear in bytes 0..31:  full 64-byte TL flit
+//   - bit set in bytes 0..31:    first half-flit; bytes 32..63 hold a second
+//                                half-flit if its own bit is set, else zeros
+//
+// The packer keeps push order: a full flit pushed while a half-flit waits for
+// a partner sends the waiting half-flit alone first.
+//
+// Usage:
+//   TlHalfFlitPacker packer;
+//   packer.push_half_flit(TlSerializer::serialize_read_request_half(request_a));
+//   packer.push_half_flit(TlSerializer::serialize_read_request_half(request_b));
+//   packer.flush();
+//   for (const auto& slot : packer.take_slots()) { /* hand to the DL */ }
+//
+//   const TlSlotContents contents = unpack_tl_slot(slot);
+
+// True if the TL unit starting with first_byte is a half-flit
+[[nodiscard]] constexpr bool is_half_flit(std::byte first_byte) noexcept {
+  return ((static_cast<std::uint8_t>(first_byte) >> 4) & 0x1U) != 0;
+}
+
+class TlHalfFlitPacker {
+public:
+  // Queue a full TL flit in a slot of its own
+  void push_flit(std::span<const std::byte, kTlFlitBytes> flit);
+
+  // Queue a half-flit; it shares a slot with the next half-flit pushed.
+  // Throws std::invalid_argument if its half_flit bit is clear.
+  void push_half_flit(std::span<const std::byte, kTlHalfFlitBytes> half_flit);
+
+  // Send a half-flit still waiting for a partner alone
+  void flush();
+
+  [[nodiscard]] bool has_pending_half_flit() const noexcept { return pending_half_; }
+
+  // Completed 64-byte slots, in order; the internal list is emptied
+  [[nodiscard]] std::vector<std::array<std::byte, kTlFlitBytes>> take_slots();
+
+  // Statistics
+  struct Stats {
+    std::size_t full_slots{0};        // Slots carrying a full TL flit
+    std::size_t paired_slots{0};      // Slots carrying two half-flits
+    std::size_t single_half_slots{0}; // Slots carrying one half-flit
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+private:
+  std::vector<std::array<std::byte, kTlFlitBytes>> slots_;
+  std::array<std::byte, kTlFlitBytes> pending_slot_{};
+  bool pending_half_{false};
+  Stats stats_;
 };
 
+// Contents of one 64-byte TL slot
+struct TlSlotContents {
+  bool full_flit{false};          // true: the slot is one full TL flit
+  std::size_t half_flit_count{0}; // 1 or 2 when full_flit is false
+  std::array<std::array<std::byte, kTlHalfFlitBytes>, 2> half_flits{};
+};
+
+// Split a received 64-byte TL slot into a full flit or its half-flits
+[[nodiscard]] TlSlotContents unpack_tl_slot(std::span<const std::byte, kTlFlitBytes> slot);
+
 // Serialize TL request header
 [[nodiscard]] std::array<std::byte, 8> serialize_tl_request_header(const TlRequestHeader& header);
 
@@ -5,13 +5,16 @@
 #include <functional>
 #include <optional>
 #include <queue>
+#include <span>
 #include <vector>
 
 #include "ualink/dl_command.h"
 #include "ualink/dl_error_injection.h"
 #include "ualink/dl_flit.h"
+#include "ualink/dl_message_queue.h"
 #include "ualink/dl_pacing.h"
 #include "ualink/dl_replay.h"
+#include "ualink/dl_tx_controller.h"
 #include "ualink/tl_flit.h"
 #include "ualink/trace.h"
 
@@ -24,6 +27,9 @@ using WriteCompletionCallback = std::function<void(std::uint16_t tag, std::uint8
 // Transmit callback - called when DL flit is ready to send on wire
 using TransmitCallback = std::function<void(const dl::DlFlit &flit)>;
 
+// Raw TL flit receive callback - replaces the built-in TL response decoding
+using TlFlitCallback = std::function<void(const dl::TlFlit &tl_flit)>;
+
 // Configuration for UaLinkEndpoint
 struct EndpointConfig {
   // Pacing configuration (optional - nullptr means no pacing)
@@ -46,6 +52,7 @@ struct EndpointConfig {
 // High-level endpoint for UaLink protocol stack
 // Provides simple API for applications: send_read_request(), send_write_request()
 // Automatically handles TL→DL serialization, replay buffering, pacing, and error injection
+// Transmit runs through DlTxPipeline (see dl_tx_pipeline.h); DlTxController owns sequencing
 class UaLinkEndpoint {
 public:
   explicit UaLinkEndpoint(const EndpointConfig &config = EndpointConfig{});
@@ -53,27 +60,42 @@ public:
   // === Transmit API ===
 
   // Send a read request
-  // Returns: transaction tag assigned to this request (for matching with completion)
-  [[nodiscard]] std::uint16_t send_read_request(std::uint64_t address, std::uint8_t size);
+  // Returns: transaction tag assigned to this request (for matching with completion), or
+  // std::nullopt if its flit did not go out (replay buffer full or dropped by pacing). No tag is
+  // used up then; retry once ACKs have freed replay space.
+  [[nodiscard]] std::optional<std::uint16_t> send_read_request(std::uint64_t address, std::uint8_t size);
 
   // Send a write request
-  // Returns: transaction tag assigned to this request
-  [[nodiscard]] std::uint16_t send_write_request(std::uint64_t address, std::uint8_t size, const std::vector<std::byte> &data);
+  // Returns: transaction tag assigned to this request, or std::nullopt as for send_read_request
+  [[nodiscard]] std::optional<std::uint16_t> send_write_request(std::uint64_t address, std::uint8_t size, const std::vector<std::byte> &data);
+
+  // Send TL flits built by a higher layer (e.g. UpliTlBridge) as they are.
+  // Up to dl::kMaxTlFlitsPerDlFlit of them share each DL flit.
+  // Returns: TL flits sent, in order from the front. The rest were not sent (pacing drop or replay
+  // buffer full) and are the caller's to retry.
+  [[nodiscard]] std::size_t send_tl_flits(std::span<const dl::TlFlit> tl_flits);
 
   // Set transmit callback - must be set before calling send_*
   void set_transmit_callback(TransmitCallback callback);
 
+  // Queue a DL message; it is carried in the next transmitted DL flit(s)
+  void enqueue_dl_message(const dl::DlMessage &msg);
+
   // === Receive API ===
 
   // Receive a DL flit from the wire
   // Automatically deserializes DL→TL, checks CRC, applies pacing
   // Triggers completion callbacks for matching transactions
+  // With ACK/NAK enabled, TL flits are delivered only from flits accepted in sequence
   void receive_flit(const dl::DlFlit &flit);
 
   // Set completion callbacks
   void set_read_completion_callback(ReadCompletionCallback callback);
   void set_write_completion_callback(WriteCompletionCallback callback);
 
+  // If set, every received TL flit goes here instead of to the completion callbacks
+  void set_tl_flit_callback(TlFlitCallback callback);
+
   // === Replay Buffer Management ===
 
   // Process ACK - removes acknowledged flits from replay buffer
@@ -83,16 +105,18 @@ public:
   void replay_from(std::uint16_t seq);
 
   // Get current transmit sequence number
-  [[nodiscard]] std::uint16_t get_tx_seq() const { return tx_last_seq_; }
+  [[nodiscard]] std::uint16_t get_tx_seq() const { return tx_controller_.get_state().last_seq; }
 
   // === Statistics ===
 
   struct Stats {
     std::size_t tx_read_requests{0};
     std::size_t tx_write_requests{0};
+    std::size_t tx_tl_flits{0}; // Sent through send_tl_flits()
     std::size_t tx_dl_flits{0};
     std::size_t tx_dropped_by_pacing{0};
     std::size_t tx_dropped_by_error_injection{0};
+    std::size_t tx_stalled_replay_full{0};
     std::size_t tx_acks_sent{0};
     std::size_t tx_replay_requests_sent{0};
 
@@ -100,6 +124,7 @@ public:
     std::size_t rx_write_completions{0};
     std::size_t rx_dl_flits{0};
     std::size_t rx_crc_errors{0};
+    std::size_t rx_flits_discarded{0}; // Duplicate or out of sequence
     std::size_t rx_flits_with_pacing{0};
     std::size_t rx_acks_received{0};
     std::size_t rx_replay_requests_received{0};
@@ -125,10 +150,11 @@ public:
 
 private:
   // Internal state
-  std::uint16_t tx_last_seq_{0x1FF}; // Last sequence number added to TxReplay (default 0x1FF)
-  std::uint16_t next_tag_{0};        // Next transaction tag to assign
+  std::uint16_t next_tag_{0}; // Next transaction tag to assign
 
   // Components
+  dl::DlTxController tx_controller_;
+  dl::DlMessageQueue message_queue_;
   dl::DlReplayBuffer replay_buffer_;
   dl::DlPacingController pacing_controller_;
   dl::DlErrorInjector error_injector_;
@@ -143,12 +169,13 @@ private:
   TransmitCallback transmit_callback_;
   ReadCompletionCallback read_completion_callback_;
   WriteCompletionCallback write_completion_callback_;
+  TlFlitCallback tl_flit_callback_;
 
   // Statistics
   Stats stats_;
 
   // Helper methods
-  void transmit_tl_flits(const std::vector<dl::TlFlit> &tl_flits);
+  std::size_t transmit_tl_flits(std::span<const dl::TlFlit> tl_flits); // Returns TL flits packed
   void handle_tl_flit(const dl::TlFlit &tl_flit);
   std::uint16_t allocate_tag();
 };
@@ -4,7 +4,6 @@
 #include <cstddef>
 #include <cstdint>
 #include <span>
-#include <vector>
 
 #include "bit_fields/bit_fields.h"
 #include "ualink/trace.h"
@@ -14,12 +13,47 @@ namespace ualink::upli {
 // UPLI constants
 constexpr std::size_t kMaxPorts = 4;
 constexpr std::size_t kUpliDataBeatBytes = 64;
+constexpr std::size_t kUpliMaxDataBeats = 4;  // 2-bit req_num_beats
+constexpr std::size_t kUpliMaxTransferBytes =
+    kUpliMaxDataBeats * kUpliDataBeatBytes;  // 6-bit req_len in doublewords
+
+// Data beats carrying req_len + 1 doublewords. A write's req_num_beats is
+// this minus one; a read's is 0 and its RdRsp beats follow from req_len.
+[[nodiscard]] constexpr std::size_t upli_data_beats(
+    std::uint8_t req_len) noexcept {
+  const std::size_t bytes = (static_cast<std::size_t>(req_len) + 1) * 4;
+  return (bytes + kUpliDataBeatBytes - 1) / kUpliDataBeatBytes;
+}
 
 // UPLI Channel Flit - raw 64-byte message container
 struct UpliChannelFlit {
   std::array<std::byte, kUpliDataBeatBytes> data{};
 };
 
+// =============================================================================
+// UPLI Command Encodings
+// =============================================================================
+
+// ReqCmd values (6 bits)
+enum class ReqCmd : std::uint8_t {
+  kRead = 0x03,              // I/O coherent read
+  kWrite = 0x28,             // I/O coherent write with byte enables
+  kWriteFull = 0x29,         // Full cache-line write
+  kUpliWriteMessage = 0x2A,  // Protocol message
+  kAtomicR = 0x30,           // Atomic with data return
+  kAtomicNR = 0x32,          // Atomic without data return
+};
+
+// RdRsp/WrRsp status values (4 bits)
+enum class RspStatus : std::uint8_t {
+  kOkay = 0b0000,                 // Normal completion
+  kTargetAbort = 0b0010,          // End-target error
+  kDecodeError = 0b0011,          // Address decode error
+  kProtectionViolation = 0b0110,  // Security/protection check failure
+  kCmpto = 0b1000,                // Completion timeout
+  kIsolate = 0b1111,              // Place originator in isolation (WrRsp only)
+};
+
 // =============================================================================
 // UPLI Request Channel Format
 // =============================================================================
@@ -154,37 +188,75 @@ struct UpliCreditReturn {
   std::array<bool, kMaxPorts> credit_init_done{};  // Initialization complete per port
 };
 
+// =============================================================================
+// Serialized Sizes
+// =============================================================================
+
+// Every channel beat has a fixed size, known from its format at compile time
+inline constexpr std::size_t kUpliRequestBytes =
+    (kUpliRequestFormat.total_bits() + 7) / 8;
+inline constexpr std::size_t kUpliOrigDataControlBytes =
+    (kUpliOrigDataControlFormat.total_bits() + 7) / 8;
+inline constexpr std::size_t kUpliOrigDataBytes =
+    kUpliOrigDataControlBytes + kUpliDataBeatBytes;
+inline constexpr std::size_t kUpliRdRspControlBytes =
+    (kUpliRdRspFormat.total_bits() + 7) / 8;
+inline constexpr std::size_t kUpliRdRspBytes =
+    kUpliRdRspControlBytes + kUpliDataBeatBytes;
+inline constexpr std::size_t kUpliWrRspBytes =
+    (kUpliWrRspFormat.total_bits() + 7) / 8;
+inline constexpr std::size_t kUpliCreditPortBytes =
+    (kUpliCreditPortFormat.total_bits() + 7) / 8;
+inline constexpr std::size_t kUpliCreditReturnBytes =
+    (kMaxPorts * kUpliCreditPortBytes) + 1;  // +1 for init_done flags
+
 // =============================================================================
 // Serialize/Deserialize Functions
 // =============================================================================
+//
+// Serializers return fixed-size arrays, so a beat never touches the heap.
+// The span overloads write into a caller-owned buffer (e.g. a slot in a
+// preallocated ring); the whole span is overwritten. Both throw
+// std::invalid_argument on an out-of-range field before writing anything.
 
 // Request channel
-[[nodiscard]] std::vector<std::byte> serialize_upli_request(
+[[nodiscard]] std::array<std::byte, kUpliRequestBytes> serialize_upli_request(
     const UpliRequestFields& fields);
+void serialize_upli_request(const UpliRequestFields& fields,
+                            std::span<std::byte, kUpliRequestBytes> out);
 [[nodiscard]] UpliRequestFields deserialize_upli_request(
     std::span<const std::byte> bytes);
 
 // Originator Data channel
-[[nodiscard]] std::vector<std::byte> serialize_upli_orig_data(
+[[nodiscard]] std::array<std::byte, kUpliOrigDataBytes> serialize_upli_orig_data(
     const UpliOrigDataFields& fields);
+void serialize_upli_orig_data(const UpliOrigDataFields& fields,
+                              std::span<std::byte, kUpliOrigDataBytes> out);
 [[nodiscard]] UpliOrigDataFields deserialize_upli_orig_data(
     std::span<const std::byte> bytes);
 
 // Read Response channel
-[[nodiscard]] std::vector<std::byte> serialize_upli_rd_rsp(
+[[nodiscard]] std::array<std::byte, kUpliRdRspBytes> serialize_upli_rd_rsp(
     const UpliRdRspFields& fields);
+void serialize_upli_rd_rsp(const UpliRdRspFields& fields,
+                           std::span<std::byte, kUpliRdRspBytes> out);
 [[nodiscard]] UpliRdRspFields deserialize_upli_rd_rsp(
     std::span<const std::byte> bytes);
 
 // Write Response channel
-[[nodiscard]] std::vector<std::byte> serialize_upli_wr_rsp(
+[[nodiscard]] std::array<std::byte, kUpliWrRspBytes> serialize_upli_wr_rsp(
     const UpliWrRspFields& fields);
+void serialize_upli_wr_rsp(const UpliWrRspFields& fields,
+                           std::span<std::byte, kUpliWrRspBytes> out);
 [[nodiscard]] UpliWrRspFields deserialize_upli_wr_rsp(
     std::span<const std::byte> bytes);
 
 // Credit Return
-[[nodiscard]] std::vector<std::byte> serialize_upli_credit_return(
-    const UpliCreditReturn& credits);
+[[nodiscard]] std::array<std::byte, kUpliCreditReturnBytes>
+serialize_upli_credit_return(const UpliCreditReturn& credits);
+void serialize_upli_credit_return(
+    const UpliCreditReturn& credits,
+    std::span<std::byte, kUpliCreditReturnBytes> out);
 [[nodiscard]] UpliCreditReturn deserialize_upli_credit_return(
     std::span<const std::byte> bytes);
 
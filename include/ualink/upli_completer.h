@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_credit.h"
+#include "ualink/upli_ordering.h"
+#include "ualink/upli_tdm.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliCompleter: Request Reception and Response Return
+// =============================================================================
+//
+// The completer receives Request and OrigData beats and dispatches each
+// request to the application once it is whole:
+//
+//   - A read is dispatched when its request beat arrives.
+//   - A write is dispatched when its last OrigData beat arrives. A write
+//     carries req_num_beats + 1 data beats (up to four, 256 bytes), and
+//     data beats follow their requests in order on each port.
+//
+// The application answers later, from the callback or any time afterwards,
+// with send_read_response() or send_write_response(). Many requests can be
+// pending at once. Each has a (port, tag)-indexed slot that holds its state
+// and read data until the response goes out in the port's TDM slots: one
+// WrRsp beat, or one RdRsp beat per 64 bytes read.
+//
+// Once the response is sent, the request buffer is free again. The
+// completer owes one Request credit for that port/VC, or for the port's pool
+// when request_credits.use_pool is set. At the end of each cycle it sends at
+// most one credit-return message, coalesced by
+// UpliCreditManager::generate_credit_return.
+//
+// Usage:
+//   UpliCompleter completer(config);
+//   completer.set_request_callback(
+//       [&](const UpliCompleterRequest& request,
+//           std::span<const std::byte> write_data) { ... });
+//   completer.set_rd_rsp_sink(...);
+//   completer.set_wr_rsp_sink(...);
+//   completer.set_credit_return_sink(...);
+//   completer.process_request(request_beat);       // From the originator
+//   completer.send_read_response(port, tag, RspStatus::kOkay, data);
+//   completer.advance_cycle();                     // Once per UPLI clock
+
+struct UpliCompleterConfig {
+  std::uint16_t physical_acc_id{0};  // 10 bits: This accelerator's ID
+  BifurcationMode bifurcation{BifurcationMode::kX4};
+  std::size_t queue_depth{kDefaultTdmQueueDepth};  // Per (port, channel)
+  PortCreditConfig request_credits{};  // Advertised to the originator, per port
+};
+
+// A complete request as handed to the application
+struct UpliCompleterRequest {
+  std::uint8_t port_id{0};
+  std::uint16_t src_acc_id{0};
+  std::uint16_t tag{0};
+  std::uint64_t address{0};
+  ReqCmd cmd{ReqCmd::kRead};
+  std::uint8_t len{0};  // Doublewords - 1
+  std::uint8_t vc{0};
+};
+
+class UpliCompleter {
+ public:
+  using RequestCallback =
+      std::function<void(const UpliCompleterRequest& request,
+                         std::span<const std::byte> write_data)>;
+  using RdRspSink = std::function<void(const UpliRdRspFields&)>;
+  using WrRspSink = std::function<void(const UpliWrRspFields&)>;
+  using CreditReturnSink = std::function<void(const UpliCreditReturn&)>;
+
+  explicit UpliCompleter(const UpliCompleterConfig& config);
+
+  // Request reception. Throws std::invalid_argument for an inactive port, a
+  // tag that is already pending, an unsupported command, or OrigData with no
+  // write waiting for it.
+  void process_request(const UpliRequestFields& beat);
+  void process_orig_data(const UpliOrigDataFields& beat);
+
+  // Response API. Returns false if the port's response queue cannot take
+  // every beat of the response; the request stays pending and the call can
+  // be retried. Throws std::invalid_argument if (port, tag) is not a
+  // dispatched request of the matching kind, or the read data is longer than
+  // the request.
+  [[nodiscard]] bool send_read_response(std::uint8_t port_id,
+                                        std::uint16_t tag, RspStatus status,
+                                        std::span<const std::byte> data);
+  [[nodiscard]] bool send_write_response(std::uint8_t port_id,
+                                         std::uint16_t tag, RspStatus status);
+
+  // Run one TDM cycle, handing granted response beats to the sinks. Returns
+  // the number of beats sent.
+  std::size_t advance_cycle();
+
+  // Channel connections
+  void set_request_callback(RequestCallback callback) {
+    request_callback_ = std::move(callback);
+  }
+  void set_rd_rsp_sink(RdRspSink sink) { rd_rsp_sink_ = std::move(sink); }
+  void set_wr_rsp_sink(WrRspSink sink) { wr_rsp_sink_ = std::move(sink); }
+  void set_credit_return_sink(CreditReturnSink sink) {
+    credit_return_sink_ = std::move(sink);
+  }
+
+  [[nodiscard]] std::size_t pending() const noexcept { return pending_; }
+  [[nodiscard]] const UpliTdmScheduler& tdm_scheduler() const noexcept {
+    return tdm_scheduler_;
+  }
+
+  // Statistics
+  struct Stats {
+    std::size_t reads_received{0};
+    std::size_t writes_received{0};
+    std::size_t orig_data_beats{0};
+    std::size_t rd_rsp_beats{0};
+    std::size_t read_responses{0};
+    std::size_t write_responses{0};
+    std::size_t credits_returned{0};
+    std::size_t credit_return_messages{0};
+    std::size_t response_queue_full{0};
+    std::size_t max_pending{0};
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+ private:
+  enum class SlotState : std::uint8_t {
+    kFree,
+    kAwaitingData,  // Write request received, OrigData not yet
+    kDispatched,    // Handed to the application
+    kResponding,    // Response queued for its TDM slot
+  };
+
+  struct PendingRequest {
+    SlotState state{SlotState::kFree};
+    bool write{false};
+    std::uint8_t vc{0};
+    std::uint8_t status{0};
+    std::uint8_t beats{1};
+    std::uint8_t beats_received{0};  // OrigData beats so far
+    UpliCompleterRequest request{};
+    std::array<std::byte, kUpliMaxTransferBytes> data{};  // Write/read data
+  };
+
+  // Write tags in arrival order, per port, waiting for their OrigData beat
+  struct TagFifo {
+    std::vector<std::uint16_t> ring;
+    std::size_t head{0};
+    std::size_t count{0};
+  };
+
+  [[nodiscard]] PendingRequest& slot(std::uint8_t port_id, std::uint16_t tag);
+  [[nodiscard]] PendingRequest& dispatched_slot(std::uint8_t port_id,
+                                                std::uint16_t tag, bool write);
+  void dispatch(PendingRequest& pending);
+  void on_grant(std::uint8_t port_id, UpliChannel channel,
+                const UpliTdmBeat& beat);
+
+  UpliCompleterConfig config_;
+  UpliTdmScheduler tdm_scheduler_;
+  UpliCreditManager owed_credits_;  // Receive side only: owed Request credits
+
+  // (port, tag)-indexed request state
+  std::vector<PendingRequest> slots_;
+  std::array<TagFifo, kMaxPorts> awaiting_data_{};
+  std::size_t pending_{0};
+
+  // Channel connections
+  RequestCallback request_callback_;
+  RdRspSink rd_rsp_sink_;
+  WrRspSink wr_rsp_sink_;
+  CreditReturnSink credit_return_sink_;
+
+  Stats stats_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
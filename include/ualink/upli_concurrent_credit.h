@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_credit.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliConcurrentCreditManager: Lock-Free Send-Side Credit Counters
+// =============================================================================
+//
+// Same per-(port, VC) and pool credit accounting as UpliCreditManager, for
+// senders whose credits are consumed and returned on different threads.
+//
+// Thread roles:
+//   Setup (one thread, before traffic): configure_port, initialize_credits
+//   Senders (any thread):               try_consume_credit
+//   Credit receivers (any thread):      process_credit_return, return_credits
+//   Anyone:                             get_available_credits, get_stats
+//
+// Each (port, VC) counter, and each port's pool, sits on its own cache line.
+// Threads sending on different VCs therefore never share a line. Consuming is
+// one CAS loop that never lets the count go negative. Returning is one
+// fetch_add. Returns are not capped at the initial credits, since a cap would
+// need a CAS. A return that pushes a count above its initial value is a
+// protocol error; it is counted in over_returned and kept.
+//
+// The traffic-path calls never throw. An out-of-range port or VC fails the
+// call (returns false) instead.
+//
+// Usage:
+//   UpliConcurrentCreditManager credits;
+//   credits.configure_port(0, config);
+//   credits.initialize_credits();
+//   // sender threads
+//   while (!credits.try_consume_credit(0, vc)) { /* back off */ }
+//   // receive thread
+//   credits.process_credit_return(credit_return);
+
+class UpliConcurrentCreditManager {
+ public:
+  // Setup only; not safe against concurrent traffic-path calls. Throws
+  // std::invalid_argument for an out-of-range port.
+  void configure_port(std::uint8_t port_id, const PortCreditConfig& config);
+  void initialize_credits();
+
+  // Take one credit. Returns false if none is available (counted in
+  // send_blocked_count) or port/VC is out of range.
+  [[nodiscard]] bool try_consume_credit(std::uint8_t port_id,
+                                        std::uint8_t vc) noexcept;
+
+  // Give back credits to a VC (or the port's pool in pool mode). Returns
+  // false if port/VC is out of range.
+  [[nodiscard]] bool return_credits(std::uint8_t port_id, std::uint8_t vc,
+                                    std::size_t count) noexcept;
+
+  // Apply every valid per-port entry of a credit return message
+  void process_credit_return(const UpliCreditReturn& credits) noexcept;
+
+  // Relaxed snapshot; 0 for an out-of-range port/VC
+  [[nodiscard]] std::size_t get_available_credits(
+      std::uint8_t port_id, std::uint8_t vc) const noexcept;
+
+  // Statistics (relaxed snapshots, per port/VC). In pool mode every VC of a
+  // port reports the same pool stats.
+  struct Stats {
+    std::size_t credits_returned{0};
+    std::size_t send_blocked_count{0};
+    std::size_t over_returned{0};
+  };
+  [[nodiscard]] Stats get_stats(std::uint8_t port_id,
+                                std::uint8_t vc) const noexcept;
+
+ private:
+  static constexpr std::size_t kCacheLineBytes = 64;
+
+  // One cache line per counter. The stats live on the same line because
+  // the thread that updates them has just written `available`.
+  struct alignas(kCacheLineBytes) CreditCounter {
+    std::atomic<std::size_t> available{0};
+    std::size_t initial{0};
+    std::atomic<std::size_t> credits_returned{0};
+    std::atomic<std::size_t> send_blocked_count{0};
+    std::atomic<std::size_t> over_returned{0};
+  };
+  static_assert(sizeof(CreditCounter) == kCacheLineBytes);
+
+  [[nodiscard]] CreditCounter* counter_for(std::uint8_t port_id,
+                                           std::uint8_t vc) noexcept;
+  [[nodiscard]] const CreditCounter* counter_for(
+      std::uint8_t port_id, std::uint8_t vc) const noexcept;
+  static void add_credits(CreditCounter& counter, std::size_t count) noexcept;
+
+  std::array<std::array<CreditCounter, kMaxVirtualChannels>, kMaxPorts>
+      vc_counters_{};
+  std::array<CreditCounter, kMaxPorts> pool_counters_{};
+  std::array<PortCreditConfig, kMaxPorts> port_config_{};
+  std::array<bool, kMaxPorts> use_pool_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
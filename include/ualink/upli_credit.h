@@ -14,6 +14,7 @@ namespace ualink::upli {
 constexpr std::size_t kMaxVirtualChannels = 4;
 constexpr std::size_t kDefaultCreditsPerVC = 16;
 constexpr std::size_t kDefaultPoolCredits = 32;
+constexpr std::size_t kMaxCreditsPerReturn = 4;  // credit_num 0-3 encoding
 
 // Credit configuration per virtual channel
 struct VcCreditConfig {
@@ -51,6 +52,11 @@ struct PortCreditState {
   std::size_t pool_initial{0};
   bool use_pool{false};
   bool port_init_done{false};
+
+  // Receive side: credits freed locally, not yet returned to the sender
+  std::array<std::size_t, kMaxVirtualChannels> vc_owed{};
+  std::size_t pool_owed{0};
+  std::size_t next_return_slot{0};  // Round-robin over VCs, then pool
 };
 
 // UPLI Credit Manager
@@ -72,7 +78,17 @@ class UpliCreditManager {
   void process_credit_return(const UpliCreditReturn& credits);
   void return_credits(std::uint8_t port_id, std::uint8_t vc, std::size_t count);
 
-  // Generate credit return message to send to remote
+  // Receive side: record buffers freed for the remote sender
+  void owe_credits(std::uint8_t port_id, std::uint8_t vc, std::size_t count);
+  void owe_pool_credits(std::uint8_t port_id, std::size_t count);
+  [[nodiscard]] std::size_t get_owed_credits(std::uint8_t port_id,
+                                             std::uint8_t vc) const;
+  [[nodiscard]] std::size_t get_owed_pool_credits(std::uint8_t port_id) const;
+
+  // Generate credit return message to send to remote. Each port's entry
+  // carries up to kMaxCreditsPerReturn owed credits for one VC or the pool,
+  // taken round-robin so no VC starves. Returns std::nullopt if nothing is
+  // owed.
   [[nodiscard]] std::optional<UpliCreditReturn> generate_credit_return();
 
   // Query state
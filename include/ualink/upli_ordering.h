@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_credit.h"
+#include "ualink/upli_tdm.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliOrderingManager: Address-Region Ordering for Outstanding Requests
+// =============================================================================
+//
+// UPLI orders requests only on the same port and VC. Requests to one
+// 256-byte region therefore keep their order only if they travel together:
+//
+//   - Port: a region maps to one port (region index modulo the number of
+//     ports the bifurcation mode enables).
+//   - kRelaxed: a region may have many requests in flight as long as they
+//     share a VC. A request on another VC waits until those complete.
+//   - kStrict: a region has at most one request in flight, whatever the VC.
+//
+// In-flight requests are indexed two ways, so no operation scans the
+// outstanding set:
+//   - A hash table from (region base, VC) to the number of requests in flight.
+//     It is open-addressed with room for twice the tag space, so it never
+//     allocates or fills. A conflict check probes at most kMaxVirtualChannels
+//     keys.
+//   - A table indexed by the 11-bit tag. Completion finds the request's
+//     key directly.
+//
+// Usage:
+//   UpliOrderingManager ordering(OrderingMode::kRelaxed,
+//                                BifurcationMode::kX2);
+//   const std::uint8_t port = ordering.get_required_port(address);
+//   if (ordering.can_issue_request(address, port, vc)) {
+//     ordering.track_request(address, port, vc, tag);
+//   }
+//   ...
+//   ordering.complete_request(tag);  // On RdRsp/WrRsp
+
+constexpr std::size_t kRegionAlignmentBytes = 256;
+constexpr std::size_t kUpliTagCount = 2048;  // 11-bit ReqTag
+
+enum class OrderingMode : std::uint8_t {
+  kRelaxed,  // VC-based ordering only
+  kStrict,   // Global strict ordering (auth/encryption enabled)
+};
+
+class UpliOrderingManager {
+ public:
+  explicit UpliOrderingManager(
+      OrderingMode mode, BifurcationMode bifurcation = BifurcationMode::kX4);
+
+  [[nodiscard]] OrderingMode mode() const noexcept { return mode_; }
+
+  // Port assignment for requests
+  [[nodiscard]] std::uint8_t get_required_port(std::uint64_t address) const;
+
+  // Ordering validation: true if a request may be issued now on this port
+  // and VC without overtaking, or being overtaken by, an in-flight request
+  [[nodiscard]] bool can_issue_request(std::uint64_t address,
+                                       std::uint8_t port_id,
+                                       std::uint8_t vc) const;
+
+  // Track in-flight requests. Throws std::invalid_argument for an
+  // out-of-range port, VC or tag, or for a tag that is already in flight.
+  void track_request(std::uint64_t address, std::uint8_t port_id,
+                     std::uint8_t vc, std::uint16_t tag);
+
+  // Throws std::invalid_argument if the tag is not in flight
+  void complete_request(std::uint16_t tag);
+
+  [[nodiscard]] bool is_tag_in_flight(std::uint16_t tag) const noexcept {
+    return tag < kUpliTagCount && tags_[tag].valid;
+  }
+  [[nodiscard]] std::size_t in_flight_count() const noexcept {
+    return in_flight_count_;
+  }
+
+  // Requests in flight to the region holding address, on one VC
+  [[nodiscard]] std::size_t region_in_flight(std::uint64_t address,
+                                             std::uint8_t vc) const;
+
+  // Statistics
+  struct Stats {
+    std::size_t requests_tracked{0};
+    std::size_t requests_completed{0};
+    std::size_t max_in_flight{0};
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+ private:
+  struct RegionSlot {
+    std::uint64_t key{kEmptyKey};
+    std::uint32_t count{0};
+  };
+
+  struct InFlightRequest {
+    std::uint64_t region_key{0};
+    std::uint8_t port_id{0};
+    bool valid{false};
+  };
+
+  [[nodiscard]] static std::uint64_t get_region_base(
+      std::uint64_t address) noexcept;
+  [[nodiscard]] static std::uint64_t region_key(std::uint64_t region_base,
+                                                std::uint8_t vc) noexcept;
+  [[nodiscard]] static std::size_t home_slot(std::uint64_t key) noexcept;
+  [[nodiscard]] std::size_t find_slot(std::uint64_t key) const noexcept;
+  [[nodiscard]] std::size_t key_count(std::uint64_t key) const noexcept;
+  void erase_slot(std::size_t slot) noexcept;
+
+  // Keys have the VC in bits [1:0] and zeros in bits [7:2], so all-ones is
+  // never a key
+  static constexpr std::uint64_t kEmptyKey = ~0ULL;
+  static constexpr std::size_t kRegionSlotBits = 12;
+  static constexpr std::size_t kRegionSlots = std::size_t{1} << kRegionSlotBits;
+  static_assert(kRegionSlots >= 2 * kUpliTagCount);
+
+  OrderingMode mode_;
+  std::size_t num_ports_{1};
+  std::vector<RegionSlot> region_slots_;
+  std::array<InFlightRequest, kUpliTagCount> tags_{};
+  std::size_t in_flight_count_{0};
+  Stats stats_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_credit.h"
+#include "ualink/upli_ordering.h"
+#include "ualink/upli_send_queue.h"
+#include "ualink/upli_tdm.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliOriginator: Pipelined Request Issue over the UPLI Channels
+// =============================================================================
+//
+// send_read() / send_write() allocate a tag and place the request on the
+// Request channel (and, for writes, one OrigData beat) of the port that
+// owns the address. Every in-flight request has a tag-indexed slot, so
+// completion is a direct lookup and many requests can be outstanding at
+// once. A request is issued only if:
+//
+//   - Tag:      a tag below max_outstanding_requests is free
+//   - Ordering: UpliOrderingManager allows the address on this VC now
+//   - Queue:    the port/VC's credit backlog (and, for a write, the port's
+//               OrigData queue) has room
+//
+// If any of these fails, the send returns std::nullopt and the caller
+// retries later.
+//
+// A request beat enters its port's TDM Request queue only once it holds a
+// credit for its port/VC. Until then it waits in that port/VC's backlog in
+// UpliSendQueue. That backlog drains as soon as process_credit_return()
+// brings credits back from the completer. A VC with no credits therefore
+// never blocks another VC's requests. A write reserves its OrigData slot at
+// issue, and the beat is queued when its request beat goes, so data follows
+// the requests in order on each port. Responses land in the slot reserved
+// at issue, so the response channels need no credits here.
+//
+// A transfer is 1..256 bytes, carried in up to four 64-byte data beats: a
+// write's OrigData beats follow its request beat, and a read completes when
+// its last RdRsp beat arrives. A multi-beat transfer must stay within one
+// 256-byte region, so one port carries all of it.
+//
+//   - Gather: send_write_gather() takes the write data as a list of caller
+//     buffers.
+//   - Scatter: send_read_into() copies each RdRsp beat straight into the
+//     caller's buffer as it arrives. The buffer must stay valid until the
+//     read completes.
+//
+// Usage:
+//   UpliOriginator originator(config);
+//   originator.set_request_sink([&](const UpliRequestFields& beat) { ... });
+//   originator.set_orig_data_sink([&](const UpliOrigDataFields& beat) { ... });
+//   originator.set_read_completion_callback(on_read);
+//   const auto tag = originator.send_read(dst_acc_id, address);
+//   originator.advance_cycle();               // Once per UPLI clock
+//   originator.process_rd_rsp(rd_rsp_beat);   // From the completer
+
+struct UpliOriginatorConfig {
+  std::uint16_t physical_acc_id{0};  // 10 bits: This accelerator's ID
+  BifurcationMode bifurcation{BifurcationMode::kX4};
+  OrderingMode ordering{OrderingMode::kRelaxed};
+  std::size_t max_outstanding_requests{64};  // Tags 0..N-1, N <= 2048
+  std::size_t queue_depth{kDefaultTdmQueueDepth};  // Per (port, channel)
+  PortCreditConfig request_credits{};  // Advertised by the completer, per port
+  std::size_t backlog_depth{kDefaultSendBacklogDepth};  // Per (port, VC)
+};
+
+class UpliOriginator {
+ public:
+  using RequestSink = std::function<void(const UpliRequestFields&)>;
+  using OrigDataSink = std::function<void(const UpliOrigDataFields&)>;
+  using ReadCompletionCallback =
+      std::function<void(std::uint16_t tag, RspStatus status,
+                         std::span<const std::byte> data)>;
+  using WriteCompletionCallback =
+      std::function<void(std::uint16_t tag, RspStatus status)>;
+
+  explicit UpliOriginator(const UpliOriginatorConfig& config);
+
+  // The send queue's release callback refers back to this object
+  UpliOriginator(const UpliOriginator&) = delete;
+  UpliOriginator& operator=(const UpliOriginator&) = delete;
+
+  // Request API. Returns the request's tag, or std::nullopt if it cannot be
+  // issued now. Throws std::invalid_argument on an out-of-range address,
+  // destination, VC or size, or a multi-beat transfer crossing a 256-byte
+  // region.
+  std::optional<std::uint16_t> send_read(
+      std::uint16_t dst_acc_id, std::uint64_t address, std::uint8_t vc = 0,
+      std::size_t length = kUpliDataBeatBytes);
+  std::optional<std::uint16_t> send_read_into(std::uint16_t dst_acc_id,
+                                              std::uint64_t address,
+                                              std::span<std::byte> destination,
+                                              std::uint8_t vc = 0);
+  std::optional<std::uint16_t> send_write(std::uint16_t dst_acc_id,
+                                          std::uint64_t address,
+                                          std::span<const std::byte> data,
+                                          std::uint8_t vc = 0);
+  std::optional<std::uint16_t> send_write_gather(
+      std::uint16_t dst_acc_id, std::uint64_t address,
+      std::span<const std::span<const std::byte>> segments,
+      std::uint8_t vc = 0);
+
+  // Run one TDM cycle, handing granted beats to the sinks. Returns the
+  // number of beats sent.
+  std::size_t advance_cycle();
+
+  // Response processing. A read completes on its last RdRsp beat. Throws
+  // std::invalid_argument for a tag that is not outstanding or a response on
+  // the wrong channel.
+  void process_rd_rsp(const UpliRdRspFields& beat);
+  void process_wr_rsp(const UpliWrRspFields& beat);
+  void process_credit_return(const UpliCreditReturn& credits);
+
+  // Channel connections
+  void set_request_sink(RequestSink sink) { request_sink_ = std::move(sink); }
+  void set_orig_data_sink(OrigDataSink sink) {
+    orig_data_sink_ = std::move(sink);
+  }
+  void set_read_completion_callback(ReadCompletionCallback callback) {
+    read_completion_callback_ = std::move(callback);
+  }
+  void set_write_completion_callback(WriteCompletionCallback callback) {
+    write_completion_callback_ = std::move(callback);
+  }
+
+  [[nodiscard]] std::uint64_t cycle() const noexcept {
+    return tdm_scheduler_.cycle();
+  }
+  [[nodiscard]] std::size_t outstanding() const noexcept {
+    return transactions_.size() - free_tags_.size();
+  }
+  [[nodiscard]] const UpliTdmScheduler& tdm_scheduler() const noexcept {
+    return tdm_scheduler_;
+  }
+  [[nodiscard]] const UpliSendQueue& send_queue() const noexcept {
+    return send_queue_;
+  }
+  [[nodiscard]] const UpliCreditManager& credit_manager() const noexcept {
+    return send_queue_.credit_manager();
+  }
+
+  // Statistics
+  struct Stats {
+    std::size_t requests_sent{0};
+    std::size_t orig_data_beats{0};
+    std::size_t rd_rsp_beats{0};
+    std::size_t read_completions{0};
+    std::size_t write_completions{0};
+    std::size_t error_completions{0};  // Status other than kOkay
+    std::size_t credit_stalls{0};      // Requests put in the credit backlog
+    std::size_t ordering_stalls{0};
+    std::size_t tag_stalls{0};
+    std::size_t queue_full_stalls{0};
+    std::uint64_t total_latency_cycles{0};  // Issue to completion
+    std::uint64_t max_latency_cycles{0};
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+ private:
+  struct Transaction {
+    std::uint64_t address{0};
+    std::uint64_t issue_cycle{0};
+    std::uint16_t dst_acc_id{0};
+    std::uint8_t vc{0};
+    std::uint8_t len{0};
+    std::uint8_t beats{1};
+    std::uint8_t beats_received{0};  // RdRsp beats so far
+    std::uint8_t status{0};          // First status other than kOkay
+    bool write{false};
+    bool request_sent{false};
+    std::span<std::byte> destination{};  // send_read_into() buffer
+    std::array<std::byte, kUpliMaxTransferBytes> data{};  // Write/read data
+  };
+
+  [[nodiscard]] std::optional<std::uint16_t> issue(std::uint16_t dst_acc_id,
+                                                   std::uint64_t address,
+                                                   std::uint8_t vc,
+                                                   std::size_t length,
+                                                   bool write);
+  [[nodiscard]] Transaction& outstanding(std::uint16_t tag, bool write);
+  void on_grant(std::uint8_t port_id, UpliChannel channel,
+                const UpliTdmBeat& beat);
+  void retire(std::uint16_t tag, bool write);
+
+  UpliOriginatorConfig config_;
+
+  // Sub-components
+  UpliTdmScheduler tdm_scheduler_;
+  UpliOrderingManager ordering_manager_;
+  UpliSendQueue send_queue_;
+
+  // OrigData slots held by writes whose request beat has not gone yet
+  std::array<std::size_t, kMaxPorts> reserved_data_beats_{};
+
+  // Tag-indexed in-flight state; a tag is free iff it is on free_tags_
+  std::vector<Transaction> transactions_;
+  std::vector<std::uint16_t> free_tags_;
+  std::vector<bool> tag_active_;
+
+  // Channel connections
+  RequestSink request_sink_;
+  OrigDataSink orig_data_sink_;
+  ReadCompletionCallback read_completion_callback_;
+  WriteCompletionCallback write_completion_callback_;
+
+  Stats stats_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_credit.h"
+#include "ualink/upli_tdm.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliSendQueue: Credit-Gated Per-(Port, VC) Request Backlog
+// =============================================================================
+//
+// Holds send-side request credits (a UpliCreditManager) and a bounded FIFO
+// backlog for each (port, VC). submit() releases a beat at once if its
+// port/VC has a credit and nothing is queued ahead of it. Otherwise the beat
+// waits in the backlog. Backlogs drain in FIFO order whenever credits arrive
+// (process_credit_return / return_credits) and on every advance_cycle().
+//
+// A beat is released through the release callback, which may refuse it
+// (e.g. a full TDM queue). A refused beat stays at the head of its backlog
+// and keeps no credit. A credit is taken only when a beat is accepted.
+//
+// Because each VC has its own backlog, a VC that is out of credits does not
+// hold up the others. The cycles each backlogged beat waited are recorded
+// in a per-(port, VC) log2 histogram.
+//
+// Usage:
+//   UpliSendQueue send_queue(backlog_depth);
+//   send_queue.configure_port(0, credit_config);
+//   send_queue.initialize_credits();
+//   send_queue.set_release_callback(
+//       [&](std::uint8_t port, const UpliTdmBeat& beat) {
+//         return scheduler.enqueue(port, UpliChannel::kRequest, beat);
+//       });
+//   if (!send_queue.submit(port, {.tag = tag, .vc = vc})) { /* full */ }
+//   send_queue.process_credit_return(credit_return);  // Drains backlogs
+//   send_queue.advance_cycle();                       // Once per UPLI clock
+
+constexpr std::size_t kDefaultSendBacklogDepth = 64;
+
+// Bucket 0 counts waits of 0 cycles; bucket b counts [2^(b-1), 2^b) cycles.
+// The last bucket also takes every longer wait.
+constexpr std::size_t kBlockedHistogramBuckets = 16;
+
+class UpliSendQueue {
+ public:
+  // Returns true if it took the beat. Called with the credit still unconsumed.
+  using ReleaseCallback =
+      std::function<bool(std::uint8_t port_id, const UpliTdmBeat& beat)>;
+
+  // backlog_depth is per (port, VC). Throws std::invalid_argument if 0.
+  explicit UpliSendQueue(std::size_t backlog_depth = kDefaultSendBacklogDepth);
+
+  // Credit setup, as UpliCreditManager
+  void configure_port(std::uint8_t port_id, const PortCreditConfig& config);
+  void initialize_credits();
+
+  void set_release_callback(ReleaseCallback callback) {
+    release_ = std::move(callback);
+  }
+
+  // Release the beat now, or queue it behind its port/VC's backlog. Returns
+  // false if the backlog is full. Throws std::invalid_argument for an
+  // out-of-range port or VC.
+  [[nodiscard]] bool submit(std::uint8_t port_id, const UpliTdmBeat& beat);
+
+  // Credit arrival; each drains the backlogs it can
+  void process_credit_return(const UpliCreditReturn& credits);
+  void return_credits(std::uint8_t port_id, std::uint8_t vc,
+                      std::size_t count);
+
+  // Retry refused beats, then advance the clock blocked time is measured in
+  void advance_cycle();
+
+  [[nodiscard]] std::uint64_t cycle() const noexcept { return cycle_; }
+  [[nodiscard]] std::size_t backlog_size(std::uint8_t port_id,
+                                         std::uint8_t vc) const;
+  [[nodiscard]] std::size_t backlog_depth() const noexcept {
+    return backlog_depth_;
+  }
+  [[nodiscard]] const UpliCreditManager& credit_manager() const noexcept {
+    return credit_manager_;
+  }
+
+  // Statistics, per (port, VC)
+  struct BacklogStats {
+    std::size_t submitted{0};
+    std::size_t released_immediately{0};
+    std::size_t backlogged{0};  // Had to wait
+    std::size_t rejected{0};    // Backlog full
+    std::size_t max_backlog_size{0};
+    std::uint64_t total_blocked_cycles{0};
+    std::uint64_t max_blocked_cycles{0};
+    std::array<std::size_t, kBlockedHistogramBuckets> blocked_histogram{};
+  };
+  [[nodiscard]] const BacklogStats& get_stats(std::uint8_t port_id,
+                                              std::uint8_t vc) const;
+  void reset_stats() noexcept;
+
+ private:
+  struct BackloggedBeat {
+    UpliTdmBeat beat{};
+    std::uint64_t enqueue_cycle{0};
+  };
+
+  // Fixed-capacity FIFO for one (port, VC)
+  struct Backlog {
+    std::vector<BackloggedBeat> ring;
+    std::size_t head{0};
+    std::size_t count{0};
+  };
+
+  [[nodiscard]] std::size_t backlog_index(std::uint8_t port_id,
+                                          std::uint8_t vc) const;
+  [[nodiscard]] bool try_release(std::uint8_t port_id,
+                                 const UpliTdmBeat& beat);
+  void drain();
+
+  std::size_t backlog_depth_;
+  std::uint64_t cycle_{0};
+  std::size_t backlogged_{0};  // Beats waiting over all backlogs
+  UpliCreditManager credit_manager_;
+  std::array<Backlog, kMaxPorts * kMaxVirtualChannels> backlogs_{};
+  std::array<BacklogStats, kMaxPorts * kMaxVirtualChannels> stats_{};
+  ReleaseCallback release_;
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
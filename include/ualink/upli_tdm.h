@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliTdmScheduler: Cycle-Driven TDM Arbitration of the UPLI Channels
+// =============================================================================
+//
+// The bifurcation mode sets how many ports share one UPLI interface. Each
+// cycle, every channel (Request, OrigData, RdRsp, WrRsp) carries at most one
+// beat. The beat comes from the port that owns the cycle's TDM slot:
+//
+//   kX4: port 0 owns every cycle            (1 port,  full bandwidth)
+//   kX2: ports 0,1 alternate                (2 ports, 1/2 each)
+//   kX1: ports 0,1,2,3 in turn              (4 ports, 1/4 each)
+//
+// Slots are strict. A slot whose owner has nothing to send is idle, even if
+// other ports are backlogged. Each (port, channel) pair is a FIFO. If the head
+// beat is not ready (the ready predicate returns false, e.g. no credit), the
+// slot is lost. Every beat queued behind it is head-of-line blocked.
+//
+// Usage:
+//   UpliTdmScheduler scheduler(BifurcationMode::kX2);
+//   scheduler.set_ready_predicate([&](std::uint8_t port, UpliChannel channel,
+//                                     const UpliTdmBeat& beat) {
+//     return credits.has_credit(port, beat.vc);
+//   });
+//   scheduler.enqueue(1, UpliChannel::kRequest, {.tag = 7, .vc = 0});
+//   scheduler.advance_cycle([&](std::uint8_t port, UpliChannel channel,
+//                               const UpliTdmBeat& beat) { /* drive beat */ });
+
+enum class BifurcationMode : std::uint8_t {
+  kX4,  // One x4 link (1 port)
+  kX2,  // Two x2 links (2 ports)
+  kX1,  // Four x1 links (4 ports)
+};
+
+enum class UpliChannel : std::uint8_t {
+  kRequest = 0,
+  kOrigData = 1,
+  kRdRsp = 2,
+  kWrRsp = 3,
+};
+
+constexpr std::size_t kUpliChannelCount = 4;
+constexpr std::size_t kDefaultTdmQueueDepth = 64;
+
+// Number of ports a bifurcation mode splits the interface into
+[[nodiscard]] constexpr std::size_t bifurcation_port_count(
+    BifurcationMode mode) noexcept {
+  if (mode == BifurcationMode::kX2) {
+    return 2;
+  }
+  if (mode == BifurcationMode::kX1) {
+    return 4;
+  }
+  return 1;
+}
+
+// One queued channel beat; the scheduler only looks at it through the
+// ready predicate
+struct UpliTdmBeat {
+  std::uint16_t tag{0};
+  std::uint8_t vc{0};
+  std::uint8_t beat{0};  // Data beat within a multi-beat transfer
+};
+
+class UpliTdmScheduler {
+ public:
+  using ReadyPredicate = std::function<bool(
+      std::uint8_t port_id, UpliChannel channel, const UpliTdmBeat& beat)>;
+  using GrantCallback = std::function<void(
+      std::uint8_t port_id, UpliChannel channel, const UpliTdmBeat& beat)>;
+
+  explicit UpliTdmScheduler(BifurcationMode mode,
+                            std::size_t queue_depth = kDefaultTdmQueueDepth);
+
+  // TDM cycle management
+  [[nodiscard]] BifurcationMode mode() const noexcept { return mode_; }
+  [[nodiscard]] std::uint64_t cycle() const noexcept { return cycle_; }
+  [[nodiscard]] std::uint8_t current_port_id() const noexcept;
+  [[nodiscard]] std::size_t num_active_ports() const noexcept {
+    return num_ports_;
+  }
+
+  // Port availability
+  [[nodiscard]] bool is_port_active(std::uint8_t port_id) const noexcept {
+    return port_id < num_ports_;
+  }
+  [[nodiscard]] bool can_transmit_on_port(std::uint8_t port_id) const noexcept {
+    return port_id == current_port_id();
+  }
+
+  // Queue a beat on a port's channel. Returns false if that queue is full.
+  // Throws std::invalid_argument for a port the mode does not enable.
+  [[nodiscard]] bool enqueue(std::uint8_t port_id, UpliChannel channel,
+                             const UpliTdmBeat& beat);
+
+  [[nodiscard]] std::size_t queue_size(std::uint8_t port_id,
+                                       UpliChannel channel) const;
+
+  // Gate for head beats (default: always ready)
+  void set_ready_predicate(ReadyPredicate predicate) {
+    ready_ = std::move(predicate);
+  }
+
+  // Run one cycle: for each channel, grant the slot owner's head beat if it
+  // is ready, then move to the next slot. Returns the number of beats granted.
+  std::size_t advance_cycle(const GrantCallback& on_grant = {});
+
+  // Statistics, per (port, channel)
+  struct ChannelStats {
+    std::size_t beats_sent{0};
+    std::size_t slots_owned{0};
+    std::size_t idle_slots{0};         // Owned slot, nothing queued
+    std::size_t blocked_slots{0};      // Owned slot, head beat not ready
+    std::size_t hol_blocked_beats{0};  // Beat-cycles behind a blocked head
+    std::size_t enqueue_rejected{0};   // Queue full
+    std::size_t max_queue_size{0};
+  };
+  [[nodiscard]] const ChannelStats& get_stats(std::uint8_t port_id,
+                                              UpliChannel channel) const;
+
+  // Beats sent by a port over all channels, per elapsed cycle
+  [[nodiscard]] double port_throughput(std::uint8_t port_id) const;
+
+  void reset_stats() noexcept;
+
+ private:
+  // Fixed-capacity FIFO of beats for one (port, channel)
+  struct BeatQueue {
+    std::vector<UpliTdmBeat> ring;
+    std::size_t head{0};
+    std::size_t count{0};
+  };
+
+  [[nodiscard]] std::size_t queue_index(std::uint8_t port_id,
+                                        UpliChannel channel) const;
+
+  BifurcationMode mode_;
+  std::size_t num_ports_{1};
+  std::uint64_t cycle_{0};
+  std::uint64_t stats_start_cycle_{0};
+  std::array<BeatQueue, kMaxPorts * kUpliChannelCount> queues_{};
+  std::array<ChannelStats, kMaxPorts * kUpliChannelCount> stats_{};
+  ReadyPredicate ready_;
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ualink/dl_flit.h"
+#include "ualink/dl_tx_pipeline.h"
+#include "ualink/tl_field_packer.h"
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_ordering.h"
+#include "ualink/upli_tdm.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliTlBridge: UPLI Channel Beats to and from TL Flits
+// =============================================================================
+//
+// Each endpoint has one bridge between its UPLI interface and its
+// UaLinkEndpoint. The bridge turns the originator's Request/OrigData beats
+// and the completer's RdRsp/WrRsp beats into the TL flit stream, and turns
+// received TL flits back into beats:
+//
+//   originator, completer <-> UpliTlBridge <-> UaLinkEndpoint <-> wire
+//
+// Transmit:
+//   - Request and response control fields go through a TlFieldPacker, so
+//     they are compressed when they qualify and share TL flits.
+//   - Each data beat (OrigData, read data) is one 64-byte TL data flit. The
+//     data flits for a control flit's fields follow that control flit
+//     directly, in field order. That is all the framing the receiver needs.
+//   - A write's Request beat is held until its last OrigData beat arrives,
+//     so the field and its data flits always travel together. Data beats
+//     pair with writes in order per port, as at the completer.
+//   - Each RdRsp beat is its own response field (OFFSET = beat, LAST on the
+//     final beat) followed by its data flit, so read data streams without
+//     waiting for the whole transfer.
+//   - TL flits go to the TL flit sink kMaxTlFlitsPerDlFlit at a time, one DL
+//     flit's worth. flush() closes the open control flit and sends a short
+//     batch. The waiting data is a fixed array and the TL flits queue in a
+//     reused buffer, so no vector is built per beat or per flit.
+//   - The sink returns how many flits it took, from the front. The rest stay
+//     queued, in order, and nothing more goes to the sink until the next
+//     flush() retries them. The receiver frames data flits by position, so
+//     the stream must reach it without gaps.
+//
+// Receive: receive_tl_flit() decodes control flits field by field. A field
+// with data is delivered once its data flit arrives.
+//
+// Tags: TL carries the 11-bit UPLI tag unchanged, but no UPLI port.
+//   - Requests sent: the bridge records each tag's port and restores it into
+//     the response beat.
+//   - Requests received: the port is the owner of the address's 256-byte
+//     region under this side's bifurcation, as UpliOrderingManager assigns
+//     it. The bridge records the source accelerator and VC per (port, tag)
+//     to address the response.
+//
+// TL control fields do not carry req_auth_tag, response attr/auth_tag, the
+// data error bits, or byte address bits [1:0] (TL addresses doublewords).
+//
+// Usage:
+//   UpliTlBridge bridge(config);
+//   bridge.set_tl_flit_sink([&](std::span<const dl::TlFlit> flits) {
+//     return endpoint.send_tl_flits(flits);
+//   });
+//   endpoint.set_tl_flit_callback(
+//       [&](const dl::TlFlit& flit) { bridge.receive_tl_flit(flit); });
+//   originator.set_request_sink(
+//       [&](const UpliRequestFields& beat) { bridge.send_request(beat); });
+//   bridge.set_request_sink([&](const UpliRequestFields& beat) {
+//     completer.process_request(beat);
+//   });
+//   bridge.flush();  // End of each UPLI cycle, or when latency matters
+
+struct UpliTlBridgeConfig {
+  std::uint16_t physical_acc_id{0};  // 10 bits: SRCACCID of responses sent
+  BifurcationMode bifurcation{BifurcationMode::kX4};  // For requests received
+};
+
+class UpliTlBridge {
+ public:
+  // Returns the number of flits taken, from the front of the span
+  using TlFlitSink = std::function<std::size_t(std::span<const dl::TlFlit>)>;
+  using RequestSink = std::function<void(const UpliRequestFields&)>;
+  using OrigDataSink = std::function<void(const UpliOrigDataFields&)>;
+  using RdRspSink = std::function<void(const UpliRdRspFields&)>;
+  using WrRspSink = std::function<void(const UpliWrRspFields&)>;
+
+  explicit UpliTlBridge(const UpliTlBridgeConfig& config);
+
+  // The packer's flit sink refers back to this object
+  UpliTlBridge(const UpliTlBridge&) = delete;
+  UpliTlBridge& operator=(const UpliTlBridge&) = delete;
+
+  // Transmit. Throws std::invalid_argument for a tag already outstanding,
+  // OrigData with no write waiting for it, a response to a request never
+  // received, or a field out of range for its TL format.
+  void send_request(const UpliRequestFields& beat);
+  void send_orig_data(const UpliOrigDataFields& beat);
+  void send_rd_rsp(const UpliRdRspFields& beat);
+  void send_wr_rsp(const UpliWrRspFields& beat);
+
+  // Close the open control flit and send the TL flits queued so far,
+  // including any the sink refused before
+  void flush();
+
+  // Receive one TL flit, in link order. Throws std::invalid_argument for a
+  // malformed control flit, a request whose (port, tag) is already
+  // outstanding, or a response to a tag this side never sent.
+  void receive_tl_flit(const dl::TlFlit& tl_flit);
+
+  // Connections
+  void set_tl_flit_sink(TlFlitSink sink) { tl_flit_sink_ = std::move(sink); }
+  void set_request_sink(RequestSink sink) { request_sink_ = std::move(sink); }
+  void set_orig_data_sink(OrigDataSink sink) {
+    orig_data_sink_ = std::move(sink);
+  }
+  void set_rd_rsp_sink(RdRspSink sink) { rd_rsp_sink_ = std::move(sink); }
+  void set_wr_rsp_sink(WrRspSink sink) { wr_rsp_sink_ = std::move(sink); }
+
+  // Statistics
+  struct Stats {
+    std::size_t requests_sent{0};
+    std::size_t responses_sent{0};
+    std::size_t requests_received{0};
+    std::size_t responses_received{0};
+    std::size_t control_flits_sent{0};
+    std::size_t data_flits_sent{0};
+    std::size_t batches_sent{0};        // TL flit sink calls
+    std::size_t short_batches_sent{0};  // Flushed before kMaxTlFlitsPerDlFlit
+    std::size_t sink_stalls{0};         // Sink took less than a whole batch
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  [[nodiscard]] tl::TlFieldPacker::Stats packer_stats() const noexcept {
+    return packer_.get_stats();
+  }
+  // TL flits built but not yet taken by the sink
+  [[nodiscard]] std::size_t queued_tl_flits() const noexcept {
+    return queued_.size() - queued_head_;
+  }
+  void reset_stats() noexcept;
+
+ private:
+  using FlitBytes = std::array<std::byte, tl::kTlFlitBytes>;
+
+  // Every data flit a full control flit's fields could carry
+  static constexpr std::size_t kMaxDataFlitsPerControlFlit =
+      tl::kTlSectorsPerFlit * kUpliMaxDataBeats;
+
+  // Request received, awaiting its response
+  struct ReceivedRequest {
+    bool active{false};
+    std::uint8_t vc{0};
+    std::uint16_t src_acc_id{0};
+    std::uint8_t beats{1};       // RdRsp beats owed
+    std::uint8_t beats_sent{0};  // RdRsp beats sent so far
+  };
+
+  // Field from the current control flit whose data flits are still to come
+  struct ExpectedData {
+    bool write{false};  // OrigData for a write request, else read data
+    std::uint8_t port_id{0};
+    std::uint8_t beats{1};  // Data flits still to come
+    UpliRdRspFields read_response{};
+  };
+
+  // Write tags in arrival order, per port, waiting for their OrigData beat
+  struct TagFifo {
+    std::vector<std::uint16_t> ring;
+    std::size_t head{0};
+    std::size_t count{0};
+  };
+
+  void push_field(const tl::TlControlField& field,
+                  std::span<const std::byte> data);
+  void emit(std::span<const std::byte, tl::kTlFlitBytes> bytes);
+  void emit_closed_flit();
+  void send_batches(bool include_short);
+  void on_field(const tl::TlControlField& field);
+  [[nodiscard]] std::uint8_t sent_port(std::uint16_t tag) const;
+  [[nodiscard]] ReceivedRequest& received(std::uint8_t port_id,
+                                          std::uint16_t tag);
+
+  UpliTlBridgeConfig config_;
+  tl::TlFieldPacker packer_;
+  tl::TlFieldUnpacker unpacker_;
+
+  // Transmit: a control flit the packer just closed, the data for the
+  // fields of the open control flit, and the TL flits not yet taken by the
+  // sink (from queued_head_; emptied, not freed, once all are taken)
+  FlitBytes closed_flit_{};
+  bool closed_{false};
+  std::array<FlitBytes, kMaxDataFlitsPerControlFlit> open_data_{};
+  std::size_t open_data_count_{0};
+  std::vector<dl::TlFlit> queued_;
+  std::size_t queued_head_{0};
+  bool sink_stalled_{false};  // Hold everything until the next flush()
+
+  // Transmit: writes waiting for data (tag-indexed), the data gathered so
+  // far for the oldest write on each port, and the port of every request
+  // sent
+  std::vector<UpliRequestFields> held_writes_;
+  std::array<TagFifo, kMaxPorts> awaiting_data_{};
+  std::array<std::array<std::byte, kUpliMaxTransferBytes>, kMaxPorts>
+      write_data_{};
+  std::array<std::size_t, kMaxPorts> write_beats_{};
+  std::vector<std::uint8_t> sent_port_;
+  std::vector<bool> sent_active_;
+
+  // Receive
+  std::vector<ReceivedRequest> received_;  // (port, tag)-indexed
+  std::array<ExpectedData, tl::kTlSectorsPerFlit> expected_{};
+  std::size_t expected_count_{0};
+  std::size_t expected_next_{0};
+
+  // Connections
+  TlFlitSink tl_flit_sink_;
+  RequestSink request_sink_;
+  OrigDataSink orig_data_sink_;
+  RdRspSink rd_rsp_sink_;
+  WrRspSink wr_rsp_sink_;
+
+  Stats stats_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
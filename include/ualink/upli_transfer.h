@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ualink/trace.h"
+#include "ualink/upli_channel.h"
+#include "ualink/upli_originator.h"
+
+namespace ualink::upli {
+
+// =============================================================================
+// UpliTransferEngine: Multi-KB Reads and Writes over UpliOriginator
+// =============================================================================
+//
+// read() / write() take a buffer of any size and split it into the largest
+// legal UPLI transactions: up to 256 bytes each, never crossing a 256-byte
+// region. A start or end off a region boundary only shortens the first or
+// last chunk. Addresses and sizes are whole doublewords, as TL carries them.
+// The engine owns its UpliOriginator and issues chunks through it until a
+// tag, ordering, queue or credit limit pushes back. It resumes on every
+// advance_cycle(), so a transfer stays pipelined up to those limits.
+//
+// Transfers issue in submission order. Each chunk's tag maps back to its
+// transfer, and the transfer completes once every chunk has been issued
+// and answered. Then one completion record is handed to the callback, with
+// the first error status any chunk returned.
+//
+//   - Reads land straight in the caller's buffer, one RdRsp beat at a time.
+//   - Writes copy each chunk out of the caller's buffer when it is issued.
+//
+// Either buffer must stay valid until its transfer completes.
+//
+// The engine takes over the originator's completion callbacks. Everything
+// else (sinks, responses, credit returns) is wired through originator().
+//
+// Usage:
+//   UpliTransferEngine engine(UpliTransferEngineConfig{.originator = config});
+//   engine.originator().set_request_sink(...);
+//   engine.originator().set_orig_data_sink(...);
+//   engine.set_completion_callback(
+//       [&](const UpliTransferCompletion& completion) { ... });
+//   const auto id = engine.read(dst_acc_id, address, buffer);  // e.g. 64 KiB
+//   engine.advance_cycle();                        // Once per UPLI clock
+//   engine.originator().process_rd_rsp(rd_rsp);    // From the completer
+
+struct UpliTransferEngineConfig {
+  UpliOriginatorConfig originator{};
+  std::size_t max_transfers{16};  // Transfers in flight at once
+};
+
+// One finished transfer, as handed to the completion callback
+struct UpliTransferCompletion {
+  std::uint64_t id{0};
+  bool write{false};
+  RspStatus status{RspStatus::kOkay};  // First status other than kOkay
+  std::uint64_t address{0};
+  std::size_t bytes{0};
+  std::size_t transactions{0};
+  std::uint64_t submit_cycle{0};
+  std::uint64_t complete_cycle{0};
+};
+
+class UpliTransferEngine {
+ public:
+  using CompletionCallback =
+      std::function<void(const UpliTransferCompletion& completion)>;
+
+  // Throws std::invalid_argument if max_transfers is 0, or if queue_depth
+  // cannot hold one full write's data beats.
+  explicit UpliTransferEngine(const UpliTransferEngineConfig& config);
+
+  // The originator's completion callbacks refer back to this object
+  UpliTransferEngine(const UpliTransferEngine&) = delete;
+  UpliTransferEngine& operator=(const UpliTransferEngine&) = delete;
+
+  // Transfer API. Returns the transfer's ID, or std::nullopt if max_transfers
+  // are already in flight. Issues as many chunks as it can at once. Throws
+  // std::invalid_argument for an empty buffer, an address or size that is
+  // not a multiple of 4 bytes, a range past the 57-bit address space, or an
+  // out-of-range destination or VC.
+  std::optional<std::uint64_t> read(std::uint16_t dst_acc_id,
+                                    std::uint64_t address,
+                                    std::span<std::byte> destination,
+                                    std::uint8_t vc = 0);
+  std::optional<std::uint64_t> write(std::uint16_t dst_acc_id,
+                                     std::uint64_t address,
+                                     std::span<const std::byte> data,
+                                     std::uint8_t vc = 0);
+
+  // Issue waiting chunks, then run one originator cycle. Returns the number
+  // of beats the originator sent.
+  std::size_t advance_cycle();
+
+  void set_completion_callback(CompletionCallback callback) {
+    completion_callback_ = std::move(callback);
+  }
+
+  [[nodiscard]] UpliOriginator& originator() noexcept { return originator_; }
+  [[nodiscard]] const UpliOriginator& originator() const noexcept {
+    return originator_;
+  }
+  [[nodiscard]] std::size_t active() const noexcept {
+    return transfers_.size() - free_slots_.size();
+  }
+
+  // Statistics
+  struct Stats {
+    std::size_t transfers_submitted{0};
+    std::size_t transfers_completed{0};
+    std::size_t error_transfers{0};       // Status other than kOkay
+    std::size_t transactions_issued{0};
+    std::size_t issue_stalls{0};          // Originator refused a chunk
+    std::size_t transfer_full_stalls{0};  // No transfer slot free
+    std::size_t max_active{0};
+    std::uint64_t bytes_read{0};
+    std::uint64_t bytes_written{0};
+  };
+  [[nodiscard]] Stats get_stats() const noexcept { return stats_; }
+  void reset_stats() noexcept { stats_ = Stats{}; }
+
+ private:
+  static constexpr std::size_t kNoTransfer = static_cast<std::size_t>(-1);
+
+  struct Transfer {
+    std::uint64_t id{0};
+    bool write{false};
+    std::uint16_t dst_acc_id{0};
+    std::uint8_t vc{0};
+    std::uint8_t status{0};  // First status other than kOkay
+    std::uint64_t address{0};
+    std::size_t bytes{0};
+    std::span<std::byte> destination{};
+    std::span<const std::byte> data{};
+    std::size_t issued_bytes{0};
+    std::size_t transactions{0};
+    std::size_t outstanding{0};  // Chunks issued and not yet answered
+    std::uint64_t submit_cycle{0};
+  };
+
+  [[nodiscard]] std::optional<std::uint64_t> submit(Transfer transfer);
+  void pump();
+  void on_complete(std::uint16_t tag, RspStatus status);
+  void finish(std::size_t slot);
+
+  UpliTransferEngineConfig config_;
+  UpliOriginator originator_;
+
+  // Slot-indexed transfers; a slot is free iff it is on free_slots_
+  std::vector<Transfer> transfers_;
+  std::vector<std::size_t> free_slots_;
+
+  // Slots with chunks still to issue, in submission order (a ring)
+  std::vector<std::size_t> issue_ring_;
+  std::size_t issue_head_{0};
+  std::size_t issue_count_{0};
+
+  // Tag-indexed transfer slot of every chunk in flight
+  std::vector<std::size_t> tag_transfer_;
+
+  std::uint64_t next_id_{0};
+  CompletionCallback completion_callback_;
+
+  Stats stats_{};
+};
+
+}  // namespace ualink::upli
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "ualink/dl_channel_model.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace ualink::dl;
+
+// Wire image byte offsets (see DlFlit)
+constexpr std::size_t kSegmentHeadersOffset = 3;
+constexpr std::size_t kPayloadOffset = kSegmentHeadersOffset + kDlSegmentCount;
+constexpr std::size_t kCrcOffset = kPayloadOffset + kDlPayloadBytes;
+
+static std::byte &wire_byte(DlFlit &flit, std::size_t byte_index) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (byte_index < kSegmentHeadersOffset) {
+    return flit.flit_header[byte_index];
+  }
+  if (byte_index < kPayloadOffset) {
+    return flit.segment_headers[byte_index - kSegmentHeadersOffset];
+  }
+  if (byte_index < kCrcOffset) {
+    return flit.payload[byte_index - kPayloadOffset];
+  }
+  return flit.crc[byte_index - kCrcOffset];
+}
+
+static std::uint64_t saturating_add(std::uint64_t lhs, std::uint64_t rhs) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  if (rhs > std::numeric_limits<std::uint64_t>::max() - lhs) {
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+  return lhs + rhs;
+}
+
+void ualink::dl::flip_wire_bit(DlFlit &flit, std::size_t bit_index) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (bit_index >= kDlFlitBits) {
+    throw std::out_of_range("flip_wire_bit: bit_index beyond 640-byte flit");
+  }
+
+  std::byte &target = wire_byte(flit, bit_index / 8);
+  target ^= std::byte{static_cast<unsigned char>(0x80U >> (bit_index % 8))};
+}
+
+DlBitErrorChannel::DlBitErrorChannel(const BitErrorChannelConfig &config) : config_(config), rng_(config.seed) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (config_.bit_error_rate < 0.0 || config_.bit_error_rate > 1.0) {
+    throw std::invalid_argument("DlBitErrorChannel: bit_error_rate must be in [0, 1]");
+  }
+  if (config_.mean_burst_length < 1.0) {
+    throw std::invalid_argument("DlBitErrorChannel: mean_burst_length must be >= 1");
+  }
+
+  bits_until_error_ = ualink::sample_geometric_gap(rng_, config_.bit_error_rate);
+}
+
+void DlBitErrorChannel::reseed(std::uint64_t seed) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  rng_.reseed(seed);
+  bits_until_error_ = ualink::sample_geometric_gap(rng_, config_.bit_error_rate);
+}
+
+void DlBitErrorChannel::reset_stats() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  stats_ = Stats{};
+}
+
+std::size_t DlBitErrorChannel::corrupt_flit(DlFlit &flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // bits_until_error_ < kDlFlitBits here: at least one event starts in this flit
+  std::uint64_t position = bits_until_error_;
+  std::size_t bits_flipped = 0;
+
+  while (position < kDlFlitBits) {
+    const std::size_t start_bit = static_cast<std::size_t>(position);
+    const std::size_t burst_length = std::min(sample_burst_length(), kDlFlitBits - start_bit);
+    bits_flipped += apply_burst(flit, start_bit, burst_length);
+    stats_.error_events++;
+
+    const std::uint64_t gap = ualink::sample_geometric_gap(rng_, config_.bit_error_rate);
+    position = saturating_add(position + burst_length, gap);
+  }
+
+  bits_until_error_ = position - kDlFlitBits;
+
+  stats_.bits_flipped += bits_flipped;
+  if (bits_flipped > 0) {
+    stats_.flits_corrupted++;
+  }
+  return bits_flipped;
+}
+
+std::size_t DlBitErrorChannel::apply_burst(DlFlit &flit, std::size_t start_bit, std::size_t burst_length) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::size_t bits_flipped = 0;
+  for (std::size_t burst_offset = 0; burst_offset < burst_length; ++burst_offset) {
+    const bool edge_bit = (burst_offset == 0) || (burst_offset + 1 == burst_length);
+    if (edge_bit || rng_.next_double() < config_.burst_bit_flip_probability) {
+      flip_wire_bit(flit, start_bit + burst_offset);
+      bits_flipped++;
+    }
+  }
+  return bits_flipped;
+}
+
+std::size_t DlBitErrorChannel::sample_burst_length() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (config_.mean_burst_length <= 1.0) {
+    return 1;
+  }
+
+  // Geometric on {1, 2, ...} with mean mean_burst_length
+  const std::uint64_t extra = ualink::sample_geometric_gap(rng_, 1.0 / config_.mean_burst_length);
+  return static_cast<std::size_t>(std::min<std::uint64_t>(extra, kDlFlitBits) + 1);
+}
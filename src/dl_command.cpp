@@ -174,36 +174,129 @@ DlAckNakManager::DlAckNakManager() { UALINK_TRACE_SCOPED(__func__); }
 std::optional<DlFlit> DlAckNakManager::process_received_flit(std::uint16_t received_seq, std::uint8_t our_tx_seq_lo) {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Check if this is the expected sequence number
+  stats_.flits_received++;
+
   if (rx_seq_tracker_.is_expected(received_seq)) {
-    // Expected - advance tracker
-    rx_seq_tracker_.advance();
-    flits_since_ack_++;
-
-    // Check if we should send ACK
-    if (ack_every_n_ == 0) {
-      // ACK immediately
-      flits_since_ack_ = 0;
-      return CommandFactory::create_ack(received_seq, our_tx_seq_lo);
-    } else if (flits_since_ack_ >= ack_every_n_) {
-      // ACK after N flits
-      flits_since_ack_ = 0;
-      return CommandFactory::create_ack(received_seq, our_tx_seq_lo);
-    } else {
-      // Don't ACK yet
-      return std::nullopt;
+    return handle_expected(received_seq, our_tx_seq_lo);
+  }
+
+  if (rx_seq_tracker_.is_duplicate(received_seq)) {
+    return handle_duplicate(our_tx_seq_lo);
+  }
+
+  return handle_out_of_order(our_tx_seq_lo);
+}
+
+std::optional<DlFlit> DlAckNakManager::tick(std::uint8_t our_tx_seq_lo) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!replay_outstanding_) {
+    return std::nullopt;
+  }
+
+  flits_since_replay_request_++;
+  if (replay_retry_expired()) {
+    stats_.replay_request_retries++;
+    return send_replay_request(our_tx_seq_lo);
+  }
+
+  return std::nullopt;
+}
+
+std::optional<DlFlit> DlAckNakManager::handle_expected(std::uint16_t received_seq, std::uint8_t our_tx_seq_lo) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Expected - advance tracker. This also fills any outstanding gap.
+  rx_seq_tracker_.advance();
+  flit_accepted_ = true;
+  stats_.flits_accepted++;
+  flits_since_ack_++;
+  replay_outstanding_ = false;
+  flits_since_replay_request_ = 0;
+  last_reack_seq_ = 0;
+
+  // ACK immediately (N = 0) or after N flits
+  if (ack_every_n_ == 0 || flits_since_ack_ >= ack_every_n_) {
+    flits_since_ack_ = 0;
+    stats_.acks_sent++;
+    return CommandFactory::create_ack(received_seq, our_tx_seq_lo);
+  }
+
+  // Don't ACK yet
+  return std::nullopt;
+}
+
+std::optional<DlFlit> DlAckNakManager::handle_duplicate(std::uint8_t our_tx_seq_lo) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  stats_.duplicates_received++;
+
+  // A duplicate still counts as a flit time for an outstanding replay
+  if (replay_outstanding_) {
+    flits_since_replay_request_++;
+    if (replay_retry_expired()) {
+      stats_.replay_request_retries++;
+      return send_replay_request(our_tx_seq_lo);
     }
+  }
 
-  } else if (rx_seq_tracker_.is_duplicate(received_seq)) {
-    // Duplicate - ignore, but might want to re-ACK
-    // For now, just ignore
+  // Re-ACK the last in-order flit: the sender is replaying because our ACK was
+  // lost or late. Only once per ACK value so a long replay tail does not turn
+  // into an ACK storm. Nothing to re-ACK before the first in-order flit.
+  if (!flit_accepted_) {
     return std::nullopt;
+  }
 
-  } else {
-    // Out of order - request replay from the expected sequence
-    const std::uint16_t expected = rx_seq_tracker_.expected_seq();
-    return CommandFactory::create_replay_request(expected, our_tx_seq_lo);
+  // Sequence numbers run 1..511, so the flit before 1 is 511
+  const std::uint16_t expected_seq = rx_seq_tracker_.expected_seq();
+  std::uint16_t last_good_seq = expected_seq - 1U;
+  if (expected_seq <= 1) {
+    last_good_seq = kSequenceModulo - 1U;
   }
+  if (last_good_seq == last_reack_seq_) {
+    return std::nullopt;
+  }
+
+  last_reack_seq_ = last_good_seq;
+  flits_since_ack_ = 0;
+  stats_.reacks_sent++;
+  return CommandFactory::create_ack(last_good_seq, our_tx_seq_lo);
+}
+
+std::optional<DlFlit> DlAckNakManager::handle_out_of_order(std::uint8_t our_tx_seq_lo) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  stats_.out_of_order_received++;
+
+  // First flit past the gap - request replay from the expected sequence
+  if (!replay_outstanding_) {
+    return send_replay_request(our_tx_seq_lo);
+  }
+
+  // Gap already reported - suppress unless the retry timer expired
+  flits_since_replay_request_++;
+  if (replay_retry_expired()) {
+    stats_.replay_request_retries++;
+    return send_replay_request(our_tx_seq_lo);
+  }
+
+  stats_.replay_requests_suppressed++;
+  return std::nullopt;
+}
+
+bool DlAckNakManager::replay_retry_expired() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return replay_retry_flits_ != 0 && flits_since_replay_request_ >= replay_retry_flits_;
+}
+
+DlFlit DlAckNakManager::send_replay_request(std::uint8_t our_tx_seq_lo) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  replay_outstanding_ = true;
+  replay_outstanding_seq_ = rx_seq_tracker_.expected_seq();
+  flits_since_replay_request_ = 0;
+  stats_.replay_requests_sent++;
+  return CommandFactory::create_replay_request(replay_outstanding_seq_, our_tx_seq_lo);
 }
 
 std::uint16_t DlAckNakManager::expected_rx_seq() const noexcept { return rx_seq_tracker_.expected_seq(); }
@@ -211,7 +304,12 @@ std::uint16_t DlAckNakManager::expected_rx_seq() const noexcept { return rx_seq_
 void DlAckNakManager::reset_rx_state() noexcept {
   UALINK_TRACE_SCOPED(__func__);
   rx_seq_tracker_.reset();
+  flit_accepted_ = false;
   flits_since_ack_ = 0;
+  replay_outstanding_ = false;
+  replay_outstanding_seq_ = 0;
+  flits_since_replay_request_ = 0;
+  last_reack_seq_ = 0;
 }
 
 DlFlit DlAckNakManager::generate_ack(std::uint16_t ack_seq, std::uint8_t flit_seq_lo) {
@@ -230,3 +328,15 @@ void DlAckNakManager::set_ack_every_n_flits(std::size_t n) noexcept {
 }
 
 std::size_t DlAckNakManager::get_ack_every_n_flits() const noexcept { return ack_every_n_; }
+
+void DlAckNakManager::set_replay_retry_flits(std::size_t flits) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  replay_retry_flits_ = flits;
+}
+
+std::size_t DlAckNakManager::get_replay_retry_flits() const noexcept { return replay_retry_flits_; }
+
+void DlAckNakManager::reset_stats() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  stats_ = Stats{};
+}
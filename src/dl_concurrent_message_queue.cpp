@@ -0,0 +1,157 @@
+#include "ualink/dl_concurrent_message_queue.h"
+
+#include <stdexcept>
+
+namespace ualink::dl {
+
+void DlConcurrentMessageQueue::enqueue(const DlMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!try_enqueue(msg)) {
+    throw std::length_error("DlConcurrentMessageQueue::enqueue: message group ring full");
+  }
+}
+
+bool DlConcurrentMessageQueue::try_enqueue(const DlMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const MessageGroup group = get_message_group(msg);
+  if (group == MessageGroup::kNone) {
+    throw std::invalid_argument("DlConcurrentMessageQueue::enqueue: invalid message group");
+  }
+
+  // Serialize on the producer's thread; only the slot claim is shared
+  if (!ring_for_group(group).try_push(serialize_dl_message(msg))) {
+    return false;
+  }
+
+  switch (group) {
+  case MessageGroup::kBasic:
+    stats_.basic_enqueued.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kControl:
+    stats_.control_enqueued.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kUart:
+    stats_.uart_enqueued.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kNone:
+    break;
+  }
+  return true;
+}
+
+DlConcurrentMessageQueue::SlotRing &DlConcurrentMessageQueue::ring_for_group(MessageGroup group) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (group == MessageGroup::kBasic) {
+    return basic_ring_;
+  }
+  if (group == MessageGroup::kControl) {
+    return control_ring_;
+  }
+  return uart_ring_;
+}
+
+const DlConcurrentMessageQueue::SlotRing &DlConcurrentMessageQueue::ring_for_group(MessageGroup group) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (group == MessageGroup::kBasic) {
+    return basic_ring_;
+  }
+  if (group == MessageGroup::kControl) {
+    return control_ring_;
+  }
+  return uart_ring_;
+}
+
+bool DlConcurrentMessageQueue::start_next_message() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const MessageGroup group = select_round_robin_group(
+      last_served_group_, [this](MessageGroup candidate) { return ring_for_group(candidate).ready(); });
+  if (group == MessageGroup::kNone) {
+    return false;
+  }
+
+  in_progress_group_ = group;
+  dword_cursor_ = 0;
+  last_served_group_ = group;
+
+  switch (group) {
+  case MessageGroup::kBasic:
+    stats_.basic_sent.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kControl:
+    stats_.control_sent.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kUart:
+    stats_.uart_sent.fetch_add(1, std::memory_order_relaxed);
+    break;
+  case MessageGroup::kNone:
+    break;
+  }
+
+  // Multi-DWord message (UART Stream Transport) - blocks other groups until done
+  if (ring_for_group(group).front().dword_count > 1) {
+    stats_.uart_multi_flit_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+std::optional<std::array<std::byte, 4>> DlConcurrentMessageQueue::pop_next_dword() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Step 1: Pick a new message unless one is mid-stream
+  if (in_progress_group_ == MessageGroup::kNone) {
+    if (!start_next_message()) {
+      return std::nullopt;
+    }
+  }
+
+  // Step 2: Stream the next DWord straight out of the head slot
+  SlotRing &ring = ring_for_group(in_progress_group_);
+  const SerializedDlMessage &message = ring.front();
+  const std::array<std::byte, 4> dword = message.dwords[dword_cursor_];
+  dword_cursor_++;
+
+  // Step 3: Release the slot after the message's last DWord
+  if (dword_cursor_ == message.dword_count) {
+    ring.pop();
+    in_progress_group_ = MessageGroup::kNone;
+  }
+
+  return dword;
+}
+
+bool DlConcurrentMessageQueue::has_pending_messages() const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (in_progress_group_ != MessageGroup::kNone) {
+    return true;
+  }
+  return basic_ring_.ready() || control_ring_.ready() || uart_ring_.ready();
+}
+
+DlConcurrentMessageQueue::Stats DlConcurrentMessageQueue::get_stats() const {
+  UALINK_TRACE_SCOPED(__func__);
+  Stats snapshot;
+  snapshot.basic_enqueued = stats_.basic_enqueued.load(std::memory_order_relaxed);
+  snapshot.control_enqueued = stats_.control_enqueued.load(std::memory_order_relaxed);
+  snapshot.uart_enqueued = stats_.uart_enqueued.load(std::memory_order_relaxed);
+  snapshot.basic_sent = stats_.basic_sent.load(std::memory_order_relaxed);
+  snapshot.control_sent = stats_.control_sent.load(std::memory_order_relaxed);
+  snapshot.uart_sent = stats_.uart_sent.load(std::memory_order_relaxed);
+  snapshot.uart_multi_flit_count = stats_.uart_multi_flit_count.load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+void DlConcurrentMessageQueue::reset_stats() {
+  UALINK_TRACE_SCOPED(__func__);
+  stats_.basic_enqueued.store(0, std::memory_order_relaxed);
+  stats_.control_enqueued.store(0, std::memory_order_relaxed);
+  stats_.uart_enqueued.store(0, std::memory_order_relaxed);
+  stats_.basic_sent.store(0, std::memory_order_relaxed);
+  stats_.control_sent.store(0, std::memory_order_relaxed);
+  stats_.uart_sent.store(0, std::memory_order_relaxed);
+  stats_.uart_multi_flit_count.store(0, std::memory_order_relaxed);
+}
+
+} // namespace ualink::dl
@@ -36,20 +36,7 @@ ErrorType DlErrorInjector::get_next_error() {
 
 DlFlit DlErrorInjector::inject_error(const DlFlit& flit, ErrorType error_type) {
   UALINK_TRACE_SCOPED(__func__);
-
-  if (error_type == ErrorType::kNone) {
-    return flit;
-  }
-
-  DlFlit corrupted = flit;
-
-  if (error_type == ErrorType::kCrcCorruption) {
-    // Flip bits in CRC to corrupt it
-    corrupted.crc[0] = static_cast<std::byte>(std::to_integer<std::uint8_t>(corrupted.crc[0]) ^ 0xFF);
-    corrupted.crc[1] = static_cast<std::byte>(std::to_integer<std::uint8_t>(corrupted.crc[1]) ^ 0xFF);
-  }
-
-  return corrupted;
+  return inject_flit_error(flit, error_type);
 }
 
 bool DlErrorInjector::should_drop_flit() {
@@ -81,6 +68,24 @@ std::uint16_t DlErrorInjector::modify_sequence(std::uint16_t seq_no, ErrorType e
   return seq_no;
 }
 
+DlFlit ualink::dl::inject_flit_error(const DlFlit& flit, ErrorType error_type) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (error_type == ErrorType::kNone) {
+    return flit;
+  }
+
+  DlFlit corrupted = flit;
+
+  if (error_type == ErrorType::kCrcCorruption) {
+    // Flip bits in CRC to corrupt it
+    corrupted.crc[0] = static_cast<std::byte>(std::to_integer<std::uint8_t>(corrupted.crc[0]) ^ 0xFF);
+    corrupted.crc[1] = static_cast<std::byte>(std::to_integer<std::uint8_t>(corrupted.crc[1]) ^ 0xFF);
+  }
+
+  return corrupted;
+}
+
 RandomErrorPolicy::RandomErrorPolicy(double error_probability)
     : crc_corruption_prob_(error_probability),
       packet_drop_prob_(error_probability),
@@ -124,6 +129,71 @@ void RandomErrorPolicy::set_sequence_error_probability(double prob) noexcept {
   sequence_error_prob_ = prob;
 }
 
+GeometricErrorPolicy::GeometricErrorPolicy(double error_probability, std::uint64_t seed)
+    : rng_(seed),
+      crc_corruption_prob_(error_probability),
+      packet_drop_prob_(error_probability),
+      sequence_error_prob_(error_probability) {
+  UALINK_TRACE_SCOPED(__func__);
+  resample_gap();
+}
+
+ErrorType GeometricErrorPolicy::next_error_event() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // This flit carries an error; pick its type in proportion to the configured
+  // probabilities, then skip ahead to the next one
+  const double pick = rng_.next_double() * (crc_corruption_prob_ + packet_drop_prob_ + sequence_error_prob_);
+  resample_gap();
+
+  if (pick < crc_corruption_prob_) {
+    return ErrorType::kCrcCorruption;
+  }
+
+  if (pick < crc_corruption_prob_ + packet_drop_prob_) {
+    return ErrorType::kPacketDrop;
+  }
+
+  if ((rng_() & 0x1U) == 0) {
+    return ErrorType::kSequenceDup;
+  }
+  return ErrorType::kSequenceSkip;
+}
+
+void GeometricErrorPolicy::set_crc_corruption_probability(double prob) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  crc_corruption_prob_ = prob;
+  resample_gap();
+}
+
+void GeometricErrorPolicy::set_packet_drop_probability(double prob) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  packet_drop_prob_ = prob;
+  resample_gap();
+}
+
+void GeometricErrorPolicy::set_sequence_error_probability(double prob) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  sequence_error_prob_ = prob;
+  resample_gap();
+}
+
+void GeometricErrorPolicy::reseed(std::uint64_t seed) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  rng_.reseed(seed);
+  resample_gap();
+}
+
+double GeometricErrorPolicy::total_probability() const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return std::min(1.0, crc_corruption_prob_ + packet_drop_prob_ + sequence_error_prob_);
+}
+
+void GeometricErrorPolicy::resample_gap() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  flits_until_error_ = ualink::sample_geometric_gap(rng_, total_probability());
+}
+
 PeriodicErrorPolicy::PeriodicErrorPolicy(std::size_t period, ErrorType error_type)
     : period_(period), error_type_(error_type) {
   UALINK_TRACE_SCOPED(__func__);
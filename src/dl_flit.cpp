@@ -4,6 +4,7 @@
 #include <stdexcept>
 
 #include "ualink/crc.h"
+#include "ualink/dl_concurrent_message_queue.h"
 #include "ualink/dl_error_injection.h"
 #include "ualink/dl_message_queue.h"
 #include "ualink/dl_pacing.h"
@@ -207,15 +208,26 @@ DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, con
   return flit;
 }
 
-// NEW: Serialize with optional DL message queue
-DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
-                                           DlMessageQueue *message_queue, std::size_t *flits_serialized) {
+void ualink::dl::validate_alt_sector(const DlAltSectorConfig &config) {
   UALINK_TRACE_SCOPED(__func__);
-
-  // If no message queue, use original serialize
-  if (message_queue == nullptr) {
-    return serialize(tl_flits, header, flits_serialized);
+  if (config.dwords == 0 || config.dwords > kMaxAltSectorDwords) {
+    throw std::invalid_argument("DlAltSectorConfig: sector size must be 1..kMaxAltSectorDwords DWords");
   }
+}
+
+std::size_t ualink::dl::alt_sector_bytes(const DlAltSectorConfig &config, std::size_t segment_index) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(config);
+  return std::min(config.dwords * 4, kSegmentPayloadBytes[segment_index]);
+}
+
+// Helper: pack TL flits behind each segment's DL message sector; MessageQueue
+// is DlMessageQueue or DlConcurrentMessageQueue (pop_next_dword / has_pending_messages)
+template <typename MessageQueue>
+static DlFlit serialize_with_message_queue(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                           MessageQueue &message_queue, const DlAltSectorConfig &alt_sector,
+                                           std::size_t *flits_serialized) {
+  UALINK_TRACE_SCOPED(__func__);
 
   DlFlit flit{};
   flit.flit_header = serialize_explicit_flit_header(header);
@@ -228,15 +240,19 @@ DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, con
     const std::size_t segment_start = kSegmentPayloadOffsets[segment_index];
     std::size_t segment_local_offset = 0;
 
-    // Step 1: Try to pack DL message (priority - placed FIRST in segment)
-    if (message_queue->has_pending_messages()) {
-      auto dword_opt = message_queue->pop_next_dword();
-      if (dword_opt.has_value()) {
-        // Place DL message at start of segment (bytes [0:3] within segment)
-        std::copy_n(dword_opt->begin(), 4, flit.payload.begin() + segment_start);
-        segment_fields[segment_index].dl_alt_sector = true;
-        segment_local_offset = 4; // TL flits start after DL message
+    // Step 1: Fill the alternative sector with DL messages (priority - placed FIRST in segment).
+    // Payload is zero-initialized, so sector DWords left unfilled read back as No-Ops.
+    if (message_queue.has_pending_messages()) {
+      const std::size_t sector_bytes = alt_sector_bytes(alt_sector, segment_index);
+      for (std::size_t sector_offset = 0; sector_offset < sector_bytes; sector_offset += 4) {
+        const auto dword_opt = message_queue.pop_next_dword();
+        if (!dword_opt.has_value()) {
+          break;
+        }
+        std::copy_n(dword_opt->begin(), 4, flit.payload.begin() + segment_start + sector_offset);
       }
+      segment_fields[segment_index].dl_alt_sector = true;
+      segment_local_offset = sector_bytes; // TL flits start after the sector
     }
 
     // Step 2: Pack TL flits in remaining space
@@ -284,6 +300,44 @@ DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, con
   return flit;
 }
 
+// NEW: Serialize with optional DL message queue
+DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                           DlMessageQueue *message_queue, std::size_t *flits_serialized) {
+  UALINK_TRACE_SCOPED(__func__);
+  return serialize(tl_flits, header, message_queue, DlAltSectorConfig{}, flits_serialized);
+}
+
+DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                           DlMessageQueue *message_queue, const DlAltSectorConfig &alt_sector,
+                                           std::size_t *flits_serialized) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(alt_sector);
+
+  // If no message queue, use original serialize
+  if (message_queue == nullptr) {
+    return serialize(tl_flits, header, flits_serialized);
+  }
+  return serialize_with_message_queue(tl_flits, header, *message_queue, alt_sector, flits_serialized);
+}
+
+DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                           DlConcurrentMessageQueue *message_queue, std::size_t *flits_serialized) {
+  UALINK_TRACE_SCOPED(__func__);
+  return serialize(tl_flits, header, message_queue, DlAltSectorConfig{}, flits_serialized);
+}
+
+DlFlit ualink::dl::DlSerializer::serialize(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                                           DlConcurrentMessageQueue *message_queue, const DlAltSectorConfig &alt_sector,
+                                           std::size_t *flits_serialized) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(alt_sector);
+
+  if (message_queue == nullptr) {
+    return serialize(tl_flits, header, flits_serialized);
+  }
+  return serialize_with_message_queue(tl_flits, header, *message_queue, alt_sector, flits_serialized);
+}
+
 std::vector<TlFlit> ualink::dl::DlDeserializer::deserialize(const DlFlit &flit) {
   UALINK_TRACE_SCOPED(__func__);
   std::vector<TlFlit> tl_flits;
@@ -331,6 +385,12 @@ std::optional<std::vector<TlFlit>> ualink::dl::DlDeserializer::deserialize_with_
 
 DlDeserializedResult ualink::dl::DlDeserializer::deserialize_ex(const DlFlit &flit) {
   UALINK_TRACE_SCOPED(__func__);
+  return deserialize_ex(flit, DlAltSectorConfig{});
+}
+
+DlDeserializedResult ualink::dl::DlDeserializer::deserialize_ex(const DlFlit &flit, const DlAltSectorConfig &alt_sector) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(alt_sector);
   DlDeserializedResult result;
 
   for (std::size_t segment_index = 0; segment_index < kDlSegmentCount; ++segment_index) {
@@ -339,12 +399,15 @@ DlDeserializedResult ualink::dl::DlDeserializer::deserialize_ex(const DlFlit &fl
     const std::size_t segment_size = kSegmentPayloadBytes[segment_index];
     std::size_t tl_offset = 0;
 
-    // Extract DL message if present (FIRST 4 bytes of segment)
+    // Extract every DWord of the alternative sector if present (start of segment)
     if (header.dl_alt_sector) {
-      std::array<std::byte, 4> dword;
-      std::copy_n(flit.payload.begin() + segment_offset, 4, dword.begin());
-      result.dl_message_dwords.push_back(dword);
-      tl_offset = 4; // TL flits start after DL message
+      const std::size_t sector_bytes = alt_sector_bytes(alt_sector, segment_index);
+      for (std::size_t sector_offset = 0; sector_offset < sector_bytes; sector_offset += 4) {
+        std::array<std::byte, 4> dword;
+        std::copy_n(flit.payload.begin() + segment_offset + sector_offset, 4, dword.begin());
+        result.dl_message_dwords.push_back(dword);
+      }
+      tl_offset = sector_bytes; // TL flits start after the sector
     }
 
     // Extract TL flits from remaining space
@@ -368,6 +431,12 @@ DlDeserializedResult ualink::dl::DlDeserializer::deserialize_ex(const DlFlit &fl
 
 std::optional<DlDeserializedResult> ualink::dl::DlDeserializer::deserialize_ex_with_crc_check(const DlFlit &flit) {
   UALINK_TRACE_SCOPED(__func__);
+  return deserialize_ex_with_crc_check(flit, DlAltSectorConfig{});
+}
+
+std::optional<DlDeserializedResult>
+ualink::dl::DlDeserializer::deserialize_ex_with_crc_check(const DlFlit &flit, const DlAltSectorConfig &alt_sector) {
+  UALINK_TRACE_SCOPED(__func__);
 
   // Verify CRC over flit_header + segment_headers + payload
   constexpr std::size_t kCrcCoveredBytes = 3 + kDlSegmentCount + kDlPayloadBytes;
@@ -381,7 +450,7 @@ std::optional<DlDeserializedResult> ualink::dl::DlDeserializer::deserialize_ex_w
     return std::nullopt;
   }
 
-  return deserialize_ex(flit);
+  return deserialize_ex(flit, alt_sector);
 }
 
 DlFlit ualink::dl::DlSerializer::serialize_with_pacing(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
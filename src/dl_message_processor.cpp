@@ -1,216 +1,280 @@
 #include "ualink/dl_message_processor.h"
 
-#include <stdexcept>
+#include <cstddef>
 
 namespace ualink::dl {
 
+// Dispatch index from the common DWord fields (Table 6-3): mtype is bits 8:6
+// and mclass bits 5:2, with byte 0 carrying bits 31:24
+static std::size_t dispatch_index(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+  const unsigned byte2 = std::to_integer<unsigned>(dword[2]);
+  const unsigned byte3 = std::to_integer<unsigned>(dword[3]);
+  const unsigned mtype = ((byte2 & 0x1U) << 2) | (byte3 >> 6);
+  const unsigned mclass = (byte3 >> 2) & 0xFU;
+  return (mclass << 3) | mtype;
+}
+
+constexpr std::array<DlMessageProcessor::DispatchEntry, DlMessageProcessor::kDispatchTableSize>
+DlMessageProcessor::build_dispatch_table() {
+  UALINK_TRACE_SCOPED(__func__);
+  std::array<DispatchEntry, kDispatchTableSize> table{};
+
+  const auto add = [&table](DlMessageClass mclass, std::uint8_t mtype, Handler handler, std::size_t Stats::*received) {
+    table[(static_cast<std::size_t>(mclass) << 3) | mtype] = DispatchEntry{handler, received};
+  };
+
+  add(DlMessageClass::kBasic, static_cast<std::uint8_t>(DlBasicMessageType::kNoOp), &DlMessageProcessor::handle_no_op,
+      &Stats::basic_received);
+  add(DlMessageClass::kBasic, static_cast<std::uint8_t>(DlBasicMessageType::kTlRateNotification),
+      &DlMessageProcessor::handle_tl_rate, &Stats::basic_received);
+  add(DlMessageClass::kBasic, static_cast<std::uint8_t>(DlBasicMessageType::kDeviceIdRequest),
+      &DlMessageProcessor::handle_device_id, &Stats::basic_received);
+  add(DlMessageClass::kBasic, static_cast<std::uint8_t>(DlBasicMessageType::kPortNumberRequestResponse),
+      &DlMessageProcessor::handle_port_id, &Stats::basic_received);
+
+  add(DlMessageClass::kControl, static_cast<std::uint8_t>(DlControlMessageType::kChannelOnlineOfflineNegotiation),
+      &DlMessageProcessor::handle_channel_negotiation, &Stats::control_received);
+
+  add(DlMessageClass::kUart, static_cast<std::uint8_t>(DlUartMessageType::kStreamTransportMessage),
+      &DlMessageProcessor::handle_uart_transport_header, &Stats::uart_received);
+  add(DlMessageClass::kUart, static_cast<std::uint8_t>(DlUartMessageType::kStreamCreditUpdate),
+      &DlMessageProcessor::handle_uart_credit, &Stats::uart_received);
+  add(DlMessageClass::kUart, static_cast<std::uint8_t>(DlUartMessageType::kStreamResetRequest),
+      &DlMessageProcessor::handle_uart_reset_request, &Stats::uart_received);
+  add(DlMessageClass::kUart, static_cast<std::uint8_t>(DlUartMessageType::kStreamResetResponse),
+      &DlMessageProcessor::handle_uart_reset_response, &Stats::uart_received);
+
+  return table;
+}
+
 bool DlMessageProcessor::process_dword(const std::array<std::byte, 4>& dword, std::uint64_t current_time_us) {
   UALINK_TRACE_SCOPED(__func__);
+  return process_dword_ex(dword, current_time_us) == DlMessageStatus::kOk;
+}
 
-  // Extract mclass field (bits 31:30) to determine message group
-  const std::uint8_t mclass = (static_cast<std::uint8_t>(dword[0]) >> 6) & 0x3U;
-
-  try {
-    switch (mclass) {
-    case 0b00: // Basic messages
-      dispatch_basic_message(dword);
-      stats_.basic_received++;
-      break;
-
-    case 0b01: // Control messages
-      dispatch_control_message(dword);
-      stats_.control_received++;
-      break;
-
-    case 0b10: // UART messages
-      dispatch_uart_message(dword);
-      stats_.uart_received++;
-      break;
-
-    case 0b11: // Reserved
-      stats_.deserialization_errors++;
-      return false;
-    }
+DlMessageStatus DlMessageProcessor::process_dword_ex(const std::array<std::byte, 4>& dword,
+                                                     [[maybe_unused]] std::uint64_t current_time_us) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Payload DWords of a UART Stream Transport carry no message header
+  if (uart_streams_.in_progress(uart_receiving_stream_)) {
+    accept_uart_payload_dword(dword);
+    return DlMessageStatus::kOk;
+  }
 
-    return true;
+  static constexpr std::array<DispatchEntry, kDispatchTableSize> kDispatchTable = build_dispatch_table();
+  const DispatchEntry& entry = kDispatchTable[dispatch_index(dword)];
+  if (entry.handler == nullptr) {
+    stats_.deserialization_errors++;
+    return DlMessageStatus::kUnknownMessage;
+  }
 
-  } catch (const std::exception&) {
+  const DlMessageStatus status = (this->*entry.handler)(dword);
+  if (status != DlMessageStatus::kOk) {
     stats_.deserialization_errors++;
-    return false;
+    return status;
   }
+
+  (stats_.*entry.received)++;
+  return DlMessageStatus::kOk;
 }
 
-void DlMessageProcessor::dispatch_basic_message(const std::array<std::byte, 4>& dword) {
+DlMessageBatchResult DlMessageProcessor::process_dwords(std::span<const std::array<std::byte, 4>> dwords,
+                                                        std::uint64_t current_time_us) {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Extract mtype field (bits 29:27) to determine specific message type
-  const std::uint8_t mtype = (static_cast<std::uint8_t>(dword[0]) >> 3) & 0x7U;
-
-  switch (mtype) {
-  case 0b000: { // NoOp
-    auto msg_opt = deserialize_no_op_message(dword);
-    if (msg_opt.has_value() && noop_callback_) {
-      noop_callback_(msg_opt.value());
+  DlMessageBatchResult result;
+  for (const std::array<std::byte, 4>& dword : dwords) {
+    if (process_dword_ex(dword, current_time_us) == DlMessageStatus::kOk) {
+      result.accepted++;
+    } else {
+      result.rejected++;
     }
-    break;
   }
+  return result;
+}
 
-  case 0b100: { // TL Rate Notification
-    auto msg_opt = deserialize_tl_rate_notification(dword);
-    if (msg_opt.has_value() && tl_rate_callback_) {
-      tl_rate_callback_(msg_opt.value());
-      // Cancel timeout if this is a response
-      if (basic_timeout_.waiting_for_response) {
-        cancel_basic_timeout();
-      }
-    }
-    break;
+DlMessageStatus DlMessageProcessor::handle_no_op(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_no_op_message(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
+  }
+  if (noop_callback_) {
+    noop_callback_(*msg_opt);
   }
+  return DlMessageStatus::kOk;
+}
 
-  case 0b101: { // Device ID Request/Response
-    auto msg_opt = deserialize_device_id_message(dword);
-    if (msg_opt.has_value() && device_id_callback_) {
-      device_id_callback_(msg_opt.value());
-      // Cancel timeout if this is a response (ack bit set)
-      if (msg_opt->ack && basic_timeout_.waiting_for_response) {
-        cancel_basic_timeout();
-      }
-    }
-    break;
+DlMessageStatus DlMessageProcessor::handle_tl_rate(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_tl_rate_notification(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
+  }
+  if (tl_rate_callback_) {
+    tl_rate_callback_(*msg_opt);
   }
+  // Cancel timeout if this is a response
+  if (basic_timeout_.waiting_for_response) {
+    cancel_basic_timeout();
+  }
+  return DlMessageStatus::kOk;
+}
 
-  case 0b110: { // Port ID Request/Response
-    auto msg_opt = deserialize_port_id_message(dword);
-    if (msg_opt.has_value() && port_id_callback_) {
-      port_id_callback_(msg_opt.value());
-      // Cancel timeout if this is a response (ack bit set)
-      if (msg_opt->ack && basic_timeout_.waiting_for_response) {
-        cancel_basic_timeout();
-      }
-    }
-    break;
+DlMessageStatus DlMessageProcessor::handle_device_id(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_device_id_message(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
+  }
+  if (device_id_callback_) {
+    device_id_callback_(*msg_opt);
   }
+  // Cancel timeout if this is a response (ack bit set)
+  if (msg_opt->ack && basic_timeout_.waiting_for_response) {
+    cancel_basic_timeout();
+  }
+  return DlMessageStatus::kOk;
+}
 
-  default:
-    // Unknown message type
-    throw std::runtime_error("Unknown basic message type");
+DlMessageStatus DlMessageProcessor::handle_port_id(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_port_id_message(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
   }
+  if (port_id_callback_) {
+    port_id_callback_(*msg_opt);
+  }
+  // Cancel timeout if this is a response (ack bit set)
+  if (msg_opt->ack && basic_timeout_.waiting_for_response) {
+    cancel_basic_timeout();
+  }
+  return DlMessageStatus::kOk;
 }
 
-void DlMessageProcessor::dispatch_control_message(const std::array<std::byte, 4>& dword) {
+DlMessageStatus DlMessageProcessor::handle_channel_negotiation(const std::array<std::byte, 4>& dword) {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Extract mtype field (bits 29:27)
-  const std::uint8_t mtype = (static_cast<std::uint8_t>(dword[0]) >> 3) & 0x7U;
-
-  if (mtype == 0b100) { // Channel Online/Offline Negotiation
-    auto msg_opt = deserialize_channel_negotiation(dword);
-    if (msg_opt.has_value() && control_callback_) {
-      control_callback_(msg_opt.value());
-
-      // Update channel state machine based on received command
-      const std::uint8_t command = msg_opt->channel_command;
-      switch (command) {
-      case 0b0000: // Request
-        if (channel_state_.state == ChannelState::kOffline) {
-          // Received request while offline - will respond with Ack
-          channel_state_.state = ChannelState::kRequestSent;
-        }
-        break;
-
-      case 0b0001: // Ack
-        if (channel_state_.state == ChannelState::kRequestSent) {
-          // Our request was acknowledged
-          channel_state_.state = ChannelState::kOnline;
-        }
-        break;
-
-      case 0b0010: // NAck
-        if (channel_state_.state == ChannelState::kRequestSent) {
-          // Our request was rejected
-          channel_state_.state = ChannelState::kOffline;
-        }
-        break;
-
-      case 0b0011: // Pending
-        // Request is still pending, no state change
-        break;
-
-      default:
-        // Unknown command
-        break;
-      }
-    }
-  } else {
-    throw std::runtime_error("Unknown control message type");
+  const auto msg_opt = deserialize_channel_negotiation(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
   }
+  if (control_callback_) {
+    control_callback_(*msg_opt);
+  }
+  apply_channel_command(msg_opt->channel_command);
+  return DlMessageStatus::kOk;
 }
 
-void DlMessageProcessor::dispatch_uart_message(const std::array<std::byte, 4>& dword) {
+void DlMessageProcessor::apply_channel_command(std::uint8_t command) {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Extract mtype field (bits 29:27)
-  const std::uint8_t mtype = (static_cast<std::uint8_t>(dword[0]) >> 3) & 0x7U;
+  switch (command) {
+  case 0b0000: // Request
+    if (channel_state_.state == ChannelState::kOffline) {
+      // Received request while offline - will respond with Ack
+      channel_state_.state = ChannelState::kRequestSent;
+    }
+    break;
 
-  switch (mtype) {
-  case 0b000: { // Stream Reset Request
-    auto msg_opt = deserialize_uart_stream_reset_request(dword);
-    if (msg_opt.has_value() && uart_reset_req_callback_) {
-      uart_reset_req_callback_(msg_opt.value());
+  case 0b0001: // Ack
+    if (channel_state_.state == ChannelState::kRequestSent) {
+      // Our request was acknowledged
+      channel_state_.state = ChannelState::kOnline;
     }
     break;
-  }
 
-  case 0b001: { // Stream Reset Response
-    auto msg_opt = deserialize_uart_stream_reset_response(dword);
-    if (msg_opt.has_value() && uart_reset_rsp_callback_) {
-      uart_reset_rsp_callback_(msg_opt.value());
+  case 0b0010: // NAck
+    if (channel_state_.state == ChannelState::kRequestSent) {
+      // Our request was rejected
+      channel_state_.state = ChannelState::kOffline;
     }
     break;
+
+  default:
+    // Pending (0b0011): request still pending, no state change
+    break;
   }
+}
 
-  case 0b010: { // Stream Transport Message
-    // UART Stream Transport is multi-DWord - requires reassembly
-    // The header DWord contains stream_id in bits 26:24
-    const std::uint8_t stream_id = (static_cast<std::uint8_t>(dword[0]) >> 0) & 0x7U;
+DlMessageStatus DlMessageProcessor::handle_uart_reset_request(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
 
-    if (!uart_reassembly_.in_progress) {
-      // Start new reassembly
-      uart_reassembly_.stream_id = stream_id;
-      uart_reassembly_.accumulated_dwords.clear();
-      uart_reassembly_.in_progress = true;
-    }
-    // Note: Full reassembly and callback invocation happens when complete message is received
-    // This is simplified for now - full implementation would accumulate payload DWords
-    break;
+  const auto msg_opt = deserialize_uart_stream_reset_request(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
+  }
+  if (uart_reset_req_callback_) {
+    uart_reset_req_callback_(*msg_opt);
   }
+  return DlMessageStatus::kOk;
+}
 
-  case 0b011: { // Stream Credit Update
-    auto msg_opt = deserialize_uart_stream_credit_update(dword);
-    if (msg_opt.has_value() && uart_credit_callback_) {
-      uart_credit_callback_(msg_opt.value());
-    }
-    break;
+DlMessageStatus DlMessageProcessor::handle_uart_reset_response(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_uart_stream_reset_response(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
   }
+  if (uart_reset_rsp_callback_) {
+    uart_reset_rsp_callback_(*msg_opt);
+  }
+  return DlMessageStatus::kOk;
+}
 
-  default:
-    throw std::runtime_error("Unknown UART message type");
+DlMessageStatus DlMessageProcessor::handle_uart_transport_header(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto stream_id = uart_streams_.begin(dword);
+  if (!stream_id.has_value()) {
+    return DlMessageStatus::kMalformed;
   }
 
-  // Handle UART Stream Transport payload DWords (accumulated after header)
-  if (uart_reassembly_.in_progress && mtype != 0b010) {
-    // If we're in reassembly mode but received non-transport message,
-    // assume transport is complete
-    if (!uart_reassembly_.accumulated_dwords.empty() && uart_transport_callback_) {
-      UartStreamTransportMessage complete_msg{};
-      complete_msg.stream_id = uart_reassembly_.stream_id;
-      complete_msg.payload_dwords = uart_reassembly_.accumulated_dwords;
-      complete_msg.common = make_common(DlUartMessageType::kStreamTransportMessage);
-
-      uart_transport_callback_(complete_msg);
-      reset_uart_reassembly();
-    }
+  // The header's stream owns the payload DWords that follow it on the wire
+  uart_receiving_stream_ = *stream_id;
+  return DlMessageStatus::kOk;
+}
+
+void DlMessageProcessor::accept_uart_payload_dword(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const UartStreamTransportView* complete =
+      uart_streams_.append(uart_receiving_stream_, deserialize_uart_stream_payload_dword(dword));
+  if (complete == nullptr) {
+    return;
+  }
+
+  if (uart_transport_view_callback_) {
+    uart_transport_view_callback_(*complete);
+  }
+  if (uart_transport_callback_) {
+    UartStreamTransportMessage complete_msg{};
+    complete_msg.stream_id = complete->stream_id;
+    complete_msg.payload_dwords.assign(complete->payload_dwords.begin(), complete->payload_dwords.end());
+    complete_msg.common = make_common(DlUartMessageType::kStreamTransportMessage);
+    uart_transport_callback_(complete_msg);
+  }
+}
+
+DlMessageStatus DlMessageProcessor::handle_uart_credit(const std::array<std::byte, 4>& dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto msg_opt = deserialize_uart_stream_credit_update(dword);
+  if (!msg_opt.has_value()) {
+    return DlMessageStatus::kMalformed;
+  }
+  if (uart_credit_callback_) {
+    uart_credit_callback_(*msg_opt);
   }
+  return DlMessageStatus::kOk;
 }
 
 void DlMessageProcessor::start_basic_timeout(std::uint16_t sequence_id, std::uint64_t current_time_us) {
@@ -250,8 +314,8 @@ void DlMessageProcessor::transition_channel_state(ChannelState new_state, std::u
 
 void DlMessageProcessor::reset_uart_reassembly() {
   UALINK_TRACE_SCOPED(__func__);
-  uart_reassembly_.in_progress = false;
-  uart_reassembly_.accumulated_dwords.clear();
+  uart_streams_.reset_all();
+  uart_receiving_stream_ = 0;
 }
 
 void DlMessageProcessor::reset_stats() {
@@ -5,8 +5,8 @@
 
 namespace ualink::dl {
 
-// Helper: determine which group a message belongs to
-MessageGroup DlMessageQueue::get_message_group(const DlMessage &msg) {
+MessageGroup get_message_group(const DlMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
   return std::visit(
       [](auto &&m) -> MessageGroup {
         using T = std::decay_t<decltype(m)>;
@@ -31,179 +31,137 @@ MessageGroup DlMessageQueue::get_message_group(const DlMessage &msg) {
       msg);
 }
 
-// Helper: serialize a message to DWord(s)
-std::vector<std::array<std::byte, 4>> DlMessageQueue::serialize_message(const DlMessage &msg) {
+// Helper: serialize a single-DWord message
+template <typename T>
+static std::array<std::byte, 4> serialize_single_dword(const T &m) {
   UALINK_TRACE_SCOPED(__func__);
+  if constexpr (std::is_same_v<T, NoOpMessage>) {
+    return serialize_no_op_message(m);
+  } else if constexpr (std::is_same_v<T, TlRateNotification>) {
+    return serialize_tl_rate_notification(m);
+  } else if constexpr (std::is_same_v<T, DeviceIdMessage>) {
+    return serialize_device_id_message(m);
+  } else if constexpr (std::is_same_v<T, PortIdMessage>) {
+    return serialize_port_id_message(m);
+  } else if constexpr (std::is_same_v<T, UartStreamResetRequest>) {
+    return serialize_uart_stream_reset_request(m);
+  } else if constexpr (std::is_same_v<T, UartStreamResetResponse>) {
+    return serialize_uart_stream_reset_response(m);
+  } else if constexpr (std::is_same_v<T, UartStreamCreditUpdate>) {
+    return serialize_uart_stream_credit_update(m);
+  } else {
+    static_assert(std::is_same_v<T, ChannelNegotiation>, "DlMessageQueue: unhandled single-DWord message type");
+    return serialize_channel_negotiation(m);
+  }
+}
 
-  return std::visit(
-      [](auto &&m) -> std::vector<std::array<std::byte, 4>> {
+SerializedDlMessage serialize_dl_message(const DlMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  SerializedDlMessage serialized;
+  std::visit(
+      [&serialized](auto &&m) {
         using T = std::decay_t<decltype(m)>;
 
-        if constexpr (std::is_same_v<T, NoOpMessage>) {
-          return {serialize_no_op_message(m)};
-        } else if constexpr (std::is_same_v<T, TlRateNotification>) {
-          return {serialize_tl_rate_notification(m)};
-        } else if constexpr (std::is_same_v<T, DeviceIdMessage>) {
-          return {serialize_device_id_message(m)};
-        } else if constexpr (std::is_same_v<T, PortIdMessage>) {
-          return {serialize_port_id_message(m)};
-        } else if constexpr (std::is_same_v<T, UartStreamResetRequest>) {
-          return {serialize_uart_stream_reset_request(m)};
-        } else if constexpr (std::is_same_v<T, UartStreamResetResponse>) {
-          return {serialize_uart_stream_reset_response(m)};
-        } else if constexpr (std::is_same_v<T, UartStreamTransportMessage>) {
+        if constexpr (std::is_same_v<T, UartStreamTransportMessage>) {
           // Multi-DWord message: header + payload
-          std::vector<std::byte> all_bytes = serialize_uart_stream_transport_message(m);
-          std::vector<std::array<std::byte, 4>> dwords;
-
-          for (std::size_t i = 0; i < all_bytes.size(); i += 4) {
-            std::array<std::byte, 4> dword{};
-            std::copy_n(all_bytes.begin() + static_cast<std::ptrdiff_t>(i), 4, dword.begin());
-            dwords.push_back(dword);
+          serialized.dwords[0] = serialize_uart_stream_transport_header(m);
+          for (std::size_t payload_index = 0; payload_index < m.payload_dwords.size(); ++payload_index) {
+            serialized.dwords[1 + payload_index] = serialize_uart_stream_payload_dword(m.payload_dwords[payload_index]);
           }
-          return dwords;
-        } else if constexpr (std::is_same_v<T, UartStreamCreditUpdate>) {
-          return {serialize_uart_stream_credit_update(m)};
-        } else if constexpr (std::is_same_v<T, ChannelNegotiation>) {
-          return {serialize_channel_negotiation(m)};
+          serialized.dword_count = 1 + m.payload_dwords.size();
         } else {
-          throw std::logic_error("DlMessageQueue: unknown message type in variant");
+          serialized.dwords[0] = serialize_single_dword(m);
+          serialized.dword_count = 1;
         }
       },
       msg);
+  return serialized;
 }
 
-void DlMessageQueue::enqueue(DlMessage msg) {
+// Helper: copy a serialized message into a ring, all-or-nothing; each entry
+// records how many DWords of the same message follow it
+void DlMessageQueue::push_into_ring(const SerializedDlMessage &serialized, DlDwordRing &ring) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (ring.free_space() < serialized.dword_count) {
+    throw std::length_error("DlMessageQueue::enqueue: message group ring full");
+  }
+
+  for (std::size_t dword_index = 0; dword_index < serialized.dword_count; ++dword_index) {
+    DlDwordRing::Entry entry{};
+    entry.dword = serialized.dwords[dword_index];
+    entry.dwords_following = static_cast<std::uint8_t>(serialized.dword_count - dword_index - 1);
+    ring.push(entry);
+  }
+}
+
+void DlMessageQueue::enqueue(const DlMessage &msg) {
   UALINK_TRACE_SCOPED(__func__);
 
   const MessageGroup group = get_message_group(msg);
+  if (group == MessageGroup::kNone) {
+    throw std::invalid_argument("DlMessageQueue::enqueue: invalid message group");
+  }
+
+  push_into_ring(serialize_dl_message(msg), ring_for_group(group));
 
   switch (group) {
   case MessageGroup::kBasic:
-    basic_queue_.push(std::move(msg));
     stats_.basic_enqueued++;
     break;
   case MessageGroup::kControl:
-    control_queue_.push(std::move(msg));
     stats_.control_enqueued++;
     break;
   case MessageGroup::kUart:
-    uart_queue_.push(std::move(msg));
     stats_.uart_enqueued++;
     break;
   case MessageGroup::kNone:
-    throw std::invalid_argument("DlMessageQueue::enqueue: invalid message group");
+    break;
   }
 }
 
-MessageGroup DlMessageQueue::select_next_group() {
+DlDwordRing &DlMessageQueue::ring_for_group(MessageGroup group) {
   UALINK_TRACE_SCOPED(__func__);
-
-  // If UART transport in progress, block other messages (spec: "other DL messages shall be blocked")
-  if (uart_transport_state_.in_progress) {
-    return MessageGroup::kUart;
+  if (group == MessageGroup::kBasic) {
+    return basic_ring_;
   }
-
-  // Round-robin: check each group starting after the last served
-  const std::array<MessageGroup, 3> group_order = {MessageGroup::kBasic, MessageGroup::kControl, MessageGroup::kUart};
-
-  // Find starting point (after last served)
-  std::size_t start_index = 0;
-  if (last_served_group_ != MessageGroup::kNone) {
-    for (std::size_t i = 0; i < group_order.size(); ++i) {
-      if (group_order[i] == last_served_group_) {
-        start_index = (i + 1) % group_order.size();
-        break;
-      }
-    }
+  if (group == MessageGroup::kControl) {
+    return control_ring_;
   }
+  return uart_ring_;
+}
 
-  // Check each group in round-robin order
-  for (std::size_t i = 0; i < group_order.size(); ++i) {
-    const std::size_t index = (start_index + i) % group_order.size();
-    const MessageGroup group = group_order[index];
-
-    bool has_messages = false;
-    switch (group) {
-    case MessageGroup::kBasic:
-      has_messages = !basic_queue_.empty();
-      break;
-    case MessageGroup::kControl:
-      has_messages = !control_queue_.empty();
-      break;
-    case MessageGroup::kUart:
-      has_messages = !uart_queue_.empty();
-      break;
-    case MessageGroup::kNone:
-      break;
-    }
-
-    if (has_messages) {
-      return group;
-    }
+const DlDwordRing &DlMessageQueue::ring_for_group(MessageGroup group) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (group == MessageGroup::kBasic) {
+    return basic_ring_;
   }
-
-  return MessageGroup::kNone;
+  if (group == MessageGroup::kControl) {
+    return control_ring_;
+  }
+  return uart_ring_;
 }
 
-std::optional<DlMessage> DlMessageQueue::pop_from_group(MessageGroup group) {
+MessageGroup DlMessageQueue::select_next_group() const {
   UALINK_TRACE_SCOPED(__func__);
 
-  switch (group) {
-  case MessageGroup::kBasic:
-    if (!basic_queue_.empty()) {
-      DlMessage msg = std::move(basic_queue_.front());
-      basic_queue_.pop();
-      return msg;
-    }
-    break;
-  case MessageGroup::kControl:
-    if (!control_queue_.empty()) {
-      DlMessage msg = std::move(control_queue_.front());
-      control_queue_.pop();
-      return msg;
-    }
-    break;
-  case MessageGroup::kUart:
-    if (!uart_queue_.empty()) {
-      DlMessage msg = std::move(uart_queue_.front());
-      uart_queue_.pop();
-      return msg;
-    }
-    break;
-  case MessageGroup::kNone:
-    break;
+  // If UART transport in progress, block other messages (spec: "other DL messages shall be blocked")
+  if (uart_dwords_in_progress_ > 0) {
+    return MessageGroup::kUart;
   }
 
-  return std::nullopt;
+  return select_round_robin_group(last_served_group_,
+                                  [this](MessageGroup group) { return !ring_for_group(group).empty(); });
 }
 
 std::optional<std::array<std::byte, 4>> DlMessageQueue::pop_next_dword() {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Step 1: If UART transport in progress, return next DWord from remaining payload
-  if (uart_transport_state_.in_progress) {
-    if (!uart_transport_state_.remaining_dwords.empty()) {
-      const std::uint32_t dword_value = uart_transport_state_.remaining_dwords.front();
-      uart_transport_state_.remaining_dwords.erase(uart_transport_state_.remaining_dwords.begin());
-
-      // Convert uint32 to byte array (big-endian)
-      std::array<std::byte, 4> dword{};
-      dword[0] = std::byte{static_cast<unsigned char>((dword_value >> 24) & 0xFFU)};
-      dword[1] = std::byte{static_cast<unsigned char>((dword_value >> 16) & 0xFFU)};
-      dword[2] = std::byte{static_cast<unsigned char>((dword_value >> 8) & 0xFFU)};
-      dword[3] = std::byte{static_cast<unsigned char>(dword_value & 0xFFU)};
-
-      // If no more payload, clear in_progress flag
-      if (uart_transport_state_.remaining_dwords.empty()) {
-        uart_transport_state_.in_progress = false;
-      }
-
-      return dword;
-    } else {
-      // Should not happen (in_progress but no remaining DWords)
-      uart_transport_state_.in_progress = false;
-    }
+  // Step 1: Continue an in-progress UART Stream Transport message
+  if (uart_dwords_in_progress_ > 0) {
+    uart_dwords_in_progress_--;
+    return uart_ring_.pop().dword;
   }
 
   // Step 2: Select next group using round-robin
@@ -212,34 +170,16 @@ std::optional<std::array<std::byte, 4>> DlMessageQueue::pop_next_dword() {
     return std::nullopt;
   }
 
-  // Step 3: Pop message from selected group
-  std::optional<DlMessage> msg_opt = pop_from_group(group);
-  if (!msg_opt.has_value()) {
-    return std::nullopt;
-  }
-
-  // Step 4: Serialize message to DWord(s)
-  std::vector<std::array<std::byte, 4>> dwords = serialize_message(msg_opt.value());
-  if (dwords.empty()) {
-    return std::nullopt;
-  }
+  // Step 3: Pop the first DWord of the group's next message
+  const DlDwordRing::Entry entry = ring_for_group(group).pop();
 
-  // Step 5: If multi-DWord (UART Stream Transport), save remaining DWords for later
-  if (dwords.size() > 1) {
-    // Extract payload DWords (skip header DWord)
-    for (std::size_t i = 1; i < dwords.size(); ++i) {
-      const auto &dword = dwords[i];
-      const std::uint32_t dword_value = (static_cast<std::uint32_t>(std::to_integer<unsigned char>(dword[0])) << 24) |
-                                        (static_cast<std::uint32_t>(std::to_integer<unsigned char>(dword[1])) << 16) |
-                                        (static_cast<std::uint32_t>(std::to_integer<unsigned char>(dword[2])) << 8) |
-                                        static_cast<std::uint32_t>(std::to_integer<unsigned char>(dword[3]));
-      uart_transport_state_.remaining_dwords.push_back(dword_value);
-    }
-    uart_transport_state_.in_progress = true;
+  // Step 4: Multi-DWord message (UART Stream Transport) - block other groups until done
+  if (entry.dwords_following > 0) {
+    uart_dwords_in_progress_ = entry.dwords_following;
     stats_.uart_multi_flit_count++;
   }
 
-  // Step 6: Update stats and last served group
+  // Step 5: Update stats and last served group
   switch (group) {
   case MessageGroup::kBasic:
     stats_.basic_sent++;
@@ -256,16 +196,15 @@ std::optional<std::array<std::byte, 4>> DlMessageQueue::pop_next_dword() {
 
   last_served_group_ = group;
 
-  // Step 7: Return first DWord
-  return dwords[0];
+  return entry.dword;
 }
 
 bool DlMessageQueue::has_pending_messages() const {
-  return !basic_queue_.empty() || !control_queue_.empty() || !uart_queue_.empty() || uart_transport_state_.in_progress;
+  return !basic_ring_.empty() || !control_ring_.empty() || !uart_ring_.empty();
 }
 
 void DlMessageQueue::reset_stats() {
   stats_ = Stats{};
 }
 
-} // namespace ualink::dl
\ No newline at end of file
+} // namespace ualink::dl
@@ -117,7 +117,7 @@ std::optional<UartStreamResetResponse> deserialize_uart_stream_reset_response(st
   return msg;
 }
 
-std::vector<std::byte> serialize_uart_stream_transport_message(const UartStreamTransportMessage &msg) {
+std::array<std::byte, 4> serialize_uart_stream_transport_header(const UartStreamTransportMessage &msg) {
   UALINK_TRACE_SCOPED(__func__);
   validate_common(msg.common);
   if (msg.stream_id != 0) {
@@ -132,57 +132,82 @@ std::vector<std::byte> serialize_uart_stream_transport_message(const UartStreamT
 
   const std::uint8_t length = static_cast<std::uint8_t>(msg.payload_dwords.size() - 1U);
 
+  std::array<std::byte, 4> header{};
+  bit_fields::NetworkBitWriter w(header);
+  w.serialize(kUartStreamTransportHeaderFormat, length, 0U, msg.stream_id, msg.common.mtype, msg.common.mclass, 0U, 0U);
+  return header;
+}
+
+std::array<std::byte, 4> serialize_uart_stream_payload_dword(std::uint32_t value) {
+  UALINK_TRACE_SCOPED(__func__);
+  std::array<std::byte, 4> dw{};
+  store_be32(dw, value);
+  return dw;
+}
+
+std::vector<std::byte> serialize_uart_stream_transport_message(const UartStreamTransportMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::array<std::byte, 4> header = serialize_uart_stream_transport_header(msg);
+
   std::vector<std::byte> out((1U + msg.payload_dwords.size()) * 4U);
-  {
-    std::array<std::byte, 4> header{};
-    bit_fields::NetworkBitWriter w(header);
-    w.serialize(kUartStreamTransportHeaderFormat, length, 0U, msg.stream_id, msg.common.mtype, msg.common.mclass, 0U, 0U);
-    std::copy(header.begin(), header.end(), out.begin());
-  }
+  std::copy(header.begin(), header.end(), out.begin());
 
   for (std::size_t i = 0; i < msg.payload_dwords.size(); ++i) {
-    std::array<std::byte, 4> dw{};
-    store_be32(dw, msg.payload_dwords[i]);
+    const std::array<std::byte, 4> dw = serialize_uart_stream_payload_dword(msg.payload_dwords[i]);
     std::copy(dw.begin(), dw.end(), out.begin() + (1U + i) * 4U);
   }
 
   return out;
 }
 
-std::optional<UartStreamTransportMessage> deserialize_uart_stream_transport_message(std::span<const std::byte> bytes) {
+std::optional<UartStreamTransportHeader> deserialize_uart_stream_transport_header(std::span<const std::byte, 4> bytes) {
   UALINK_TRACE_SCOPED(__func__);
-  if (bytes.size() < 8 || (bytes.size() % 4) != 0) {
-    return std::nullopt;
-  }
+  bit_fields::NetworkBitReader r(bytes);
 
-  UartStreamTransportMessage msg{};
+  UartStreamTransportHeader header{};
   std::uint8_t length = 0;
   std::uint32_t reserved_hi = 0;
   std::uint8_t reserved = 0;
   std::uint8_t compressed = 0;
-  {
-    std::array<std::byte, 4> header{};
-    std::copy_n(bytes.data(), 4, header.begin());
-    bit_fields::NetworkBitReader r(header);
-    r.deserialize_into(kUartStreamTransportHeaderFormat, length, reserved_hi, msg.stream_id, msg.common.mtype, msg.common.mclass,
-                       reserved, compressed);
-  }
+  r.deserialize_into(kUartStreamTransportHeaderFormat, length, reserved_hi, header.stream_id, header.common.mtype,
+                     header.common.mclass, reserved, compressed);
 
   if (compressed != 0) {
     return std::nullopt;
   }
+  header.payload_dwords = static_cast<std::uint8_t>(length + 1U);
+  return header;
+}
+
+std::uint32_t deserialize_uart_stream_payload_dword(std::span<const std::byte, 4> bytes) {
+  UALINK_TRACE_SCOPED(__func__);
+  return load_be32(bytes);
+}
+
+std::optional<UartStreamTransportMessage> deserialize_uart_stream_transport_message(std::span<const std::byte> bytes) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (bytes.size() < 8 || (bytes.size() % 4) != 0) {
+    return std::nullopt;
+  }
 
-  const std::size_t payload_dwords = static_cast<std::size_t>(length) + 1U;
+  const auto header = deserialize_uart_stream_transport_header(bytes.first<4>());
+  if (!header.has_value()) {
+    return std::nullopt;
+  }
+
+  const std::size_t payload_dwords = header->payload_dwords;
   const std::size_t needed_bytes = (1U + payload_dwords) * 4U;
   if (bytes.size() < needed_bytes) {
     return std::nullopt;
   }
 
+  UartStreamTransportMessage msg{};
+  msg.stream_id = header->stream_id;
+  msg.common = header->common;
   msg.payload_dwords.resize(payload_dwords);
   for (std::size_t i = 0; i < payload_dwords; ++i) {
-    std::array<std::byte, 4> dw{};
-    std::copy_n(bytes.data() + (1U + i) * 4U, 4, dw.begin());
-    msg.payload_dwords[i] = load_be32(dw);
+    msg.payload_dwords[i] = load_be32(bytes.subspan((1U + i) * 4U).first<4>());
   }
 
   return msg;
@@ -139,7 +139,15 @@ bool DlSequenceTracker::is_duplicate(std::uint16_t seq_no) const noexcept {
   return false;
 }
 
-void DlSequenceTracker::advance() noexcept { expected_seq_ = (expected_seq_ + 1) % kSequenceModulo; }
+// Follows the transmitter's wrap_seq(): sequence 0 is never sent, so 511 → 1
+void DlSequenceTracker::advance() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  if (expected_seq_ >= kSequenceModulo - 1U) {
+    expected_seq_ = 1;
+  } else {
+    expected_seq_++;
+  }
+}
 
 std::uint16_t DlSequenceTracker::expected_seq() const noexcept { return expected_seq_; }
 
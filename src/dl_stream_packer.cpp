@@ -0,0 +1,183 @@
+#include "ualink/dl_stream_packer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "ualink/crc.h"
+#include "ualink/dl_message_queue.h"
+
+namespace ualink::dl {
+
+// Bytes the CRC covers: flit header + segment headers + payload
+constexpr std::size_t kCrcCoveredBytes = 3 + kDlSegmentCount + kDlPayloadBytes;
+
+static std::array<std::byte, kCrcCoveredBytes> crc_covered_bytes(const DlFlit &flit) {
+  UALINK_TRACE_SCOPED(__func__);
+  std::array<std::byte, kCrcCoveredBytes> crc_buffer{};
+  std::copy_n(flit.flit_header.begin(), 3, crc_buffer.begin());
+  std::copy_n(flit.segment_headers.begin(), kDlSegmentCount, crc_buffer.begin() + 3);
+  std::copy_n(flit.payload.begin(), kDlPayloadBytes, crc_buffer.begin() + 3 + kDlSegmentCount);
+  return crc_buffer;
+}
+
+DlStreamPacker::DlStreamPacker(const DlAltSectorConfig &alt_sector) : alt_sector_(alt_sector) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(alt_sector_);
+}
+
+DlFlit DlStreamPacker::pack(std::span<const TlFlit> tl_flits, const ExplicitFlitHeaderFields &header,
+                            DlMessageQueue *message_queue, std::size_t *flits_consumed) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlFlit flit{};
+  flit.flit_header = serialize_explicit_flit_header(header);
+  std::array<SegmentHeaderFields, kDlSegmentCount> segment_fields{};
+  std::size_t consumed = 0;
+
+  for (std::size_t segment_index = 0; segment_index < kDlSegmentCount; ++segment_index) {
+    std::size_t position = kSegmentPayloadOffsets[segment_index];
+    const std::size_t region_end = position + kSegmentPayloadBytes[segment_index];
+
+    // Step 1: DL message sector first; unfilled DWords stay zero (No-Op)
+    if (message_queue != nullptr && message_queue->has_pending_messages()) {
+      const std::size_t sector_bytes = alt_sector_bytes(alt_sector_, segment_index);
+      for (std::size_t sector_offset = 0; sector_offset < sector_bytes; sector_offset += 4) {
+        const auto dword = message_queue->pop_next_dword();
+        if (!dword.has_value()) {
+          break;
+        }
+        std::copy_n(dword->begin(), 4, flit.payload.begin() + position + sector_offset);
+      }
+      segment_fields[segment_index].dl_alt_sector = true;
+      position += sector_bytes;
+      stats_.message_bytes += sector_bytes;
+    }
+
+    // Step 2: Finish the TL flit carried in from the previous segment or DL flit
+    if (carry_bytes_sent_ != 0) {
+      const std::size_t count = std::min(kTlFlitBytes - carry_bytes_sent_, region_end - position);
+      std::copy_n(carry_.data.begin() + carry_bytes_sent_, count, flit.payload.begin() + position);
+      carry_bytes_sent_ = (carry_bytes_sent_ + count) % kTlFlitBytes;
+      position += count;
+      stats_.tl_bytes += count;
+    }
+
+    // Step 3: Start new TL flits back to back; at most two start per segment
+    for (std::size_t slot = 0; slot < 2 && position < region_end && consumed < tl_flits.size(); ++slot) {
+      const TlFlit &tl_flit = tl_flits[consumed];
+      const std::size_t count = std::min(kTlFlitBytes, region_end - position);
+      std::copy_n(tl_flit.data.begin(), count, flit.payload.begin() + position);
+
+      const std::uint8_t message_field = tl_flit.message_field & 0x3U;
+      if (slot == 0) {
+        segment_fields[segment_index].tl_flit0_present = true;
+        segment_fields[segment_index].message0 = message_field;
+      } else {
+        segment_fields[segment_index].tl_flit1_present = true;
+        segment_fields[segment_index].message1 = message_field;
+      }
+
+      // Straddles the region end: keep it to finish in the next region
+      if (count < kTlFlitBytes) {
+        carry_ = tl_flit;
+        carry_bytes_sent_ = count;
+      }
+      position += count;
+      consumed++;
+      stats_.tl_flits_started++;
+      stats_.tl_bytes += count;
+    }
+
+    stats_.padding_bytes += region_end - position;
+  }
+
+  for (std::size_t segment_index = 0; segment_index < kDlSegmentCount; ++segment_index) {
+    flit.segment_headers[segment_index] = serialize_segment_header(segment_fields[segment_index]);
+  }
+  flit.crc = compute_crc32(crc_covered_bytes(flit));
+
+  stats_.dl_flits++;
+  if (flits_consumed != nullptr) {
+    *flits_consumed = consumed;
+  }
+  return flit;
+}
+
+DlStreamDepacker::DlStreamDepacker(const DlAltSectorConfig &alt_sector) : alt_sector_(alt_sector) {
+  UALINK_TRACE_SCOPED(__func__);
+  validate_alt_sector(alt_sector_);
+}
+
+DlDeserializedResult DlStreamDepacker::unpack(const DlFlit &flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Work on a copy of the carry so a malformed flit leaves state unchanged
+  TlFlit carry = carry_;
+  std::size_t carry_bytes = carry_bytes_received_;
+  DlDeserializedResult result;
+
+  for (std::size_t segment_index = 0; segment_index < kDlSegmentCount; ++segment_index) {
+    const SegmentHeaderFields header = deserialize_segment_header(flit.segment_headers[segment_index]);
+    std::size_t position = kSegmentPayloadOffsets[segment_index];
+    const std::size_t region_end = position + kSegmentPayloadBytes[segment_index];
+
+    if (header.dl_alt_sector) {
+      const std::size_t sector_bytes = alt_sector_bytes(alt_sector_, segment_index);
+      for (std::size_t sector_offset = 0; sector_offset < sector_bytes; sector_offset += 4) {
+        std::array<std::byte, 4> dword{};
+        std::copy_n(flit.payload.begin() + position + sector_offset, 4, dword.begin());
+        result.dl_message_dwords.push_back(dword);
+      }
+      position += sector_bytes;
+    }
+
+    // Continuation of the carried TL flit
+    if (carry_bytes != 0) {
+      const std::size_t count = std::min(kTlFlitBytes - carry_bytes, region_end - position);
+      std::copy_n(flit.payload.begin() + position, count, carry.data.begin() + carry_bytes);
+      carry_bytes = (carry_bytes + count) % kTlFlitBytes;
+      position += count;
+      if (carry_bytes == 0) {
+        result.tl_flits.push_back(carry);
+      }
+    }
+
+    // TL flits starting in this segment
+    const std::array<bool, 2> starts = {header.tl_flit0_present, header.tl_flit1_present};
+    const std::array<std::uint8_t, 2> message_fields = {header.message0, header.message1};
+    for (std::size_t slot = 0; slot < starts.size(); ++slot) {
+      if (!starts[slot]) {
+        continue;
+      }
+      if (carry_bytes != 0 || position >= region_end) {
+        throw std::invalid_argument("DlStreamDepacker::unpack: TL flit start with no room in segment");
+      }
+
+      carry.message_field = message_fields[slot];
+      const std::size_t count = std::min(kTlFlitBytes, region_end - position);
+      std::copy_n(flit.payload.begin() + position, count, carry.data.begin());
+      carry_bytes = count % kTlFlitBytes;
+      position += count;
+      if (carry_bytes == 0) {
+        result.tl_flits.push_back(carry);
+      }
+    }
+  }
+
+  carry_ = carry;
+  carry_bytes_received_ = carry_bytes;
+  stats_.dl_flits++;
+  stats_.tl_flits += result.tl_flits.size();
+  return result;
+}
+
+std::optional<DlDeserializedResult> DlStreamDepacker::unpack_with_crc_check(const DlFlit &flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!verify_crc32(crc_covered_bytes(flit), flit.crc)) {
+    return std::nullopt;
+  }
+  return unpack(flit);
+}
+
+} // namespace ualink::dl
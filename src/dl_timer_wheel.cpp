@@ -0,0 +1,199 @@
+#include "ualink/dl_timer_wheel.h"
+
+#include <stdexcept>
+
+namespace ualink::dl {
+
+DlTimerWheel::DlTimerWheel(const Config &config) : config_(config) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (config.capacity == 0 || config.capacity >= kNil) {
+    throw std::invalid_argument("DlTimerWheel: capacity must be 1..2^32-2");
+  }
+  if (config.tick_us == 0) {
+    throw std::invalid_argument("DlTimerWheel: tick_us must be non-zero");
+  }
+
+  // Every node starts on the free list; nothing allocates after this
+  nodes_.resize(config.capacity);
+  for (std::size_t index = 0; index + 1 < nodes_.size(); ++index) {
+    nodes_[index].next = static_cast<std::uint32_t>(index + 1);
+  }
+  free_head_ = 0;
+  slot_heads_.fill(kNil);
+  batch_.reserve(config.capacity);
+}
+
+DlTimerHandle DlTimerWheel::schedule(DlTimerKind kind, std::uint32_t link_id, std::uint16_t tag,
+                                     std::uint64_t deadline_us) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (free_head_ == kNil) {
+    throw std::length_error("DlTimerWheel::schedule: all timers in use");
+  }
+
+  const std::uint32_t index = free_head_;
+  Node &node = nodes_[index];
+  free_head_ = node.next;
+
+  node.expiry = DlTimerExpiry{kind, link_id, tag, deadline_us};
+  node.expire_tick = deadline_tick(deadline_us);
+  place(index);
+
+  active_timers_++;
+  stats_.scheduled++;
+  return DlTimerHandle{index, node.generation};
+}
+
+bool DlTimerWheel::cancel(DlTimerHandle handle) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (handle.index >= nodes_.size()) {
+    return false;
+  }
+  const Node &node = nodes_[handle.index];
+  if (node.slot == kNil || node.generation != handle.generation) {
+    return false;
+  }
+
+  unlink(handle.index);
+  release(handle.index);
+  stats_.cancelled++;
+  return true;
+}
+
+std::size_t DlTimerWheel::advance(std::uint64_t now_us, const ExpiryBatchCallback &on_expired) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (now_us < config_.start_us) {
+    return 0;
+  }
+  const std::uint64_t target_tick = (now_us - config_.start_us) / config_.tick_us;
+
+  std::size_t expired = 0;
+  while (next_tick_ <= target_tick) {
+    // Idle wheel: nothing can fire or cascade, so jump straight to now
+    if (active_timers_ == 0) {
+      next_tick_ = target_tick + 1;
+      break;
+    }
+
+    run_tick();
+    if (batch_.empty()) {
+      continue;
+    }
+
+    expired += batch_.size();
+    stats_.expired += batch_.size();
+    stats_.expiry_batches++;
+    if (on_expired) {
+      on_expired(batch_);
+    }
+    batch_.clear();
+  }
+  return expired;
+}
+
+std::uint64_t DlTimerWheel::deadline_tick(std::uint64_t deadline_us) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (deadline_us <= config_.start_us) {
+    return 0;
+  }
+  // First tick whose time is at or after the deadline
+  return ((deadline_us - config_.start_us) + config_.tick_us - 1) / config_.tick_us;
+}
+
+void DlTimerWheel::place(std::uint32_t index) {
+  UALINK_TRACE_SCOPED(__func__);
+  Node &node = nodes_[index];
+
+  // Overdue timers fire on the next tick; far ones park in the top level
+  std::uint64_t tick = node.expire_tick;
+  if (tick < next_tick_) {
+    tick = next_tick_;
+  }
+  std::uint64_t delta = tick - next_tick_;
+  if (delta > kMaxDeltaTicks) {
+    delta = kMaxDeltaTicks;
+    tick = next_tick_ + kMaxDeltaTicks;
+  }
+
+  std::size_t level = 0;
+  while (level + 1 < kLevels && delta >= (std::uint64_t{1} << ((level + 1) * kSlotBits))) {
+    level++;
+  }
+  const auto slot = static_cast<std::uint32_t>((level * kSlotsPerLevel) + ((tick >> (level * kSlotBits)) & kSlotMask));
+
+  node.slot = slot;
+  node.prev = kNil;
+  node.next = slot_heads_[slot];
+  if (node.next != kNil) {
+    nodes_[node.next].prev = index;
+  }
+  slot_heads_[slot] = index;
+}
+
+void DlTimerWheel::unlink(std::uint32_t index) {
+  UALINK_TRACE_SCOPED(__func__);
+  Node &node = nodes_[index];
+  if (node.prev != kNil) {
+    nodes_[node.prev].next = node.next;
+  } else {
+    slot_heads_[node.slot] = node.next;
+  }
+  if (node.next != kNil) {
+    nodes_[node.next].prev = node.prev;
+  }
+}
+
+void DlTimerWheel::release(std::uint32_t index) {
+  UALINK_TRACE_SCOPED(__func__);
+  Node &node = nodes_[index];
+  node.slot = kNil;
+  node.prev = kNil;
+  node.generation++; // Invalidates outstanding handles
+  node.next = free_head_;
+  free_head_ = index;
+  active_timers_--;
+}
+
+void DlTimerWheel::cascade(std::size_t level, std::uint64_t tick) {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::size_t slot = (level * kSlotsPerLevel) + ((tick >> (level * kSlotBits)) & kSlotMask);
+
+  std::uint32_t index = slot_heads_[slot];
+  slot_heads_[slot] = kNil;
+  while (index != kNil) {
+    const std::uint32_t next = nodes_[index].next;
+    place(index);
+    stats_.cascaded++;
+    index = next;
+  }
+}
+
+void DlTimerWheel::run_tick() {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::uint64_t tick = next_tick_;
+
+  // Each time a level wraps, pull the next slot of the level above down
+  for (std::size_t level = 1; level < kLevels; ++level) {
+    if (((tick >> ((level - 1) * kSlotBits)) & kSlotMask) != 0) {
+      break;
+    }
+    cascade(level, tick);
+  }
+
+  // Everything left in this level-0 slot expires now
+  std::uint32_t index = slot_heads_[tick & kSlotMask];
+  slot_heads_[tick & kSlotMask] = kNil;
+  while (index != kNil) {
+    const std::uint32_t next = nodes_[index].next;
+    batch_.push_back(nodes_[index].expiry);
+    release(index);
+    index = next;
+  }
+
+  next_tick_++;
+}
+
+} // namespace ualink::dl
@@ -0,0 +1,110 @@
+#include "ualink/dl_uart_reassembly.h"
+
+#include <stdexcept>
+
+namespace ualink::dl {
+
+static std::uint8_t stream_bit(std::uint8_t stream_id) {
+  UALINK_TRACE_SCOPED(__func__);
+  return static_cast<std::uint8_t>(1U << stream_id);
+}
+
+std::optional<std::uint8_t> UartStreamReassemblyPool::begin(std::span<const std::byte, 4> header_dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto header = deserialize_uart_stream_transport_header(header_dword);
+  if (!header.has_value() || header->common.mclass != static_cast<std::uint8_t>(DlMessageClass::kUart) ||
+      header->common.mtype != static_cast<std::uint8_t>(DlUartMessageType::kStreamTransportMessage)) {
+    return std::nullopt;
+  }
+
+  StreamBuffer &buffer = buffer_for(header->stream_id);
+  if (in_progress(header->stream_id)) {
+    stats_.messages_abandoned++;
+  }
+
+  buffer.dwords[0] = deserialize_uart_stream_payload_dword(header_dword);
+  buffer.payload_expected = header->payload_dwords;
+  buffer.payload_received = 0;
+  buffer.completed = UartStreamTransportView{};
+
+  active_streams_ |= stream_bit(header->stream_id);
+  stats_.messages_started++;
+  return header->stream_id;
+}
+
+const UartStreamTransportView *UartStreamReassemblyPool::append(std::uint8_t stream_id, std::uint32_t payload_dword) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  StreamBuffer &buffer = buffer_for(stream_id);
+  if (!in_progress(stream_id)) {
+    throw std::logic_error("UartStreamReassemblyPool::append: no message in progress on stream");
+  }
+
+  buffer.payload_received++;
+  buffer.dwords[buffer.payload_received] = payload_dword;
+  if (buffer.payload_received < buffer.payload_expected) {
+    return nullptr;
+  }
+
+  // Message complete: publish a view of the payload in place
+  buffer.completed.stream_id = stream_id;
+  buffer.completed.payload_dwords = std::span<const std::uint32_t>(buffer.dwords).subspan(1, buffer.payload_expected);
+  active_streams_ &= static_cast<std::uint8_t>(~stream_bit(stream_id));
+  stats_.messages_completed++;
+  return &buffer.completed;
+}
+
+bool UartStreamReassemblyPool::in_progress(std::uint8_t stream_id) const {
+  UALINK_TRACE_SCOPED(__func__);
+  [[maybe_unused]] const StreamBuffer &buffer = buffer_for(stream_id);
+  return (active_streams_ & stream_bit(stream_id)) != 0;
+}
+
+std::size_t UartStreamReassemblyPool::payload_dwords_remaining(std::uint8_t stream_id) const {
+  UALINK_TRACE_SCOPED(__func__);
+  const StreamBuffer &buffer = buffer_for(stream_id);
+  if (!in_progress(stream_id)) {
+    return 0;
+  }
+  return buffer.payload_expected - buffer.payload_received;
+}
+
+void UartStreamReassemblyPool::reset(std::uint8_t stream_id) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  StreamBuffer &buffer = buffer_for(stream_id);
+  if (in_progress(stream_id)) {
+    stats_.messages_abandoned++;
+  }
+  buffer.payload_expected = 0;
+  buffer.payload_received = 0;
+  buffer.completed = UartStreamTransportView{};
+  active_streams_ &= static_cast<std::uint8_t>(~stream_bit(stream_id));
+}
+
+void UartStreamReassemblyPool::reset_all() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  for (std::uint8_t stream_id = 0; stream_id < kUartStreamCount; ++stream_id) {
+    reset(stream_id);
+  }
+}
+
+UartStreamReassemblyPool::StreamBuffer &UartStreamReassemblyPool::buffer_for(std::uint8_t stream_id) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (stream_id >= kUartStreamCount) {
+    throw std::invalid_argument("UartStreamReassemblyPool: stream_id must be 0..7");
+  }
+  return pool_[stream_id];
+}
+
+const UartStreamReassemblyPool::StreamBuffer &UartStreamReassemblyPool::buffer_for(std::uint8_t stream_id) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (stream_id >= kUartStreamCount) {
+    throw std::invalid_argument("UartStreamReassemblyPool: stream_id must be 0..7");
+  }
+  return pool_[stream_id];
+}
+
+} // namespace ualink::dl
@@ -0,0 +1,39 @@
+#include "ualink/prng.h"
+
+#include <cmath>
+
+#include "ualink/trace.h"
+
+using namespace ualink;
+
+void Xoshiro256StarStar::reseed(std::uint64_t seed) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // SplitMix64 expansion - never produces the all-zero state
+  for (auto &word : state_) {
+    seed += 0x9E3779B97F4A7C15ULL;
+    std::uint64_t mixed = seed;
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+    word = mixed ^ (mixed >> 31);
+  }
+}
+
+std::uint64_t ualink::sample_geometric_gap(Xoshiro256StarStar &rng, double probability) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (probability <= 0.0) {
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+  if (probability >= 1.0) {
+    return 0;
+  }
+
+  // Inverse CDF with u in (0, 1]; log1p keeps precision for tiny probabilities
+  const double uniform = 1.0 - rng.next_double();
+  const double gap = std::floor(std::log(uniform) / std::log1p(-probability));
+  if (gap >= static_cast<double>(std::numeric_limits<std::uint64_t>::max())) {
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+  return static_cast<std::uint64_t>(gap);
+}
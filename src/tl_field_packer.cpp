@@ -0,0 +1,422 @@
+#include "ualink/tl_field_packer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ualink::tl {
+
+constexpr std::size_t kUncompressedRequestBytes = 16;
+
+// Compressed CMD encodings (Table 5-33)
+constexpr std::uint8_t kCompressedCmdRead = 0b000;
+constexpr std::uint8_t kCompressedCmdWrite = 0b100;
+constexpr std::uint8_t kCompressedCmdWriteFull = 0b110;
+
+// Uncompressed ADDR is ReqAddr[56:2]: the 1MB region is ReqAddr[56:20] and
+// the compressed ADDR is ReqAddr[19:6]
+constexpr unsigned kRegionShift = 18;
+constexpr unsigned kBlockShift = 4;
+constexpr std::uint64_t kCompressedAddrMask = 0x3FFFU;
+
+// =============================================================================
+// TlAddressCache
+// =============================================================================
+
+TlAddressCache::TlAddressCache()
+    : regions_(kTlAddressCacheStreams * kTlAddressCacheWays, kInvalidRegion), next_victim_(kTlAddressCacheStreams, 0) {
+  UALINK_TRACE_SCOPED(__func__);
+}
+
+std::optional<std::uint8_t> TlAddressCache::lookup(std::uint16_t stream, std::uint64_t region) const {
+  UALINK_TRACE_SCOPED(__func__);
+  for (std::uint8_t way = 0; way < kTlAddressCacheWays; ++way) {
+    if (regions_[(stream * kTlAddressCacheWays) + way] == region) {
+      return way;
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<std::uint64_t> TlAddressCache::region(std::uint16_t stream, std::uint8_t way) const {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::uint64_t loaded = regions_[(stream * kTlAddressCacheWays) + way];
+  if (loaded == kInvalidRegion) {
+    return std::nullopt;
+  }
+  return loaded;
+}
+
+std::uint8_t TlAddressCache::victim(std::uint16_t stream) const {
+  UALINK_TRACE_SCOPED(__func__);
+  return next_victim_[stream];
+}
+
+std::uint8_t TlAddressCache::allocate(std::uint16_t stream, std::uint64_t region) {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::uint8_t way = next_victim_[stream];
+  next_victim_[stream] = static_cast<std::uint8_t>((way + 1) % kTlAddressCacheWays);
+  load(stream, way, region);
+  return way;
+}
+
+void TlAddressCache::load(std::uint16_t stream, std::uint8_t way, std::uint64_t region) {
+  UALINK_TRACE_SCOPED(__func__);
+  regions_[(stream * kTlAddressCacheWays) + way] = region;
+}
+
+void TlAddressCache::clear() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  std::fill(regions_.begin(), regions_.end(), kInvalidRegion);
+  std::fill(next_victim_.begin(), next_victim_.end(), std::uint8_t{0});
+}
+
+// =============================================================================
+// Compression rules
+// =============================================================================
+
+static std::optional<std::uint8_t> compressed_cmd(std::uint8_t req_cmd) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (req_cmd == kTlReqCmdRead) {
+    return kCompressedCmdRead;
+  }
+  if (req_cmd == kTlReqCmdWrite) {
+    return kCompressedCmdWrite;
+  }
+  if (req_cmd == kTlReqCmdWriteFull) {
+    return kCompressedCmdWriteFull;
+  }
+  return std::nullopt;
+}
+
+static std::optional<std::uint8_t> req_cmd_from_compressed(std::uint8_t cmd) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (cmd == kCompressedCmdRead) {
+    return kTlReqCmdRead;
+  }
+  if (cmd == kCompressedCmdWrite) {
+    return kTlReqCmdWrite;
+  }
+  if (cmd == kCompressedCmdWriteFull) {
+    return kTlReqCmdWriteFull;
+  }
+  return std::nullopt;
+}
+
+// Every Table 5-32 restriction except the cache hit; ADDR and CWAY are left
+// for the caller. nullopt if the request must go uncompressed.
+static std::optional<CompressedRequestField> compress_request(const UncompressedRequestField &f) {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::optional<std::uint8_t> cmd = compressed_cmd(f.cmd);
+  if (!cmd.has_value() || f.srcaccid >= kTlAddressCacheStreams || (f.addr >> 55) != 0 || f.metadata > 0x7U) {
+    return std::nullopt;
+  }
+
+  // 64/128/192/256 bytes: LEN (DWords - 1) of 15/31/47/63
+  const std::size_t dwords = static_cast<std::size_t>(f.len) + 1;
+  const std::size_t blocks = dwords / 16;
+  if (dwords % 16 != 0 || (f.addr & 0xFU) != 0 || ((f.addr >> kBlockShift) & 0x3U) + blocks > 4) {
+    return std::nullopt;
+  }
+
+  const bool is_read = (f.cmd == kTlReqCmdRead);
+  if (is_read && (f.attr != 0xFF || f.numbeats != 0)) {
+    return std::nullopt;
+  }
+  if (!is_read && (f.attr != 0x00 || f.numbeats != blocks - 1)) {
+    return std::nullopt;
+  }
+
+  CompressedRequestField compressed{};
+  compressed.cmd = *cmd;
+  compressed.vchan = f.vchan;
+  compressed.asi = f.asi;
+  compressed.tag = f.tag;
+  compressed.pool = f.pool;
+  compressed.len = static_cast<std::uint8_t>(blocks - 1);
+  compressed.metadata = f.metadata;
+  compressed.addr = static_cast<std::uint16_t>((f.addr >> kBlockShift) & kCompressedAddrMask);
+  compressed.srcaccid = f.srcaccid;
+  compressed.dstaccid = f.dstaccid;
+  return compressed;
+}
+
+static bool compresses_single_beat_read(const UncompressedResponseField &f) {
+  UALINK_TRACE_SCOPED(__func__);
+  return f.status == 0 && f.spares == 0 && !f.rd_wr && f.len == 0;
+}
+
+static bool compresses_write_or_multi_beat_read(const UncompressedResponseField &f) {
+  UALINK_TRACE_SCOPED(__func__);
+  return f.status == 0 && f.spares == 0 && f.offset == 0 && !f.last && (f.rd_wr || f.len != 0);
+}
+
+// =============================================================================
+// TlFieldPacker
+// =============================================================================
+
+void TlFieldPacker::push(const TlControlField &field) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (const auto *request = std::get_if<UncompressedRequestField>(&field)) {
+    push_request(*request);
+  } else if (const auto *response = std::get_if<UncompressedResponseField>(&field)) {
+    push_response(*response);
+  } else {
+    const std::array<std::byte, 4> bytes = serialize_flow_control_nop_field(std::get<FlowControlNopField>(field));
+    stats_.uncompressed_bytes += bytes.size();
+    stats_.flow_control_fields++;
+    place(bytes);
+  }
+}
+
+void TlFieldPacker::push_request(const UncompressedRequestField &request) {
+  UALINK_TRACE_SCOPED(__func__);
+  std::optional<CompressedRequestField> compressed = compress_request(request);
+  const std::uint64_t region = request.addr >> kRegionShift;
+
+  if (compressed.has_value()) {
+    const std::optional<std::uint8_t> way = address_cache_.lookup(request.srcaccid, region);
+    if (way.has_value()) {
+      compressed->cway = *way;
+      const std::array<std::byte, 8> bytes = serialize_compressed_request_field(*compressed);
+      stats_.uncompressed_bytes += kUncompressedRequestBytes;
+      stats_.requests_compressed++;
+      place(bytes);
+      return;
+    }
+  }
+
+  // Miss (or not compressible): send uncompressed, loading the region if a
+  // later request to it could compress
+  UncompressedRequestField wire = request;
+  wire.cload = false;
+  wire.cway = 0;
+  if (compressed.has_value()) {
+    wire.cload = true;
+    wire.cway = address_cache_.victim(request.srcaccid);
+  }
+  const std::array<std::byte, kUncompressedRequestBytes> bytes = serialize_uncompressed_request_field(wire);
+  if (compressed.has_value()) {
+    // Only after serialization succeeds, so a rejected field leaves the cache alone
+    [[maybe_unused]] const std::uint8_t way = address_cache_.allocate(request.srcaccid, region);
+  }
+  stats_.uncompressed_bytes += bytes.size();
+  stats_.requests_uncompressed++;
+  place(bytes);
+}
+
+void TlFieldPacker::push_response(const UncompressedResponseField &response) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (compresses_single_beat_read(response)) {
+    CompressedSingleBeatReadResponseField single{};
+    single.vchan = response.vchan;
+    single.tag = response.tag;
+    single.pool = response.pool;
+    single.dstaccid = response.dstaccid;
+    single.offset = response.offset;
+    single.last = response.last;
+    const std::array<std::byte, 4> bytes = serialize_compressed_single_beat_read_response_field(single);
+    stats_.uncompressed_bytes += 8;
+    stats_.responses_compressed++;
+    place(bytes);
+    return;
+  }
+
+  if (compresses_write_or_multi_beat_read(response)) {
+    CompressedWriteOrMultiBeatReadResponseField multi{};
+    multi.vchan = response.vchan;
+    multi.tag = response.tag;
+    multi.pool = response.pool;
+    multi.dstaccid = response.dstaccid;
+    multi.len = response.len;
+    multi.rd_wr = response.rd_wr;
+    const std::array<std::byte, 4> bytes = serialize_compressed_write_or_multibeat_read_response_field(multi);
+    stats_.uncompressed_bytes += 8;
+    stats_.responses_compressed++;
+    place(bytes);
+    return;
+  }
+
+  const std::array<std::byte, 8> bytes = serialize_uncompressed_response_field(response);
+  stats_.uncompressed_bytes += bytes.size();
+  stats_.responses_uncompressed++;
+  place(bytes);
+}
+
+void TlFieldPacker::place(std::span<const std::byte> field_bytes) {
+  UALINK_TRACE_SCOPED(__func__);
+  // Footprints are 1, 2 or 4 sectors, each aligned to its own size
+  const std::size_t sectors = field_bytes.size() / kTlSectorBytes;
+  std::size_t start = ((next_sector_ + sectors - 1) / sectors) * sectors;
+  if (start + sectors > kTlSectorsPerFlit) {
+    close_flit();
+    start = 0;
+  }
+
+  stats_.padding_bytes += (start - next_sector_) * kTlSectorBytes;
+  std::copy(field_bytes.begin(), field_bytes.end(), current_.begin() + (start * kTlSectorBytes));
+  next_sector_ = start + sectors;
+  stats_.field_bytes += field_bytes.size();
+
+  if (next_sector_ == kTlSectorsPerFlit) {
+    close_flit();
+  }
+}
+
+void TlFieldPacker::close_flit() {
+  UALINK_TRACE_SCOPED(__func__);
+  if (next_sector_ == 0) {
+    return;
+  }
+  stats_.padding_bytes += (kTlSectorsPerFlit - next_sector_) * kTlSectorBytes;
+  if (flit_sink_) {
+    flit_sink_(current_);
+  } else {
+    flits_.push_back(current_);
+  }
+  current_.fill(std::byte{0});
+  next_sector_ = 0;
+  stats_.flits++;
+}
+
+void TlFieldPacker::flush() {
+  UALINK_TRACE_SCOPED(__func__);
+  close_flit();
+}
+
+std::vector<std::array<std::byte, kTlFlitBytes>> TlFieldPacker::take_flits() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::vector<std::array<std::byte, kTlFlitBytes>> flits;
+  flits.swap(flits_);
+  return flits;
+}
+
+// =============================================================================
+// TlFieldUnpacker
+// =============================================================================
+
+// Sectors occupied by a field of the given FTYPE; 0 for reserved encodings
+static std::size_t field_sectors(std::uint8_t ftype) {
+  UALINK_TRACE_SCOPED(__func__);
+  switch (static_cast<TlFieldType>(ftype)) {
+  case TlFieldType::kUncompressedRequest:
+    return 4;
+  case TlFieldType::kUncompressedResponse:
+  case TlFieldType::kCompressedRequest:
+    return 2;
+  case TlFieldType::kFlowControlNop:
+  case TlFieldType::kCompressedResponseSingleBeatRead:
+  case TlFieldType::kCompressedResponseWriteOrMultiBeatRead:
+    return 1;
+  }
+  return 0;
+}
+
+static UncompressedRequestField expand_request(const CompressedRequestField &c, std::uint64_t region) {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::optional<std::uint8_t> req_cmd = req_cmd_from_compressed(c.cmd);
+  if (!req_cmd.has_value()) {
+    throw std::invalid_argument("TlFieldUnpacker::unpack: reserved compressed CMD");
+  }
+
+  UncompressedRequestField f{};
+  f.cmd = *req_cmd;
+  f.vchan = c.vchan;
+  f.asi = c.asi;
+  f.tag = c.tag;
+  f.pool = c.pool;
+  f.len = static_cast<std::uint8_t>(((c.len + 1) * 16) - 1);
+  f.metadata = c.metadata;
+  f.addr = (region << kRegionShift) | (static_cast<std::uint64_t>(c.addr) << kBlockShift);
+  f.srcaccid = c.srcaccid;
+  f.dstaccid = c.dstaccid;
+  if (*req_cmd == kTlReqCmdRead) {
+    f.attr = 0xFF;
+  } else {
+    f.numbeats = c.len;
+  }
+  return f;
+}
+
+std::vector<TlControlField> TlFieldUnpacker::unpack(std::span<const std::byte, kTlFlitBytes> flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::vector<TlControlField> fields;
+  unpack(flit, [&fields](const TlControlField &field) { fields.push_back(field); });
+  return fields;
+}
+
+void TlFieldUnpacker::unpack(std::span<const std::byte, kTlFlitBytes> flit,
+                             const std::function<void(const TlControlField &)> &on_field) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::size_t sector = 0;
+  while (sector < kTlSectorsPerFlit) {
+    const std::span<const std::byte> remaining = flit.subspan(sector * kTlSectorBytes);
+    const std::uint8_t ftype = static_cast<std::uint8_t>(remaining[0]) >> 4;
+    const std::size_t sectors = field_sectors(ftype);
+    if (sectors == 0 || sector % sectors != 0) {
+      throw std::invalid_argument("TlFieldUnpacker::unpack: reserved FTYPE or misaligned field");
+    }
+
+    switch (static_cast<TlFieldType>(ftype)) {
+    case TlFieldType::kFlowControlNop: {
+      const FlowControlNopField fc = *deserialize_flow_control_nop_field(remaining.first<4>());
+      if (fc.req_cmd != 0 || fc.rsp_cmd != 0 || fc.req_data != 0 || fc.rsp_data != 0) {
+        on_field(fc);
+      }
+      break;
+    }
+    case TlFieldType::kUncompressedRequest: {
+      UncompressedRequestField request = *deserialize_uncompressed_request_field(remaining.first<16>());
+      if (request.cload) {
+        address_cache_.load(request.srcaccid, request.cway, request.addr >> kRegionShift);
+      }
+      request.cload = false;
+      request.cway = 0;
+      on_field(request);
+      break;
+    }
+    case TlFieldType::kCompressedRequest: {
+      const CompressedRequestField compressed = *deserialize_compressed_request_field(remaining.first<8>());
+      const std::optional<std::uint64_t> region = address_cache_.region(compressed.srcaccid, compressed.cway);
+      if (!region.has_value()) {
+        throw std::invalid_argument("TlFieldUnpacker::unpack: compressed request to unloaded cache way");
+      }
+      on_field(expand_request(compressed, *region));
+      break;
+    }
+    case TlFieldType::kUncompressedResponse:
+      on_field(*deserialize_uncompressed_response_field(remaining.first<8>()));
+      break;
+    case TlFieldType::kCompressedResponseSingleBeatRead: {
+      const auto single = *deserialize_compressed_single_beat_read_response_field(remaining.first<4>());
+      UncompressedResponseField response{};
+      response.vchan = single.vchan;
+      response.tag = single.tag;
+      response.pool = single.pool;
+      response.dstaccid = single.dstaccid;
+      response.offset = single.offset;
+      response.last = single.last;
+      on_field(response);
+      break;
+    }
+    case TlFieldType::kCompressedResponseWriteOrMultiBeatRead: {
+      const auto multi = *deserialize_compressed_write_or_multibeat_read_response_field(remaining.first<4>());
+      UncompressedResponseField response{};
+      response.vchan = multi.vchan;
+      response.tag = multi.tag;
+      response.pool = multi.pool;
+      response.dstaccid = multi.dstaccid;
+      response.len = multi.len;
+      response.rd_wr = multi.rd_wr;
+      on_field(response);
+      break;
+    }
+    }
+    sector += sectors;
+  }
+}
+
+} // namespace ualink::tl
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <stdexcept>
 
 using namespace ualink::tl;
 
@@ -259,3 +260,132 @@ std::optional<TlWriteCompletion> TlDeserializer::deserialize_write_completion(
 
   return completion;
 }
+
+std::array<std::byte, kTlHalfFlitBytes> TlSerializer::serialize_read_request_half(const TlReadRequest& request) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlRequestHeader header = request.header;
+  header.half_flit = true;
+
+  std::array<std::byte, kTlHalfFlitBytes> half_flit{};
+  const std::array<std::byte, 8> header_bytes = serialize_tl_request_header(header);
+  std::copy_n(header_bytes.begin(), 8, half_flit.begin());
+
+  return half_flit;
+}
+
+std::array<std::byte, kTlHalfFlitBytes> TlSerializer::serialize_write_completion_half(
+    const TlWriteCompletion& completion) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlResponseHeader header = completion.header;
+  header.half_flit = true;
+
+  std::array<std::byte, kTlHalfFlitBytes> half_flit{};
+  const std::array<std::byte, 4> header_bytes = serialize_tl_response_header(header);
+  std::copy_n(header_bytes.begin(), 4, half_flit.begin());
+
+  return half_flit;
+}
+
+TlOpcode TlDeserializer::deserialize_opcode(std::span<const std::byte, kTlHalfFlitBytes> half_flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::uint8_t first_byte = static_cast<std::uint8_t>(half_flit[0]);
+  return static_cast<TlOpcode>((first_byte >> 5) & 0x7U);
+}
+
+std::optional<TlReadRequest> TlDeserializer::deserialize_read_request_half(
+    std::span<const std::byte, kTlHalfFlitBytes> half_flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (deserialize_opcode(half_flit) != TlOpcode::kReadRequest || !is_half_flit(half_flit[0])) {
+    return std::nullopt;
+  }
+
+  TlReadRequest request{};
+  request.header = deserialize_tl_request_header(half_flit.first<8>());
+  return request;
+}
+
+std::optional<TlWriteCompletion> TlDeserializer::deserialize_write_completion_half(
+    std::span<const std::byte, kTlHalfFlitBytes> half_flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (deserialize_opcode(half_flit) != TlOpcode::kWriteCompletion || !is_half_flit(half_flit[0])) {
+    return std::nullopt;
+  }
+
+  TlWriteCompletion completion{};
+  completion.header = deserialize_tl_response_header(half_flit.first<4>());
+  return completion;
+}
+
+void TlHalfFlitPacker::push_flit(std::span<const std::byte, kTlFlitBytes> flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  flush();
+  std::array<std::byte, kTlFlitBytes>& slot = slots_.emplace_back();
+  std::copy_n(flit.begin(), kTlFlitBytes, slot.begin());
+  stats_.full_slots++;
+}
+
+void TlHalfFlitPacker::push_half_flit(std::span<const std::byte, kTlHalfFlitBytes> half_flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!is_half_flit(half_flit[0])) {
+    throw std::invalid_argument("TlHalfFlitPacker::push_half_flit: half_flit bit not set");
+  }
+
+  if (!pending_half_) {
+    pending_slot_.fill(std::byte{0});
+    std::copy_n(half_flit.begin(), kTlHalfFlitBytes, pending_slot_.begin());
+    pending_half_ = true;
+    return;
+  }
+
+  std::copy_n(half_flit.begin(), kTlHalfFlitBytes, pending_slot_.begin() + kTlHalfFlitBytes);
+  slots_.push_back(pending_slot_);
+  pending_half_ = false;
+  stats_.paired_slots++;
+}
+
+void TlHalfFlitPacker::flush() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!pending_half_) {
+    return;
+  }
+  // Second half stays zero, so its half_flit bit reads as "empty"
+  slots_.push_back(pending_slot_);
+  pending_half_ = false;
+  stats_.single_half_slots++;
+}
+
+std::vector<std::array<std::byte, kTlFlitBytes>> TlHalfFlitPacker::take_slots() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::vector<std::array<std::byte, kTlFlitBytes>> slots;
+  slots.swap(slots_);
+  return slots;
+}
+
+TlSlotContents ualink::tl::unpack_tl_slot(std::span<const std::byte, kTlFlitBytes> slot) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlSlotContents contents{};
+  if (!is_half_flit(slot[0])) {
+    contents.full_flit = true;
+    return contents;
+  }
+
+  for (std::size_t half_index = 0; half_index < contents.half_flits.size(); ++half_index) {
+    const std::size_t offset = half_index * kTlHalfFlitBytes;
+    if (!is_half_flit(slot[offset])) {
+      break;
+    }
+    std::copy_n(slot.begin() + offset, kTlHalfFlitBytes, contents.half_flits[half_index].begin());
+    contents.half_flit_count++;
+  }
+  return contents;
+}
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
+
+#include "ualink/dl_tx_pipeline.h"
 
 using namespace ualink;
 using namespace ualink::tl;
@@ -43,7 +46,7 @@ UaLinkEndpoint::UaLinkEndpoint(const EndpointConfig &config)
   }
 }
 
-std::uint16_t UaLinkEndpoint::send_read_request(std::uint64_t address, std::uint8_t size) {
+std::optional<std::uint16_t> UaLinkEndpoint::send_read_request(std::uint64_t address, std::uint8_t size) {
   UALINK_TRACE_SCOPED(__func__);
 
   if (!transmit_callback_) {
@@ -69,15 +72,18 @@ std::uint16_t UaLinkEndpoint::send_read_request(std::uint64_t address, std::uint
   std::copy_n(tl_flit_bytes.begin(), tl::kTlFlitBytes, tl_flit.data.begin());
   tl_flit.message_field = static_cast<std::uint8_t>(TlMessageType::kNone);
 
-  // Transmit
-  transmit_tl_flits({tl_flit});
+  // Transmit; a flit that did not go out gives its tag back
+  if (transmit_tl_flits(std::span<const TlFlit>(&tl_flit, 1)) == 0) {
+    next_tag_ = tag;
+    return std::nullopt;
+  }
 
   stats_.tx_read_requests++;
 
   return tag;
 }
 
-std::uint16_t UaLinkEndpoint::send_write_request(std::uint64_t address, std::uint8_t size, const std::vector<std::byte> &data) {
+std::optional<std::uint16_t> UaLinkEndpoint::send_write_request(std::uint64_t address, std::uint8_t size, const std::vector<std::byte> &data) {
   UALINK_TRACE_SCOPED(__func__);
 
   if (!transmit_callback_) {
@@ -110,19 +116,35 @@ std::uint16_t UaLinkEndpoint::send_write_request(std::uint64_t address, std::uin
   std::copy_n(tl_flit_bytes.begin(), tl::kTlFlitBytes, tl_flit.data.begin());
   tl_flit.message_field = static_cast<std::uint8_t>(TlMessageType::kNone);
 
-  // Transmit
-  transmit_tl_flits({tl_flit});
+  // Transmit; a flit that did not go out gives its tag back
+  if (transmit_tl_flits(std::span<const TlFlit>(&tl_flit, 1)) == 0) {
+    next_tag_ = tag;
+    return std::nullopt;
+  }
 
   stats_.tx_write_requests++;
 
   return tag;
 }
 
+std::size_t UaLinkEndpoint::send_tl_flits(std::span<const TlFlit> tl_flits) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::size_t packed = transmit_tl_flits(tl_flits);
+  stats_.tx_tl_flits += packed;
+  return packed;
+}
+
 void UaLinkEndpoint::set_transmit_callback(TransmitCallback callback) {
   UALINK_TRACE_SCOPED(__func__);
   transmit_callback_ = std::move(callback);
 }
 
+void UaLinkEndpoint::enqueue_dl_message(const DlMessage &msg) {
+  UALINK_TRACE_SCOPED(__func__);
+  message_queue_.enqueue(msg);
+}
+
 void UaLinkEndpoint::receive_flit(const DlFlit &flit) {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -171,11 +193,17 @@ void UaLinkEndpoint::receive_flit(const DlFlit &flit) {
     tl_flits = DlDeserializer::deserialize(flit);
   }
 
-  // Generate ACK/NAK if enabled
-  if (enable_ack_nak_ && transmit_callback_) {
-    const std::uint8_t our_tx_seq_lo = tx_last_seq_ & 0x7;
+  // Generate ACK/NAK if enabled. Only a flit accepted in sequence carries new
+  // TL flits: a duplicate (replayed after a lost ACK) was already delivered,
+  // and a flit past a gap comes again once the gap is replayed. TL receivers
+  // such as UpliTlBridge keep state across flits, so they must see each TL
+  // flit exactly once and in order.
+  bool in_sequence = true;
+  if (enable_ack_nak_) {
+    in_sequence = ack_nak_manager_.expected_rx_seq() == received_seq;
+    const std::uint8_t our_tx_seq_lo = static_cast<std::uint8_t>(tx_controller_.get_state().last_seq & 0x7U);
     const auto command_flit = ack_nak_manager_.process_received_flit(received_seq, our_tx_seq_lo);
-    if (command_flit.has_value()) {
+    if (command_flit.has_value() && transmit_callback_) {
       // Send ACK or NAK
       transmit_callback_(*command_flit);
 
@@ -189,6 +217,11 @@ void UaLinkEndpoint::receive_flit(const DlFlit &flit) {
     }
   }
 
+  if (!in_sequence) {
+    stats_.rx_flits_discarded++;
+    return;
+  }
+
   // Process each TL flit
   for (const auto &tl_flit : tl_flits) {
     handle_tl_flit(tl_flit);
@@ -205,6 +238,11 @@ void UaLinkEndpoint::set_write_completion_callback(WriteCompletionCallback callb
   write_completion_callback_ = std::move(callback);
 }
 
+void UaLinkEndpoint::set_tl_flit_callback(TlFlitCallback callback) {
+  UALINK_TRACE_SCOPED(__func__);
+  tl_flit_callback_ = std::move(callback);
+}
+
 void UaLinkEndpoint::process_ack(std::uint16_t ack_seq) {
   UALINK_TRACE_SCOPED(__func__);
   [[maybe_unused]] const std::size_t retired = replay_buffer_.process_ack(ack_seq);
@@ -219,9 +257,11 @@ void UaLinkEndpoint::replay_from(std::uint16_t seq) {
   }
 
   const auto flits = replay_buffer_.process_nak(seq);
+  tx_controller_.start_replay();
   for (const auto &flit : flits) {
     transmit_callback_(flit);
   }
+  tx_controller_.finish_replay();
 }
 
 void UaLinkEndpoint::reset_stats() {
@@ -259,7 +299,7 @@ void UaLinkEndpoint::clear_pacing_callbacks() {
   pacing_controller_.clear_callbacks();
 }
 
-void UaLinkEndpoint::transmit_tl_flits(const std::vector<TlFlit> &tl_flits) {
+std::size_t UaLinkEndpoint::transmit_tl_flits(std::span<const TlFlit> tl_flits) {
   UALINK_TRACE_SCOPED(__func__);
 
   if (!transmit_callback_) {
@@ -267,85 +307,38 @@ void UaLinkEndpoint::transmit_tl_flits(const std::vector<TlFlit> &tl_flits) {
   }
 
   if (tl_flits.empty()) {
-    return;
+    return 0;
   }
 
-  // Build DL header
-  ExplicitFlitHeaderFields header{};
-  header.op = 0; // Explicit flit
-  header.payload = true;
-  const auto next_seq = [](std::uint16_t last_seq) -> std::uint16_t {
-    // Valid sequence numbers are 1..511, 0 reserved. 511 wraps to 1.
-    const std::uint16_t mod = static_cast<std::uint16_t>(last_seq % 511U);
-    return static_cast<std::uint16_t>(mod + 1U);
-  };
-  header.flit_seq_no = next_seq(tx_last_seq_);
-
-  // Serialize TL → DL with pacing and error injection
-  std::size_t packed = 0;
-  DlFlit dl_flit;
-
-  // Determine which serialize method to use based on configuration
-  if (error_injector_.is_enabled() && pacing_controller_.has_tx_callback()) {
-    // Both error injection and pacing
-    // First apply pacing check
-    const PacingDecision pacing_decision = pacing_controller_.check_tx_pacing(tl_flits.size(), tl_flits.size() * tl::kTlFlitBytes);
-
-    if (pacing_decision == PacingDecision::kDrop) {
-      stats_.tx_dropped_by_pacing++;
-      return;
-    }
-    if (pacing_decision == PacingDecision::kThrottle) {
-      stats_.tx_dropped_by_pacing++;
-      return; // For now, treat throttle as drop
-    }
-
-    // Apply error injection
-    dl_flit = DlSerializer::serialize_with_error_injection(tl_flits, header, error_injector_, &packed);
-
-    if (packed == 0) {
-      // Packet was dropped by error injection
-      stats_.tx_dropped_by_error_injection++;
-      return;
-    }
-  } else if (error_injector_.is_enabled()) {
-    // Error injection only
-    dl_flit = DlSerializer::serialize_with_error_injection(tl_flits, header, error_injector_, &packed);
-
-    if (packed == 0) {
-      // Packet was dropped by error injection
-      stats_.tx_dropped_by_error_injection++;
-      return;
-    }
-  } else if (pacing_controller_.has_tx_callback()) {
-    // Pacing only
-    dl_flit = DlSerializer::serialize_with_pacing(tl_flits, header, pacing_controller_, &packed);
+  // Pick the stage types once per call; the per-flit loop only contains the
+  // stages that are actually enabled.
+  const TxPipelineResult result = select_tx_pacing_stage(pacing_controller_, [&](auto pacing_stage) {
+    return select_tx_error_stage(error_injector_, [&](auto error_stage) {
+      return select_tx_message_stage(message_queue_, [&](auto message_stage) {
+        DlTxPipeline pipeline{tx_controller_, replay_buffer_, pacing_stage, error_stage, message_stage};
+        return pipeline.transmit(tl_flits, transmit_callback_);
+      });
+    });
+  });
 
-    if (packed == 0) {
-      // Packet was dropped/throttled by pacing
-      stats_.tx_dropped_by_pacing++;
-      return;
-    }
-  } else {
-    // No pacing or error injection
-    dl_flit = DlSerializer::serialize(tl_flits, header, &packed);
+  stats_.tx_dl_flits += result.dl_flits_transmitted;
+  stats_.tx_dropped_by_pacing += result.dropped_by_pacing;
+  stats_.tx_dropped_by_error_injection += result.dropped_by_error_injection;
+  if (result.stalled_on_replay_full) {
+    stats_.tx_stalled_replay_full++;
   }
-
-  // Store in replay buffer
-  [[maybe_unused]] const bool added = replay_buffer_.add_flit(header.flit_seq_no, dl_flit);
   stats_.replay_buffer_size = replay_buffer_.size();
-
-  // Transmit
-  transmit_callback_(dl_flit);
-  stats_.tx_dl_flits++;
-
-  // Increment sequence number
-  tx_last_seq_ = header.flit_seq_no;
+  return result.tl_flits_packed;
 }
 
 void UaLinkEndpoint::handle_tl_flit(const TlFlit &tl_flit) {
   UALINK_TRACE_SCOPED(__func__);
 
+  if (tl_flit_callback_) {
+    tl_flit_callback_(tl_flit);
+    return;
+  }
+
   // Deserialize opcode from flit data
   const TlOpcode opcode = TlDeserializer::deserialize_opcode(tl_flit.data);
 
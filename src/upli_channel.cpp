@@ -9,10 +9,20 @@ using namespace ualink::upli;
 // Request Channel Serialize/Deserialize
 // =============================================================================
 
-std::vector<std::byte> ualink::upli::serialize_upli_request(
+std::array<std::byte, kUpliRequestBytes> ualink::upli::serialize_upli_request(
     const UpliRequestFields& fields) {
   UALINK_TRACE_SCOPED(__func__);
 
+  std::array<std::byte, kUpliRequestBytes> buffer{};
+  serialize_upli_request(fields, buffer);
+  return buffer;
+}
+
+void ualink::upli::serialize_upli_request(
+    const UpliRequestFields& fields,
+    std::span<std::byte, kUpliRequestBytes> out) {
+  UALINK_TRACE_SCOPED(__func__);
+
   // Validate field ranges
   if (fields.req_port_id > 0x3) {
     throw std::invalid_argument(
@@ -46,13 +56,11 @@ std::vector<std::byte> ualink::upli::serialize_upli_request(
     throw std::invalid_argument("serialize_upli_request: req_vc out of range");
   }
 
-  // Calculate buffer size
-  const std::size_t total_bits = kUpliRequestFormat.total_bits();
-  const std::size_t total_bytes = (total_bits + 7) / 8;
-  std::vector<std::byte> buffer(total_bytes);
+  // Pad bits past the last field stay zero
+  std::fill(out.begin(), out.end(), std::byte{0});
 
   // Serialize using NetworkBitWriter
-  bit_fields::NetworkBitWriter writer(buffer);
+  bit_fields::NetworkBitWriter writer(out);
   writer.serialize(kUpliRequestFormat,
                    fields.req_vld ? 1U : 0U,
                    fields.req_port_id,
@@ -67,8 +75,6 @@ std::vector<std::byte> ualink::upli::serialize_upli_request(
                    fields.req_meta_data,
                    fields.req_vc,
                    fields.req_auth_tag);
-
-  return buffer;
 }
 
 UpliRequestFields ualink::upli::deserialize_upli_request(
@@ -102,25 +108,31 @@ UpliRequestFields ualink::upli::deserialize_upli_request(
 // Originator Data Channel Serialize/Deserialize
 // =============================================================================
 
-std::vector<std::byte> ualink::upli::serialize_upli_orig_data(
+std::array<std::byte, kUpliOrigDataBytes> ualink::upli::serialize_upli_orig_data(
     const UpliOrigDataFields& fields) {
   UALINK_TRACE_SCOPED(__func__);
 
+  std::array<std::byte, kUpliOrigDataBytes> buffer{};
+  serialize_upli_orig_data(fields, buffer);
+  return buffer;
+}
+
+void ualink::upli::serialize_upli_orig_data(
+    const UpliOrigDataFields& fields,
+    std::span<std::byte, kUpliOrigDataBytes> out) {
+  UALINK_TRACE_SCOPED(__func__);
+
   // Validate field ranges
   if (fields.orig_data_port_id > 0x3) {
     throw std::invalid_argument(
         "serialize_upli_orig_data: orig_data_port_id out of range");
   }
 
-  // Calculate control header size
-  const std::size_t ctrl_bits = kUpliOrigDataControlFormat.total_bits();
-  const std::size_t ctrl_bytes = (ctrl_bits + 7) / 8;
-
-  // Total size: control header + 64-byte data
-  std::vector<std::byte> buffer(ctrl_bytes + kUpliDataBeatBytes);
+  // Pad bits past the last control field stay zero
+  std::fill_n(out.begin(), kUpliOrigDataControlBytes, std::byte{0});
 
   // Serialize control fields
-  bit_fields::NetworkBitWriter writer(std::span(buffer.data(), ctrl_bytes));
+  bit_fields::NetworkBitWriter writer(out.first<kUpliOrigDataControlBytes>());
   writer.serialize(kUpliOrigDataControlFormat,
                    fields.orig_data_vld ? 1U : 0U,
                    fields.orig_data_port_id,
@@ -129,19 +141,16 @@ std::vector<std::byte> ualink::upli::serialize_upli_orig_data(
 
   // Copy data payload
   std::copy(fields.data.begin(), fields.data.end(),
-            buffer.begin() + ctrl_bytes);
-
-  return buffer;
+            out.begin() + kUpliOrigDataControlBytes);
 }
 
 UpliOrigDataFields ualink::upli::deserialize_upli_orig_data(
     std::span<const std::byte> bytes) {
   UALINK_TRACE_SCOPED(__func__);
 
-  const std::size_t ctrl_bits = kUpliOrigDataControlFormat.total_bits();
-  const std::size_t ctrl_bytes = (ctrl_bits + 7) / 8;
+  const std::size_t ctrl_bytes = kUpliOrigDataControlBytes;
 
-  if (bytes.size() < ctrl_bytes + kUpliDataBeatBytes) {
+  if (bytes.size() < kUpliOrigDataBytes) {
     throw std::invalid_argument(
         "deserialize_upli_orig_data: insufficient bytes");
   }
@@ -174,10 +183,20 @@ UpliOrigDataFields ualink::upli::deserialize_upli_orig_data(
 // Read Response Channel Serialize/Deserialize
 // =============================================================================
 
-std::vector<std::byte> ualink::upli::serialize_upli_rd_rsp(
+std::array<std::byte, kUpliRdRspBytes> ualink::upli::serialize_upli_rd_rsp(
     const UpliRdRspFields& fields) {
   UALINK_TRACE_SCOPED(__func__);
 
+  std::array<std::byte, kUpliRdRspBytes> buffer{};
+  serialize_upli_rd_rsp(fields, buffer);
+  return buffer;
+}
+
+void ualink::upli::serialize_upli_rd_rsp(
+    const UpliRdRspFields& fields,
+    std::span<std::byte, kUpliRdRspBytes> out) {
+  UALINK_TRACE_SCOPED(__func__);
+
   // Validate field ranges
   if (fields.rd_rsp_port_id > 0x3) {
     throw std::invalid_argument(
@@ -192,15 +211,11 @@ std::vector<std::byte> ualink::upli::serialize_upli_rd_rsp(
         "serialize_upli_rd_rsp: rd_rsp_status out of range");
   }
 
-  // Calculate control header size
-  const std::size_t ctrl_bits = kUpliRdRspFormat.total_bits();
-  const std::size_t ctrl_bytes = (ctrl_bits + 7) / 8;
-
-  // Total size: control header + 64-byte data
-  std::vector<std::byte> buffer(ctrl_bytes + kUpliDataBeatBytes);
+  // Pad bits past the last control field stay zero
+  std::fill_n(out.begin(), kUpliRdRspControlBytes, std::byte{0});
 
   // Serialize control fields
-  bit_fields::NetworkBitWriter writer(std::span(buffer.data(), ctrl_bytes));
+  bit_fields::NetworkBitWriter writer(out.first<kUpliRdRspControlBytes>());
   writer.serialize(kUpliRdRspFormat,
                    fields.rd_rsp_vld ? 1U : 0U,
                    fields.rd_rsp_port_id,
@@ -213,19 +228,16 @@ std::vector<std::byte> ualink::upli::serialize_upli_rd_rsp(
 
   // Copy data payload
   std::copy(fields.data.begin(), fields.data.end(),
-            buffer.begin() + ctrl_bytes);
-
-  return buffer;
+            out.begin() + kUpliRdRspControlBytes);
 }
 
 UpliRdRspFields ualink::upli::deserialize_upli_rd_rsp(
     std::span<const std::byte> bytes) {
   UALINK_TRACE_SCOPED(__func__);
 
-  const std::size_t ctrl_bits = kUpliRdRspFormat.total_bits();
-  const std::size_t ctrl_bytes = (ctrl_bits + 7) / 8;
+  const std::size_t ctrl_bytes = kUpliRdRspControlBytes;
 
-  if (bytes.size() < ctrl_bytes + kUpliDataBeatBytes) {
+  if (bytes.size() < kUpliRdRspBytes) {
     throw std::invalid_argument("deserialize_upli_rd_rsp: insufficient bytes");
   }
 
@@ -261,10 +273,20 @@ UpliRdRspFields ualink::upli::deserialize_upli_rd_rsp(
 // Write Response Channel Serialize/Deserialize
 // =============================================================================
 
-std::vector<std::byte> ualink::upli::serialize_upli_wr_rsp(
+std::array<std::byte, kUpliWrRspBytes> ualink::upli::serialize_upli_wr_rsp(
     const UpliWrRspFields& fields) {
   UALINK_TRACE_SCOPED(__func__);
 
+  std::array<std::byte, kUpliWrRspBytes> buffer{};
+  serialize_upli_wr_rsp(fields, buffer);
+  return buffer;
+}
+
+void ualink::upli::serialize_upli_wr_rsp(
+    const UpliWrRspFields& fields,
+    std::span<std::byte, kUpliWrRspBytes> out) {
+  UALINK_TRACE_SCOPED(__func__);
+
   // Validate field ranges
   if (fields.wr_rsp_port_id > 0x3) {
     throw std::invalid_argument(
@@ -279,13 +301,11 @@ std::vector<std::byte> ualink::upli::serialize_upli_wr_rsp(
         "serialize_upli_wr_rsp: wr_rsp_status out of range");
   }
 
-  // Calculate buffer size
-  const std::size_t total_bits = kUpliWrRspFormat.total_bits();
-  const std::size_t total_bytes = (total_bits + 7) / 8;
-  std::vector<std::byte> buffer(total_bytes);
+  // Pad bits past the last field stay zero
+  std::fill(out.begin(), out.end(), std::byte{0});
 
   // Serialize using NetworkBitWriter
-  bit_fields::NetworkBitWriter writer(buffer);
+  bit_fields::NetworkBitWriter writer(out);
   writer.serialize(kUpliWrRspFormat,
                    fields.wr_rsp_vld ? 1U : 0U,
                    fields.wr_rsp_port_id,
@@ -294,8 +314,6 @@ std::vector<std::byte> ualink::upli::serialize_upli_wr_rsp(
                    fields.wr_rsp_attr,
                    fields.wr_rsp_auth_tag,
                    0U);  // reserved
-
-  return buffer;
 }
 
 UpliWrRspFields ualink::upli::deserialize_upli_wr_rsp(
@@ -325,8 +343,18 @@ UpliWrRspFields ualink::upli::deserialize_upli_wr_rsp(
 // Credit Return Serialize/Deserialize
 // =============================================================================
 
-std::vector<std::byte> ualink::upli::serialize_upli_credit_return(
-    const UpliCreditReturn& credits) {
+std::array<std::byte, kUpliCreditReturnBytes>
+ualink::upli::serialize_upli_credit_return(const UpliCreditReturn& credits) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::array<std::byte, kUpliCreditReturnBytes> buffer{};
+  serialize_upli_credit_return(credits, buffer);
+  return buffer;
+}
+
+void ualink::upli::serialize_upli_credit_return(
+    const UpliCreditReturn& credits,
+    std::span<std::byte, kUpliCreditReturnBytes> out) {
   UALINK_TRACE_SCOPED(__func__);
 
   // Validate field ranges for all ports
@@ -342,20 +370,16 @@ std::vector<std::byte> ualink::upli::serialize_upli_credit_return(
     }
   }
 
-  // Calculate total size: 4 ports + 4 init_done flags
-  const std::size_t port_bits = kUpliCreditPortFormat.total_bits();
-  const std::size_t port_bytes = (port_bits + 7) / 8;
-  const std::size_t total_bytes = (kMaxPorts * port_bytes) + 1;  // +1 for init_done flags
-
-  std::vector<std::byte> buffer(total_bytes);
+  // Pad bits past each port's fields stay zero
+  std::fill(out.begin(), out.end(), std::byte{0});
 
   // Serialize each port's credit info
   for (std::size_t port_index = 0; port_index < kMaxPorts; ++port_index) {
     const auto& port = credits.ports[port_index];
-    const std::size_t offset = port_index * port_bytes;
+    const std::size_t offset = port_index * kUpliCreditPortBytes;
 
     bit_fields::NetworkBitWriter writer(
-        std::span(buffer.data() + offset, port_bytes));
+        out.subspan(offset, kUpliCreditPortBytes));
     writer.serialize(kUpliCreditPortFormat,
                      port.credit_vld ? 1U : 0U,
                      port.credit_pool ? 1U : 0U,
@@ -370,20 +394,16 @@ std::vector<std::byte> ualink::upli::serialize_upli_credit_return(
       init_done_byte |= std::byte(1U << port_index);
     }
   }
-  buffer[kMaxPorts * port_bytes] = init_done_byte;
-
-  return buffer;
+  out[kMaxPorts * kUpliCreditPortBytes] = init_done_byte;
 }
 
 UpliCreditReturn ualink::upli::deserialize_upli_credit_return(
     std::span<const std::byte> bytes) {
   UALINK_TRACE_SCOPED(__func__);
 
-  const std::size_t port_bits = kUpliCreditPortFormat.total_bits();
-  const std::size_t port_bytes = (port_bits + 7) / 8;
-  const std::size_t expected_bytes = (kMaxPorts * port_bytes) + 1;
+  const std::size_t port_bytes = kUpliCreditPortBytes;
 
-  if (bytes.size() < expected_bytes) {
+  if (bytes.size() < kUpliCreditReturnBytes) {
     throw std::invalid_argument(
         "deserialize_upli_credit_return: insufficient bytes");
   }
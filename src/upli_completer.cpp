@@ -0,0 +1,260 @@
+#include "ualink/upli_completer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+UpliCompleter::UpliCompleter(const UpliCompleterConfig& config)
+    : config_(config), tdm_scheduler_(config.bifurcation, config.queue_depth) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (config.physical_acc_id > 0x3FF) {
+    throw std::invalid_argument("UpliCompleter: physical_acc_id out of range");
+  }
+
+  slots_.resize(tdm_scheduler_.num_active_ports() * kUpliTagCount);
+  for (auto& fifo : awaiting_data_) {
+    fifo.ring.resize(kUpliTagCount);
+  }
+  for (std::uint8_t port_id = 0;
+       port_id < tdm_scheduler_.num_active_ports(); ++port_id) {
+    owed_credits_.configure_port(port_id, config.request_credits);
+  }
+  owed_credits_.initialize_credits();
+}
+
+UpliCompleter::PendingRequest& UpliCompleter::slot(std::uint8_t port_id,
+                                                   std::uint16_t tag) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (!tdm_scheduler_.is_port_active(port_id)) {
+    throw std::invalid_argument("UpliCompleter: port_id not active");
+  }
+  if (tag >= kUpliTagCount) {
+    throw std::invalid_argument("UpliCompleter: tag out of range");
+  }
+  return slots_[(static_cast<std::size_t>(port_id) * kUpliTagCount) + tag];
+}
+
+UpliCompleter::PendingRequest& UpliCompleter::dispatched_slot(
+    std::uint8_t port_id, std::uint16_t tag, bool write) {
+  UALINK_TRACE_SCOPED(__func__);
+  PendingRequest& pending = slot(port_id, tag);
+  if (pending.state != SlotState::kDispatched || pending.write != write) {
+    throw std::invalid_argument(
+        "UpliCompleter: no dispatched request of this kind for tag");
+  }
+  return pending;
+}
+
+void UpliCompleter::dispatch(PendingRequest& pending) {
+  UALINK_TRACE_SCOPED(__func__);
+  pending.state = SlotState::kDispatched;
+  if (request_callback_) {
+    std::span<const std::byte> write_data{};
+    if (pending.write) {
+      const std::size_t bytes =
+          (static_cast<std::size_t>(pending.request.len) + 1) * 4;
+      write_data = std::span<const std::byte>(pending.data).first(bytes);
+    }
+    request_callback_(pending.request, write_data);
+  }
+}
+
+void UpliCompleter::process_request(const UpliRequestFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto cmd = static_cast<ReqCmd>(beat.req_cmd);
+  bool write = false;
+  if (cmd == ReqCmd::kWrite || cmd == ReqCmd::kWriteFull) {
+    write = true;
+  } else if (cmd != ReqCmd::kRead) {
+    throw std::invalid_argument(
+        "UpliCompleter::process_request: unsupported command");
+  }
+  const std::size_t beats = upli_data_beats(beat.req_len);
+  if (write && beat.req_num_beats + 1U != beats) {
+    throw std::invalid_argument(
+        "UpliCompleter::process_request: req_num_beats does not match req_len");
+  }
+
+  PendingRequest& pending = slot(beat.req_port_id, beat.req_tag);
+  if (pending.state != SlotState::kFree) {
+    throw std::invalid_argument(
+        "UpliCompleter::process_request: tag already pending");
+  }
+
+  pending.write = write;
+  pending.vc = beat.req_vc;
+  pending.beats = static_cast<std::uint8_t>(beats);
+  pending.beats_received = 0;
+  pending.request = UpliCompleterRequest{
+      .port_id = beat.req_port_id,
+      .src_acc_id = beat.req_src_phys_acc_id,
+      .tag = beat.req_tag,
+      .address = beat.req_addr,
+      .cmd = cmd,
+      .len = beat.req_len,
+      .vc = beat.req_vc,
+  };
+  pending_++;
+  stats_.max_pending = std::max(stats_.max_pending, pending_);
+
+  if (!write) {
+    stats_.reads_received++;
+    dispatch(pending);
+    return;
+  }
+
+  // Tags are unique per port, so the FIFO never overflows
+  TagFifo& fifo = awaiting_data_[beat.req_port_id];
+  fifo.ring[(fifo.head + fifo.count) % fifo.ring.size()] = beat.req_tag;
+  fifo.count++;
+  pending.state = SlotState::kAwaitingData;
+}
+
+void UpliCompleter::process_orig_data(const UpliOrigDataFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!tdm_scheduler_.is_port_active(beat.orig_data_port_id)) {
+    throw std::invalid_argument(
+        "UpliCompleter::process_orig_data: port_id not active");
+  }
+  TagFifo& fifo = awaiting_data_[beat.orig_data_port_id];
+  if (fifo.count == 0) {
+    throw std::invalid_argument(
+        "UpliCompleter::process_orig_data: no write awaiting data");
+  }
+
+  PendingRequest& pending = slot(beat.orig_data_port_id, fifo.ring[fifo.head]);
+  std::copy(beat.data.begin(), beat.data.end(),
+            pending.data.begin() +
+                (pending.beats_received * kUpliDataBeatBytes));
+  pending.beats_received++;
+  stats_.orig_data_beats++;
+  if (pending.beats_received < pending.beats) {
+    return;
+  }
+
+  fifo.head = (fifo.head + 1) % fifo.ring.size();
+  fifo.count--;
+  stats_.writes_received++;
+  dispatch(pending);
+}
+
+bool UpliCompleter::send_read_response(std::uint8_t port_id,
+                                       std::uint16_t tag, RspStatus status,
+                                       std::span<const std::byte> data) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  PendingRequest& pending = dispatched_slot(port_id, tag, false);
+  if (data.size() > pending.beats * kUpliDataBeatBytes) {
+    throw std::invalid_argument(
+        "UpliCompleter::send_read_response: data longer than the request");
+  }
+
+  // All of the response's beats are queued, or none
+  if (tdm_scheduler_.queue_size(port_id, UpliChannel::kRdRsp) + pending.beats >
+      config_.queue_depth) {
+    stats_.response_queue_full++;
+    return false;
+  }
+  for (std::uint8_t index = 0; index < pending.beats; ++index) {
+    [[maybe_unused]] const bool queued = tdm_scheduler_.enqueue(
+        port_id, UpliChannel::kRdRsp,
+        {.tag = tag, .vc = pending.vc, .beat = index});
+  }
+  pending.state = SlotState::kResponding;
+  pending.status = static_cast<std::uint8_t>(status);
+  pending.data.fill(std::byte{0});
+  std::copy(data.begin(), data.end(), pending.data.begin());
+  return true;
+}
+
+bool UpliCompleter::send_write_response(std::uint8_t port_id,
+                                        std::uint16_t tag, RspStatus status) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  PendingRequest& pending = dispatched_slot(port_id, tag, true);
+
+  if (!tdm_scheduler_.enqueue(port_id, UpliChannel::kWrRsp,
+                              {.tag = tag, .vc = pending.vc})) {
+    stats_.response_queue_full++;
+    return false;
+  }
+  pending.state = SlotState::kResponding;
+  pending.status = static_cast<std::uint8_t>(status);
+  return true;
+}
+
+void UpliCompleter::on_grant(std::uint8_t port_id, UpliChannel channel,
+                             const UpliTdmBeat& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+  PendingRequest& pending = slot(port_id, beat.tag);
+
+  if (channel == UpliChannel::kRdRsp) {
+    UpliRdRspFields response{};
+    response.rd_rsp_vld = true;
+    response.rd_rsp_port_id = port_id;
+    response.rd_rsp_tag = beat.tag;
+    response.rd_rsp_status = pending.status;
+    std::copy_n(pending.data.begin() + (beat.beat * kUpliDataBeatBytes),
+                kUpliDataBeatBytes, response.data.begin());
+    stats_.rd_rsp_beats++;
+    if (beat.beat + 1U < pending.beats) {
+      if (rd_rsp_sink_) {
+        rd_rsp_sink_(response);
+      }
+      return;
+    }
+    stats_.read_responses++;
+    // Free the slot first: the sink may deliver a new request for this tag
+    pending.state = SlotState::kFree;
+    pending_--;
+    if (rd_rsp_sink_) {
+      rd_rsp_sink_(response);
+    }
+  } else {
+    UpliWrRspFields response{};
+    response.wr_rsp_vld = true;
+    response.wr_rsp_port_id = port_id;
+    response.wr_rsp_tag = beat.tag;
+    response.wr_rsp_status = pending.status;
+    stats_.write_responses++;
+    pending.state = SlotState::kFree;
+    pending_--;
+    if (wr_rsp_sink_) {
+      wr_rsp_sink_(response);
+    }
+  }
+
+  // The request buffer is free: its credit goes back with the next return,
+  // to the pool if the originator draws on one
+  if (config_.request_credits.use_pool) {
+    owed_credits_.owe_pool_credits(port_id, 1);
+  } else {
+    owed_credits_.owe_credits(port_id, beat.vc, 1);
+  }
+}
+
+std::size_t UpliCompleter::advance_cycle() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::size_t granted = tdm_scheduler_.advance_cycle(
+      [this](std::uint8_t port_id, UpliChannel channel,
+             const UpliTdmBeat& beat) { on_grant(port_id, channel, beat); });
+
+  const auto credits = owed_credits_.generate_credit_return();
+  if (credits.has_value()) {
+    for (const auto& port_credit : credits->ports) {
+      if (port_credit.credit_vld) {
+        stats_.credits_returned += port_credit.credit_num + 1U;
+      }
+    }
+    stats_.credit_return_messages++;
+    if (credit_return_sink_) {
+      credit_return_sink_(*credits);
+    }
+  }
+  return granted;
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "ualink/upli_concurrent_credit.h"
+
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+void UpliConcurrentCreditManager::configure_port(
+    std::uint8_t port_id, const PortCreditConfig& config) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (port_id >= kMaxPorts) {
+    throw std::invalid_argument(
+        "UpliConcurrentCreditManager::configure_port: port_id out of range");
+  }
+
+  port_config_[port_id] = config;
+}
+
+void UpliConcurrentCreditManager::initialize_credits() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  for (std::size_t port_index = 0; port_index < kMaxPorts; ++port_index) {
+    const auto& config = port_config_[port_index];
+    use_pool_[port_index] = config.use_pool;
+
+    for (std::size_t vc_index = 0; vc_index < kMaxVirtualChannels;
+         ++vc_index) {
+      CreditCounter& counter = vc_counters_[port_index][vc_index];
+      counter.initial = 0;
+      if (!config.use_pool && config.vc_config[vc_index].enabled) {
+        counter.initial = config.vc_config[vc_index].initial_credits;
+      }
+      counter.available.store(counter.initial, std::memory_order_relaxed);
+    }
+
+    CreditCounter& pool = pool_counters_[port_index];
+    pool.initial = 0;
+    if (config.use_pool) {
+      pool.initial = config.pool_credits;
+    }
+    pool.available.store(pool.initial, std::memory_order_relaxed);
+  }
+
+  // Publish the setup to threads that start after this returns
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+UpliConcurrentCreditManager::CreditCounter*
+UpliConcurrentCreditManager::counter_for(std::uint8_t port_id,
+                                         std::uint8_t vc) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  if (port_id >= kMaxPorts || vc >= kMaxVirtualChannels) {
+    return nullptr;
+  }
+  if (use_pool_[port_id]) {
+    return &pool_counters_[port_id];
+  }
+  return &vc_counters_[port_id][vc];
+}
+
+const UpliConcurrentCreditManager::CreditCounter*
+UpliConcurrentCreditManager::counter_for(std::uint8_t port_id,
+                                         std::uint8_t vc) const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  if (port_id >= kMaxPorts || vc >= kMaxVirtualChannels) {
+    return nullptr;
+  }
+  if (use_pool_[port_id]) {
+    return &pool_counters_[port_id];
+  }
+  return &vc_counters_[port_id][vc];
+}
+
+bool UpliConcurrentCreditManager::try_consume_credit(std::uint8_t port_id,
+                                                     std::uint8_t vc) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  CreditCounter* counter = counter_for(port_id, vc);
+  if (counter == nullptr) {
+    return false;
+  }
+
+  // Acquire pairs with the release in add_credits(): a sender that sees a
+  // returned credit also sees whatever the returner wrote before it
+  std::size_t available = counter->available.load(std::memory_order_relaxed);
+  while (available != 0) {
+    if (counter->available.compare_exchange_weak(available, available - 1,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+
+  counter->send_blocked_count.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void UpliConcurrentCreditManager::add_credits(CreditCounter& counter,
+                                              std::size_t count) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::size_t before =
+      counter.available.fetch_add(count, std::memory_order_release);
+  counter.credits_returned.fetch_add(count, std::memory_order_relaxed);
+  if (before + count > counter.initial) {
+    counter.over_returned.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+bool UpliConcurrentCreditManager::return_credits(std::uint8_t port_id,
+                                                 std::uint8_t vc,
+                                                 std::size_t count) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  CreditCounter* counter = counter_for(port_id, vc);
+  if (counter == nullptr) {
+    return false;
+  }
+
+  add_credits(*counter, count);
+  return true;
+}
+
+void UpliConcurrentCreditManager::process_credit_return(
+    const UpliCreditReturn& credits) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+
+  for (std::size_t port_index = 0; port_index < kMaxPorts; ++port_index) {
+    const auto& port_credit = credits.ports[port_index];
+    if (!port_credit.credit_vld) {
+      continue;
+    }
+
+    // Decode credit count (0-3 encoding means 1-4 actual credits)
+    const std::size_t credit_count = port_credit.credit_num + 1;
+    if (port_credit.credit_pool) {
+      add_credits(pool_counters_[port_index], credit_count);
+    } else if (port_credit.credit_vc < kMaxVirtualChannels) {
+      add_credits(vc_counters_[port_index][port_credit.credit_vc],
+                  credit_count);
+    }
+  }
+}
+
+std::size_t UpliConcurrentCreditManager::get_available_credits(
+    std::uint8_t port_id, std::uint8_t vc) const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  const CreditCounter* counter = counter_for(port_id, vc);
+  if (counter == nullptr) {
+    return 0;
+  }
+  return counter->available.load(std::memory_order_relaxed);
+}
+
+UpliConcurrentCreditManager::Stats UpliConcurrentCreditManager::get_stats(
+    std::uint8_t port_id, std::uint8_t vc) const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  const CreditCounter* counter = counter_for(port_id, vc);
+  if (counter == nullptr) {
+    return Stats{};
+  }
+  return Stats{
+      .credits_returned =
+          counter->credits_returned.load(std::memory_order_relaxed),
+      .send_blocked_count =
+          counter->send_blocked_count.load(std::memory_order_relaxed),
+      .over_returned = counter->over_returned.load(std::memory_order_relaxed),
+  };
+}
\ No newline at end of file
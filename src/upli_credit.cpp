@@ -1,5 +1,6 @@
 #include "ualink/upli_credit.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 using namespace ualink::upli;
@@ -190,48 +191,82 @@ void UpliCreditManager::return_credits(std::uint8_t port_id, std::uint8_t vc,
   }
 }
 
+void UpliCreditManager::owe_credits(std::uint8_t port_id, std::uint8_t vc,
+                                     std::size_t count) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  validate_port_vc(port_id, vc);
+
+  port_state_[port_id].vc_owed[vc] += count;
+}
+
+void UpliCreditManager::owe_pool_credits(std::uint8_t port_id,
+                                          std::size_t count) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  validate_port_vc(port_id, 0);
+
+  port_state_[port_id].pool_owed += count;
+}
+
+std::size_t UpliCreditManager::get_owed_credits(std::uint8_t port_id,
+                                                 std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+
+  validate_port_vc(port_id, vc);
+
+  return port_state_[port_id].vc_owed[vc];
+}
+
+std::size_t UpliCreditManager::get_owed_pool_credits(
+    std::uint8_t port_id) const {
+  UALINK_TRACE_SCOPED(__func__);
+
+  validate_port_vc(port_id, 0);
+
+  return port_state_[port_id].pool_owed;
+}
+
 std::optional<UpliCreditReturn> UpliCreditManager::generate_credit_return() {
   UALINK_TRACE_SCOPED(__func__);
 
-  // Simple implementation: return credits for VCs that have consumed credits
-  // In a real implementation, this would be more sophisticated with batching
+  // Return slots per port: one per VC, then the pool
+  constexpr std::size_t kReturnSlots = kMaxVirtualChannels + 1;
 
   UpliCreditReturn credits{};
   bool has_credits = false;
 
   for (std::size_t port_index = 0; port_index < kMaxPorts; ++port_index) {
-    const auto& state = port_state_[port_index];
+    auto& state = port_state_[port_index];
 
-    if (!state.port_init_done) {
-      continue;
-    }
+    credits.credit_init_done[port_index] = state.port_init_done;
 
-    credits.credit_init_done[port_index] = true;
+    // First slot with credits owed, starting after the last one returned
+    for (std::size_t offset = 0; offset < kReturnSlots; ++offset) {
+      const std::size_t slot = (state.next_return_slot + offset) % kReturnSlots;
+      const bool pool = (slot == kMaxVirtualChannels);
+      std::size_t* owed = &state.pool_owed;
+      if (!pool) {
+        owed = &state.vc_owed[slot];
+      }
+      if (*owed == 0) {
+        continue;
+      }
 
-    if (state.use_pool) {
-      // For pool mode, could return pool credits
-      // For now, skip in this simple implementation
-      continue;
-    }
+      const std::size_t to_return = std::min(*owed, kMaxCreditsPerReturn);
+      *owed -= to_return;
 
-    // Return credits for first VC that has consumed credits
-    for (std::size_t vc_index = 0; vc_index < kMaxVirtualChannels;
-         ++vc_index) {
-      const auto& vc_state = state.vc_state[vc_index];
-      if (vc_state.stats.credits_consumed > 0) {
-        const std::size_t to_return =
-            std::min(vc_state.stats.credits_consumed, std::size_t{4});
-        if (to_return > 0) {
-          credits.ports[port_index].credit_vld = true;
-          credits.ports[port_index].credit_pool = false;
-          credits.ports[port_index].credit_vc =
-              static_cast<std::uint8_t>(vc_index);
-          credits.ports[port_index].credit_num =
-              static_cast<std::uint8_t>(to_return - 1);  // 0-3 encoding
-          has_credits = true;
-          break;  // Only one return per port in this simple implementation
-        }
+      auto& port_credit = credits.ports[port_index];
+      port_credit.credit_vld = true;
+      port_credit.credit_pool = pool;
+      if (!pool) {
+        port_credit.credit_vc = static_cast<std::uint8_t>(slot);
       }
+      port_credit.credit_num =
+          static_cast<std::uint8_t>(to_return - 1);  // 0-3 encoding
+      state.next_return_slot = (slot + 1) % kReturnSlots;
+      has_credits = true;
+      break;
     }
   }
 
@@ -0,0 +1,170 @@
+#include "ualink/upli_ordering.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+// The region base keeps its low 8 bits clear, so the VC fits below it
+static_assert(kMaxVirtualChannels <= kRegionAlignmentBytes);
+
+UpliOrderingManager::UpliOrderingManager(OrderingMode mode,
+                                         BifurcationMode bifurcation)
+    : mode_(mode),
+      num_ports_(bifurcation_port_count(bifurcation)),
+      region_slots_(kRegionSlots) {
+  UALINK_TRACE_SCOPED(__func__);
+}
+
+std::uint64_t UpliOrderingManager::get_region_base(
+    std::uint64_t address) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return address & ~static_cast<std::uint64_t>(kRegionAlignmentBytes - 1);
+}
+
+std::uint64_t UpliOrderingManager::region_key(std::uint64_t region_base,
+                                              std::uint8_t vc) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return region_base | vc;
+}
+
+// Fibonacci hashing: the top bits of the product depend on every key bit
+std::size_t UpliOrderingManager::home_slot(std::uint64_t key) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >>
+                                  (64 - kRegionSlotBits));
+}
+
+// Linear probing. Returns the key's slot, or the empty slot that ends its
+// probe sequence.
+std::size_t UpliOrderingManager::find_slot(std::uint64_t key) const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  constexpr std::size_t kMask = kRegionSlots - 1;
+  std::size_t slot = home_slot(key);
+  while (region_slots_[slot].key != key &&
+         region_slots_[slot].key != kEmptyKey) {
+    slot = (slot + 1) & kMask;
+  }
+  return slot;
+}
+
+std::size_t UpliOrderingManager::key_count(std::uint64_t key) const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return region_slots_[find_slot(key)].count;
+}
+
+// Backward-shift deletion: pull later entries of the probe run into the hole
+// so lookups never need tombstones
+void UpliOrderingManager::erase_slot(std::size_t slot) noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  constexpr std::size_t kMask = kRegionSlots - 1;
+  std::size_t hole = slot;
+  std::size_t next = (hole + 1) & kMask;
+  while (region_slots_[next].key != kEmptyKey) {
+    const std::size_t home = home_slot(region_slots_[next].key);
+    if (((next - home) & kMask) >= ((next - hole) & kMask)) {
+      region_slots_[hole] = region_slots_[next];
+      hole = next;
+    }
+    next = (next + 1) & kMask;
+  }
+  region_slots_[hole] = RegionSlot{};
+}
+
+std::uint8_t UpliOrderingManager::get_required_port(
+    std::uint64_t address) const {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::uint64_t region_index = address / kRegionAlignmentBytes;
+  return static_cast<std::uint8_t>(region_index % num_ports_);
+}
+
+bool UpliOrderingManager::can_issue_request(std::uint64_t address,
+                                            std::uint8_t port_id,
+                                            std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (vc >= kMaxVirtualChannels) {
+    return false;
+  }
+  if (port_id != get_required_port(address)) {
+    return false;
+  }
+
+  const std::uint64_t region_base = get_region_base(address);
+  for (std::uint8_t other_vc = 0; other_vc < kMaxVirtualChannels;
+       ++other_vc) {
+    // Same-VC requests stay ordered on the link in relaxed mode
+    if (mode_ == OrderingMode::kRelaxed && other_vc == vc) {
+      continue;
+    }
+    if (key_count(region_key(region_base, other_vc)) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void UpliOrderingManager::track_request(std::uint64_t address,
+                                        std::uint8_t port_id,
+                                        std::uint8_t vc, std::uint16_t tag) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (port_id >= num_ports_) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::track_request: port_id not active");
+  }
+  if (vc >= kMaxVirtualChannels) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::track_request: vc out of range");
+  }
+  if (tag >= kUpliTagCount) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::track_request: tag out of range");
+  }
+  if (tags_[tag].valid) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::track_request: tag already in flight");
+  }
+
+  const std::uint64_t key = region_key(get_region_base(address), vc);
+  RegionSlot& region = region_slots_[find_slot(key)];
+  region.key = key;
+  region.count++;
+  tags_[tag] = InFlightRequest{.region_key = key, .port_id = port_id,
+                               .valid = true};
+  in_flight_count_++;
+
+  stats_.requests_tracked++;
+  stats_.max_in_flight = std::max(stats_.max_in_flight, in_flight_count_);
+}
+
+void UpliOrderingManager::complete_request(std::uint16_t tag) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (!is_tag_in_flight(tag)) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::complete_request: tag not in flight");
+  }
+
+  InFlightRequest& request = tags_[tag];
+  const std::size_t slot = find_slot(request.region_key);
+  region_slots_[slot].count--;
+  if (region_slots_[slot].count == 0) {
+    erase_slot(slot);
+  }
+  request.valid = false;
+  in_flight_count_--;
+
+  stats_.requests_completed++;
+}
+
+std::size_t UpliOrderingManager::region_in_flight(std::uint64_t address,
+                                                  std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (vc >= kMaxVirtualChannels) {
+    throw std::invalid_argument(
+        "UpliOrderingManager::region_in_flight: vc out of range");
+  }
+  return key_count(region_key(get_region_base(address), vc));
+}
\ No newline at end of file
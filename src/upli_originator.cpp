@@ -0,0 +1,356 @@
+#include "ualink/upli_originator.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+namespace {
+
+constexpr std::uint64_t kMaxUpliAddress = 0x1FFFFFFFFFFFFFFULL;  // 57 bits
+constexpr std::uint16_t kMaxAccId = 0x3FF;                       // 10 bits
+constexpr std::size_t kDwordBytes = 4;
+
+}  // namespace
+
+UpliOriginator::UpliOriginator(const UpliOriginatorConfig& config)
+    : config_(config),
+      tdm_scheduler_(config.bifurcation, config.queue_depth),
+      ordering_manager_(config.ordering, config.bifurcation),
+      send_queue_(config.backlog_depth) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (config.max_outstanding_requests == 0 ||
+      config.max_outstanding_requests > kUpliTagCount) {
+    throw std::invalid_argument(
+        "UpliOriginator: max_outstanding_requests must be 1..2048");
+  }
+  if (config.physical_acc_id > kMaxAccId) {
+    throw std::invalid_argument(
+        "UpliOriginator: physical_acc_id out of range");
+  }
+
+  transactions_.resize(config.max_outstanding_requests);
+  tag_active_.resize(config.max_outstanding_requests, false);
+  free_tags_.reserve(config.max_outstanding_requests);
+  // Lowest tag on top of the stack
+  for (std::size_t tag = config.max_outstanding_requests; tag-- > 0;) {
+    free_tags_.push_back(static_cast<std::uint16_t>(tag));
+  }
+
+  for (std::uint8_t port_id = 0;
+       port_id < tdm_scheduler_.num_active_ports(); ++port_id) {
+    send_queue_.configure_port(port_id, config.request_credits);
+  }
+  send_queue_.initialize_credits();
+
+  // A request reaches the TDM queue only with its credit in hand
+  send_queue_.set_release_callback(
+      [this](std::uint8_t port_id, const UpliTdmBeat& beat) {
+        return tdm_scheduler_.enqueue(port_id, UpliChannel::kRequest, beat);
+      });
+}
+
+std::optional<std::uint16_t> UpliOriginator::send_read(
+    std::uint16_t dst_acc_id, std::uint64_t address, std::uint8_t vc,
+    std::size_t length) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  return issue(dst_acc_id, address, vc, length, false);
+}
+
+std::optional<std::uint16_t> UpliOriginator::send_read_into(
+    std::uint16_t dst_acc_id, std::uint64_t address,
+    std::span<std::byte> destination, std::uint8_t vc) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const auto tag = issue(dst_acc_id, address, vc, destination.size(), false);
+  if (tag.has_value()) {
+    transactions_[*tag].destination = destination;
+  }
+  return tag;
+}
+
+std::optional<std::uint16_t> UpliOriginator::send_write(
+    std::uint16_t dst_acc_id, std::uint64_t address,
+    std::span<const std::byte> data, std::uint8_t vc) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::array<std::span<const std::byte>, 1> segments{data};
+  return send_write_gather(dst_acc_id, address, segments, vc);
+}
+
+std::optional<std::uint16_t> UpliOriginator::send_write_gather(
+    std::uint16_t dst_acc_id, std::uint64_t address,
+    std::span<const std::span<const std::byte>> segments, std::uint8_t vc) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::size_t length = 0;
+  for (const auto& segment : segments) {
+    length += segment.size();
+  }
+
+  const auto tag = issue(dst_acc_id, address, vc, length, true);
+  if (!tag.has_value()) {
+    return std::nullopt;
+  }
+
+  Transaction& transaction = transactions_[*tag];
+  transaction.data.fill(std::byte{0});
+  auto out = transaction.data.begin();
+  for (const auto& segment : segments) {
+    out = std::copy(segment.begin(), segment.end(), out);
+  }
+  return tag;
+}
+
+std::optional<std::uint16_t> UpliOriginator::issue(std::uint16_t dst_acc_id,
+                                                   std::uint64_t address,
+                                                   std::uint8_t vc,
+                                                   std::size_t length,
+                                                   bool write) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (address > kMaxUpliAddress) {
+    throw std::invalid_argument("UpliOriginator: address out of range");
+  }
+  if (dst_acc_id > kMaxAccId) {
+    throw std::invalid_argument("UpliOriginator: dst_acc_id out of range");
+  }
+  if (vc >= kMaxVirtualChannels) {
+    throw std::invalid_argument("UpliOriginator: vc out of range");
+  }
+  if (length == 0 || length > kUpliMaxTransferBytes) {
+    throw std::invalid_argument(
+        "UpliOriginator: transfer must be 1..256 bytes");
+  }
+  // One region, so one port and one ordering entry cover the transfer
+  if (length > kUpliDataBeatBytes &&
+      (address % kRegionAlignmentBytes) + length > kRegionAlignmentBytes) {
+    throw std::invalid_argument(
+        "UpliOriginator: multi-beat transfer crosses a 256-byte region");
+  }
+
+  const auto len =
+      static_cast<std::uint8_t>(((length + kDwordBytes - 1) / kDwordBytes) - 1);
+  const std::size_t beats = upli_data_beats(len);
+  if (write && beats > config_.queue_depth) {
+    throw std::invalid_argument(
+        "UpliOriginator: write has more beats than queue_depth");
+  }
+
+  if (free_tags_.empty()) {
+    stats_.tag_stalls++;
+    return std::nullopt;
+  }
+
+  const std::uint8_t port_id = ordering_manager_.get_required_port(address);
+  if (!ordering_manager_.can_issue_request(address, port_id, vc)) {
+    stats_.ordering_stalls++;
+    return std::nullopt;
+  }
+
+  // A write reserves its OrigData slots now; the beats are queued when its
+  // request beat goes
+  if (write && tdm_scheduler_.queue_size(port_id, UpliChannel::kOrigData) +
+                       reserved_data_beats_[port_id] + beats >
+                   config_.queue_depth) {
+    stats_.queue_full_stalls++;
+    return std::nullopt;
+  }
+
+  const std::uint16_t tag = free_tags_.back();
+  const UpliTdmBeat beat{.tag = tag, .vc = vc};
+  const std::size_t waiting = send_queue_.backlog_size(port_id, vc);
+  if (!send_queue_.submit(port_id, beat)) {
+    stats_.queue_full_stalls++;
+    return std::nullopt;
+  }
+  if (send_queue_.backlog_size(port_id, vc) > waiting) {
+    stats_.credit_stalls++;
+  }
+  if (write) {
+    reserved_data_beats_[port_id] += beats;
+  }
+  free_tags_.pop_back();
+  tag_active_[tag] = true;
+  ordering_manager_.track_request(address, port_id, vc, tag);
+
+  Transaction& transaction = transactions_[tag];
+  transaction.address = address;
+  transaction.issue_cycle = tdm_scheduler_.cycle();
+  transaction.dst_acc_id = dst_acc_id;
+  transaction.vc = vc;
+  transaction.len = len;
+  transaction.beats = static_cast<std::uint8_t>(beats);
+  transaction.beats_received = 0;
+  transaction.status = 0;
+  transaction.write = write;
+  transaction.request_sent = false;
+  transaction.destination = {};
+  return tag;
+}
+
+void UpliOriginator::on_grant(std::uint8_t port_id, UpliChannel channel,
+                              const UpliTdmBeat& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+  Transaction& transaction = transactions_[beat.tag];
+
+  if (channel == UpliChannel::kOrigData) {
+    UpliOrigDataFields data{};
+    data.orig_data_vld = true;
+    data.orig_data_port_id = port_id;
+    std::copy_n(transaction.data.begin() + (beat.beat * kUpliDataBeatBytes),
+                kUpliDataBeatBytes, data.data.begin());
+    stats_.orig_data_beats++;
+    if (orig_data_sink_) {
+      orig_data_sink_(data);
+    }
+    return;
+  }
+
+  transaction.request_sent = true;
+  stats_.requests_sent++;
+
+  UpliRequestFields request{};
+  request.req_vld = true;
+  request.req_port_id = port_id;
+  request.req_src_phys_acc_id = config_.physical_acc_id;
+  request.req_dst_phys_acc_id = transaction.dst_acc_id;
+  request.req_tag = beat.tag;
+  request.req_addr = transaction.address;
+  request.req_len = transaction.len;
+  request.req_vc = beat.vc;
+  if (transaction.write) {
+    // Requests leave in credit order, not issue order, so data is queued
+    // only now: OrigData beats follow their requests in order on the port
+    reserved_data_beats_[port_id] -= transaction.beats;
+    for (std::uint8_t index = 0; index < transaction.beats; ++index) {
+      [[maybe_unused]] const bool data_queued = tdm_scheduler_.enqueue(
+          port_id, UpliChannel::kOrigData,
+          {.tag = beat.tag, .vc = beat.vc, .beat = index});
+    }
+    const std::size_t bytes = (static_cast<std::size_t>(transaction.len) + 1) *
+                              kDwordBytes;
+    if (bytes == transaction.beats * kUpliDataBeatBytes) {
+      request.req_cmd = static_cast<std::uint8_t>(ReqCmd::kWriteFull);
+    } else {
+      request.req_cmd = static_cast<std::uint8_t>(ReqCmd::kWrite);
+    }
+    request.req_num_beats = static_cast<std::uint8_t>(transaction.beats - 1);
+  } else {
+    request.req_cmd = static_cast<std::uint8_t>(ReqCmd::kRead);
+  }
+  if (request_sink_) {
+    request_sink_(request);
+  }
+}
+
+std::size_t UpliOriginator::advance_cycle() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  send_queue_.advance_cycle();
+  return tdm_scheduler_.advance_cycle(
+      [this](std::uint8_t port_id, UpliChannel channel,
+             const UpliTdmBeat& beat) { on_grant(port_id, channel, beat); });
+}
+
+UpliOriginator::Transaction& UpliOriginator::outstanding(std::uint16_t tag,
+                                                        bool write) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (tag >= transactions_.size() || !tag_active_[tag]) {
+    throw std::invalid_argument("UpliOriginator: response tag not outstanding");
+  }
+  Transaction& transaction = transactions_[tag];
+  if (transaction.write != write || !transaction.request_sent) {
+    throw std::invalid_argument(
+        "UpliOriginator: response does not match request");
+  }
+  return transaction;
+}
+
+void UpliOriginator::retire(std::uint16_t tag, bool write) {
+  UALINK_TRACE_SCOPED(__func__);
+  const Transaction& transaction = outstanding(tag, write);
+
+  ordering_manager_.complete_request(tag);
+  tag_active_[tag] = false;
+  free_tags_.push_back(tag);
+
+  const std::uint64_t latency =
+      tdm_scheduler_.cycle() - transaction.issue_cycle;
+  stats_.total_latency_cycles += latency;
+  stats_.max_latency_cycles = std::max(stats_.max_latency_cycles, latency);
+}
+
+void UpliOriginator::process_rd_rsp(const UpliRdRspFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  Transaction& transaction = outstanding(beat.rd_rsp_tag, false);
+  stats_.rd_rsp_beats++;
+  if (transaction.status == 0) {
+    transaction.status = beat.rd_rsp_status;
+  }
+
+  // Beats arrive in order. Each lands at its offset in the caller's buffer,
+  // or in the transaction if the read spans several beats.
+  const std::size_t length =
+      (static_cast<std::size_t>(transaction.len) + 1) * kDwordBytes;
+  const std::size_t offset = transaction.beats_received * kUpliDataBeatBytes;
+  const std::size_t bytes = std::min(kUpliDataBeatBytes, length - offset);
+  if (!transaction.destination.empty()) {
+    // The caller's buffer may end inside the last doubleword
+    std::copy_n(beat.data.begin(),
+                std::min(bytes, transaction.destination.size() - offset),
+                transaction.destination.begin() + offset);
+  } else if (transaction.beats > 1) {
+    std::copy_n(beat.data.begin(), bytes, transaction.data.begin() + offset);
+  }
+  transaction.beats_received++;
+  if (transaction.beats_received < transaction.beats) {
+    return;
+  }
+
+  // The tag is free again, so the callback may reuse it: gathered data is
+  // copied out of the transaction first
+  std::array<std::byte, kUpliMaxTransferBytes> gathered;
+  std::span<const std::byte> completed =
+      std::span<const std::byte>(beat.data).first(bytes);
+  if (!transaction.destination.empty()) {
+    completed = transaction.destination;
+  } else if (transaction.beats > 1) {
+    std::copy_n(transaction.data.begin(), length, gathered.begin());
+    completed = std::span<const std::byte>(gathered).first(length);
+  }
+  const auto status = static_cast<RspStatus>(transaction.status);
+
+  retire(beat.rd_rsp_tag, false);
+  stats_.read_completions++;
+  if (status != RspStatus::kOkay) {
+    stats_.error_completions++;
+  }
+  if (read_completion_callback_) {
+    read_completion_callback_(beat.rd_rsp_tag, status, completed);
+  }
+}
+
+void UpliOriginator::process_wr_rsp(const UpliWrRspFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  retire(beat.wr_rsp_tag, true);
+  stats_.write_completions++;
+  const auto status = static_cast<RspStatus>(beat.wr_rsp_status);
+  if (status != RspStatus::kOkay) {
+    stats_.error_completions++;
+  }
+
+  if (write_completion_callback_) {
+    write_completion_callback_(beat.wr_rsp_tag, status);
+  }
+}
+
+void UpliOriginator::process_credit_return(const UpliCreditReturn& credits) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  send_queue_.process_credit_return(credits);
+}
\ No newline at end of file
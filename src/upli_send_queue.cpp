@@ -0,0 +1,160 @@
+#include "ualink/upli_send_queue.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+UpliSendQueue::UpliSendQueue(std::size_t backlog_depth)
+    : backlog_depth_(backlog_depth) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (backlog_depth == 0) {
+    throw std::invalid_argument(
+        "UpliSendQueue: backlog_depth must be non-zero");
+  }
+  for (auto& backlog : backlogs_) {
+    backlog.ring.resize(backlog_depth);
+  }
+}
+
+void UpliSendQueue::configure_port(std::uint8_t port_id,
+                                   const PortCreditConfig& config) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  credit_manager_.configure_port(port_id, config);
+}
+
+void UpliSendQueue::initialize_credits() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  credit_manager_.initialize_credits();
+  drain();
+}
+
+std::size_t UpliSendQueue::backlog_index(std::uint8_t port_id,
+                                         std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (port_id >= kMaxPorts) {
+    throw std::invalid_argument("UpliSendQueue: port_id out of range");
+  }
+  if (vc >= kMaxVirtualChannels) {
+    throw std::invalid_argument("UpliSendQueue: vc out of range");
+  }
+  return (static_cast<std::size_t>(port_id) * kMaxVirtualChannels) + vc;
+}
+
+bool UpliSendQueue::try_release(std::uint8_t port_id,
+                                const UpliTdmBeat& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (!credit_manager_.has_credit(port_id, beat.vc)) {
+    return false;
+  }
+  if (release_ && !release_(port_id, beat)) {
+    return false;
+  }
+  [[maybe_unused]] const bool consumed =
+      credit_manager_.consume_credit(port_id, beat.vc);
+  return true;
+}
+
+bool UpliSendQueue::submit(std::uint8_t port_id, const UpliTdmBeat& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::size_t index = backlog_index(port_id, beat.vc);
+  Backlog& backlog = backlogs_[index];
+  BacklogStats& stats = stats_[index];
+  stats.submitted++;
+
+  // Nothing ahead of it: send now if the credit is there
+  if (backlog.count == 0 && try_release(port_id, beat)) {
+    stats.released_immediately++;
+    return true;
+  }
+
+  if (backlog.count == backlog.ring.size()) {
+    stats.rejected++;
+    return false;
+  }
+
+  backlog.ring[(backlog.head + backlog.count) % backlog.ring.size()] =
+      BackloggedBeat{.beat = beat, .enqueue_cycle = cycle_};
+  backlog.count++;
+  backlogged_++;
+  stats.backlogged++;
+  stats.max_backlog_size = std::max(stats.max_backlog_size, backlog.count);
+  return true;
+}
+
+void UpliSendQueue::drain() {
+  UALINK_TRACE_SCOPED(__func__);
+  if (backlogged_ == 0) {
+    return;
+  }
+
+  for (std::size_t index = 0; index < backlogs_.size(); ++index) {
+    Backlog& backlog = backlogs_[index];
+    const auto port_id = static_cast<std::uint8_t>(index / kMaxVirtualChannels);
+    BacklogStats& stats = stats_[index];
+
+    while (backlog.count > 0) {
+      const BackloggedBeat& head = backlog.ring[backlog.head];
+      if (!try_release(port_id, head.beat)) {
+        break;
+      }
+
+      const std::uint64_t blocked = cycle_ - head.enqueue_cycle;
+      const std::size_t bucket = std::min<std::size_t>(
+          std::bit_width(blocked), kBlockedHistogramBuckets - 1);
+      stats.blocked_histogram[bucket]++;
+      stats.total_blocked_cycles += blocked;
+      stats.max_blocked_cycles = std::max(stats.max_blocked_cycles, blocked);
+
+      backlog.head = (backlog.head + 1) % backlog.ring.size();
+      backlog.count--;
+      backlogged_--;
+    }
+  }
+}
+
+void UpliSendQueue::process_credit_return(const UpliCreditReturn& credits) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  credit_manager_.process_credit_return(credits);
+  drain();
+}
+
+void UpliSendQueue::return_credits(std::uint8_t port_id, std::uint8_t vc,
+                                   std::size_t count) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  credit_manager_.return_credits(port_id, vc, count);
+  drain();
+}
+
+void UpliSendQueue::advance_cycle() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  drain();
+  cycle_++;
+}
+
+std::size_t UpliSendQueue::backlog_size(std::uint8_t port_id,
+                                        std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+  return backlogs_[backlog_index(port_id, vc)].count;
+}
+
+const UpliSendQueue::BacklogStats& UpliSendQueue::get_stats(
+    std::uint8_t port_id, std::uint8_t vc) const {
+  UALINK_TRACE_SCOPED(__func__);
+  return stats_[backlog_index(port_id, vc)];
+}
+
+void UpliSendQueue::reset_stats() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  for (auto& stats : stats_) {
+    stats = BacklogStats{};
+  }
+}
\ No newline at end of file
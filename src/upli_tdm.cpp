@@ -0,0 +1,134 @@
+#include "ualink/upli_tdm.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+UpliTdmScheduler::UpliTdmScheduler(BifurcationMode mode,
+                                   std::size_t queue_depth)
+    : mode_(mode), num_ports_(bifurcation_port_count(mode)) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (queue_depth == 0) {
+    throw std::invalid_argument(
+        "UpliTdmScheduler: queue_depth must be non-zero");
+  }
+  for (auto& queue : queues_) {
+    queue.ring.resize(queue_depth);
+  }
+}
+
+std::uint8_t UpliTdmScheduler::current_port_id() const noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  return static_cast<std::uint8_t>(cycle_ % num_ports_);
+}
+
+std::size_t UpliTdmScheduler::queue_index(std::uint8_t port_id,
+                                          UpliChannel channel) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (!is_port_active(port_id)) {
+    throw std::invalid_argument(
+        "UpliTdmScheduler: port_id not active in this bifurcation mode");
+  }
+  const auto channel_index = static_cast<std::size_t>(channel);
+  if (channel_index >= kUpliChannelCount) {
+    throw std::invalid_argument("UpliTdmScheduler: channel out of range");
+  }
+  return (static_cast<std::size_t>(port_id) * kUpliChannelCount) +
+         channel_index;
+}
+
+bool UpliTdmScheduler::enqueue(std::uint8_t port_id, UpliChannel channel,
+                               const UpliTdmBeat& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::size_t index = queue_index(port_id, channel);
+  BeatQueue& queue = queues_[index];
+  ChannelStats& stats = stats_[index];
+
+  if (queue.count == queue.ring.size()) {
+    stats.enqueue_rejected++;
+    return false;
+  }
+
+  queue.ring[(queue.head + queue.count) % queue.ring.size()] = beat;
+  queue.count++;
+  stats.max_queue_size = std::max(stats.max_queue_size, queue.count);
+  return true;
+}
+
+std::size_t UpliTdmScheduler::queue_size(std::uint8_t port_id,
+                                         UpliChannel channel) const {
+  UALINK_TRACE_SCOPED(__func__);
+  return queues_[queue_index(port_id, channel)].count;
+}
+
+std::size_t UpliTdmScheduler::advance_cycle(const GrantCallback& on_grant) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  const std::uint8_t port_id = current_port_id();
+  std::size_t granted = 0;
+
+  // Channels are independent wires; each has its own slot this cycle
+  for (std::size_t channel_index = 0; channel_index < kUpliChannelCount;
+       ++channel_index) {
+    const auto channel = static_cast<UpliChannel>(channel_index);
+    const std::size_t index =
+        (static_cast<std::size_t>(port_id) * kUpliChannelCount) + channel_index;
+    BeatQueue& queue = queues_[index];
+    ChannelStats& stats = stats_[index];
+    stats.slots_owned++;
+
+    if (queue.count == 0) {
+      stats.idle_slots++;
+      continue;
+    }
+
+    const UpliTdmBeat& head = queue.ring[queue.head];
+    if (ready_ && !ready_(port_id, channel, head)) {
+      stats.blocked_slots++;
+      stats.hol_blocked_beats += queue.count - 1;
+      continue;
+    }
+
+    if (on_grant) {
+      on_grant(port_id, channel, head);
+    }
+    queue.head = (queue.head + 1) % queue.ring.size();
+    queue.count--;
+    stats.beats_sent++;
+    granted++;
+  }
+
+  cycle_++;
+  return granted;
+}
+
+const UpliTdmScheduler::ChannelStats& UpliTdmScheduler::get_stats(
+    std::uint8_t port_id, UpliChannel channel) const {
+  UALINK_TRACE_SCOPED(__func__);
+  return stats_[queue_index(port_id, channel)];
+}
+
+double UpliTdmScheduler::port_throughput(std::uint8_t port_id) const {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::uint64_t elapsed = cycle_ - stats_start_cycle_;
+  if (elapsed == 0) {
+    return 0.0;
+  }
+
+  std::size_t beats = 0;
+  for (std::size_t channel_index = 0; channel_index < kUpliChannelCount;
+       ++channel_index) {
+    beats += get_stats(port_id, static_cast<UpliChannel>(channel_index))
+                 .beats_sent;
+  }
+  return static_cast<double>(beats) / static_cast<double>(elapsed);
+}
+
+void UpliTdmScheduler::reset_stats() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  stats_.fill(ChannelStats{});
+  stats_start_cycle_ = cycle_;
+}
\ No newline at end of file
@@ -0,0 +1,446 @@
+#include "ualink/upli_tl_bridge.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <variant>
+
+using namespace ualink::upli;
+using ualink::dl::TlFlit;
+using ualink::tl::TlControlField;
+using ualink::tl::UncompressedRequestField;
+using ualink::tl::UncompressedResponseField;
+
+namespace {
+
+// TL request ADDR is ReqAddr[56:2]
+constexpr unsigned kTlAddressShift = 2;
+
+// UPLI ReqCmd values with a compressed TL CMD encoding travel as that
+// encoding; every other command is carried unchanged
+std::uint8_t tl_cmd_from_upli(std::uint8_t req_cmd) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (req_cmd == static_cast<std::uint8_t>(ReqCmd::kRead)) {
+    return ualink::tl::kTlReqCmdRead;
+  }
+  if (req_cmd == static_cast<std::uint8_t>(ReqCmd::kWrite)) {
+    return ualink::tl::kTlReqCmdWrite;
+  }
+  if (req_cmd == static_cast<std::uint8_t>(ReqCmd::kWriteFull)) {
+    return ualink::tl::kTlReqCmdWriteFull;
+  }
+  return req_cmd;
+}
+
+std::uint8_t upli_cmd_from_tl(std::uint8_t cmd) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (cmd == ualink::tl::kTlReqCmdRead) {
+    return static_cast<std::uint8_t>(ReqCmd::kRead);
+  }
+  if (cmd == ualink::tl::kTlReqCmdWrite) {
+    return static_cast<std::uint8_t>(ReqCmd::kWrite);
+  }
+  if (cmd == ualink::tl::kTlReqCmdWriteFull) {
+    return static_cast<std::uint8_t>(ReqCmd::kWriteFull);
+  }
+  return cmd;
+}
+
+// A TL read with ATTR 0xFF is the plain read, the only one that compresses.
+// A UPLI read's plain req_attr is 0, so reads swap the two values each way
+// and carry every other value unchanged.
+constexpr std::uint8_t kTlPlainReadAttr = 0xFF;
+
+std::uint8_t swap_read_attr(std::uint8_t attr) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (attr == 0) {
+    return kTlPlainReadAttr;
+  }
+  if (attr == kTlPlainReadAttr) {
+    return 0;
+  }
+  return attr;
+}
+
+// Every request but a read carries an OrigData beat
+bool carries_data(std::uint8_t req_cmd) {
+  UALINK_TRACE_SCOPED(__func__);
+  return req_cmd != static_cast<std::uint8_t>(ReqCmd::kRead);
+}
+
+UncompressedRequestField to_tl_request(const UpliRequestFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+  UncompressedRequestField field{};
+  field.cmd = tl_cmd_from_upli(beat.req_cmd);
+  field.vchan = beat.req_vc;
+  field.tag = beat.req_tag;
+  field.attr = beat.req_attr;
+  if (!carries_data(beat.req_cmd)) {
+    field.attr = swap_read_attr(beat.req_attr);
+  }
+  field.len = beat.req_len;
+  field.metadata = beat.req_meta_data;
+  field.addr = beat.req_addr >> kTlAddressShift;
+  field.srcaccid = beat.req_src_phys_acc_id;
+  field.dstaccid = beat.req_dst_phys_acc_id;
+  field.numbeats = beat.req_num_beats;
+  return field;
+}
+
+}  // namespace
+
+UpliTlBridge::UpliTlBridge(const UpliTlBridgeConfig& config)
+    : config_(config),
+      held_writes_(kUpliTagCount),
+      sent_port_(kUpliTagCount, 0),
+      sent_active_(kUpliTagCount, false),
+      received_(kMaxPorts * kUpliTagCount) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  for (auto& fifo : awaiting_data_) {
+    fifo.ring.resize(kUpliTagCount);
+  }
+
+  packer_.set_flit_sink(
+      [this](std::span<const std::byte, tl::kTlFlitBytes> flit) {
+        std::copy(flit.begin(), flit.end(), closed_flit_.begin());
+        closed_ = true;
+      });
+}
+
+// =============================================================================
+// Transmit
+// =============================================================================
+
+void UpliTlBridge::emit(std::span<const std::byte, tl::kTlFlitBytes> bytes) {
+  UALINK_TRACE_SCOPED(__func__);
+  TlFlit& tl_flit = queued_.emplace_back();
+  std::copy(bytes.begin(), bytes.end(), tl_flit.data.begin());
+  tl_flit.message_field = 0;
+  if (!sink_stalled_ && queued_tl_flits() == dl::kMaxTlFlitsPerDlFlit) {
+    send_batches(false);
+  }
+}
+
+// Hand queued TL flits to the sink one DL flit's worth at a time, stopping at
+// a short batch unless include_short, or when the sink refuses some
+void UpliTlBridge::send_batches(bool include_short) {
+  UALINK_TRACE_SCOPED(__func__);
+  while (queued_tl_flits() > 0) {
+    const std::size_t count =
+        std::min(queued_tl_flits(), dl::kMaxTlFlitsPerDlFlit);
+    if (count < dl::kMaxTlFlitsPerDlFlit && !include_short) {
+      break;
+    }
+    std::size_t taken = count;
+    if (tl_flit_sink_) {
+      taken = std::min(count, tl_flit_sink_(std::span<const TlFlit>(
+                                  queued_.data() + queued_head_, count)));
+    }
+    stats_.batches_sent++;
+    if (count < dl::kMaxTlFlitsPerDlFlit) {
+      stats_.short_batches_sent++;
+    }
+    queued_head_ += taken;
+    if (taken < count) {
+      stats_.sink_stalls++;
+      sink_stalled_ = true;
+      break;
+    }
+  }
+  if (queued_head_ == queued_.size()) {
+    queued_.clear();
+    queued_head_ = 0;
+  }
+}
+
+// A closed control flit goes out followed by the data of its fields
+void UpliTlBridge::emit_closed_flit() {
+  UALINK_TRACE_SCOPED(__func__);
+  closed_ = false;
+  emit(closed_flit_);
+  stats_.control_flits_sent++;
+  for (std::size_t index = 0; index < open_data_count_; ++index) {
+    emit(open_data_[index]);
+  }
+  stats_.data_flits_sent += open_data_count_;
+  open_data_count_ = 0;
+}
+
+void UpliTlBridge::push_field(const TlControlField& field,
+                              std::span<const std::byte> data) {
+  UALINK_TRACE_SCOPED(__func__);
+  // The packer closes a flit either before placing the field (no room) or
+  // after it (the field filled the flit). Only in the second case does the
+  // field's data belong to the closed flit.
+  packer_.push(field);
+  const bool field_in_closed_flit = closed_ && !packer_.has_partial_flit();
+
+  if (closed_ && !field_in_closed_flit) {
+    emit_closed_flit();
+  }
+  while (!data.empty()) {
+    const std::size_t bytes = std::min(data.size(), tl::kTlFlitBytes);
+    FlitBytes& slot = open_data_[open_data_count_];
+    slot.fill(std::byte{0});
+    std::copy_n(data.begin(), bytes, slot.begin());
+    open_data_count_++;
+    data = data.subspan(bytes);
+  }
+  if (closed_) {
+    emit_closed_flit();
+  }
+}
+
+void UpliTlBridge::send_request(const UpliRequestFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (beat.req_port_id >= kMaxPorts) {
+    throw std::invalid_argument("UpliTlBridge: req_port_id out of range");
+  }
+  if (beat.req_tag >= kUpliTagCount || sent_active_[beat.req_tag]) {
+    throw std::invalid_argument(
+        "UpliTlBridge: request tag already outstanding");
+  }
+
+  if (!carries_data(beat.req_cmd)) {
+    push_field(to_tl_request(beat), {});
+    sent_active_[beat.req_tag] = true;
+    sent_port_[beat.req_tag] = beat.req_port_id;
+    stats_.requests_sent++;
+    return;
+  }
+
+  // Held until its data beat arrives
+  sent_active_[beat.req_tag] = true;
+  sent_port_[beat.req_tag] = beat.req_port_id;
+  TagFifo& fifo = awaiting_data_[beat.req_port_id];
+  fifo.ring[(fifo.head + fifo.count) % fifo.ring.size()] = beat.req_tag;
+  fifo.count++;
+  held_writes_[beat.req_tag] = beat;
+}
+
+void UpliTlBridge::send_orig_data(const UpliOrigDataFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (beat.orig_data_port_id >= kMaxPorts ||
+      awaiting_data_[beat.orig_data_port_id].count == 0) {
+    throw std::invalid_argument(
+        "UpliTlBridge: OrigData with no write waiting");
+  }
+
+  const std::uint8_t port_id = beat.orig_data_port_id;
+  TagFifo& fifo = awaiting_data_[port_id];
+  const UpliRequestFields& request = held_writes_[fifo.ring[fifo.head]];
+  std::copy(beat.data.begin(), beat.data.end(),
+            write_data_[port_id].begin() +
+                (write_beats_[port_id] * kUpliDataBeatBytes));
+  write_beats_[port_id]++;
+  if (write_beats_[port_id] < request.req_num_beats + 1U) {
+    return;
+  }
+
+  fifo.head = (fifo.head + 1) % fifo.ring.size();
+  fifo.count--;
+  push_field(to_tl_request(request),
+             std::span<const std::byte>(write_data_[port_id])
+                 .first(write_beats_[port_id] * kUpliDataBeatBytes));
+  write_beats_[port_id] = 0;
+  stats_.requests_sent++;
+}
+
+UpliTlBridge::ReceivedRequest& UpliTlBridge::received(std::uint8_t port_id,
+                                                      std::uint16_t tag) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (port_id >= kMaxPorts || tag >= kUpliTagCount) {
+    throw std::invalid_argument("UpliTlBridge: port or tag out of range");
+  }
+  return received_[(static_cast<std::size_t>(port_id) * kUpliTagCount) + tag];
+}
+
+void UpliTlBridge::send_rd_rsp(const UpliRdRspFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  ReceivedRequest& request = received(beat.rd_rsp_port_id, beat.rd_rsp_tag);
+  if (!request.active) {
+    throw std::invalid_argument(
+        "UpliTlBridge: response to a request never received");
+  }
+
+  // One field per beat: OFFSET places it, LAST ends the transfer
+  const bool last = request.beats_sent + 1U == request.beats;
+  UncompressedResponseField field{};
+  field.vchan = request.vc;
+  field.tag = beat.rd_rsp_tag;
+  field.offset = request.beats_sent;
+  field.status = beat.rd_rsp_status;
+  field.rd_wr = false;
+  field.last = last;
+  field.srcaccid = config_.physical_acc_id;
+  field.dstaccid = request.src_acc_id;
+  push_field(field, beat.data);
+  request.beats_sent++;
+  if (last) {
+    request.active = false;
+    stats_.responses_sent++;
+  }
+}
+
+void UpliTlBridge::send_wr_rsp(const UpliWrRspFields& beat) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  ReceivedRequest& request = received(beat.wr_rsp_port_id, beat.wr_rsp_tag);
+  if (!request.active) {
+    throw std::invalid_argument(
+        "UpliTlBridge: response to a request never received");
+  }
+
+  UncompressedResponseField field{};
+  field.vchan = request.vc;
+  field.tag = beat.wr_rsp_tag;
+  field.status = beat.wr_rsp_status;
+  field.rd_wr = true;
+  field.srcaccid = config_.physical_acc_id;
+  field.dstaccid = request.src_acc_id;
+  push_field(field, {});
+  request.active = false;
+  stats_.responses_sent++;
+}
+
+void UpliTlBridge::flush() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  packer_.flush();
+  if (closed_) {
+    emit_closed_flit();
+  }
+  sink_stalled_ = false;
+  send_batches(true);
+}
+
+// =============================================================================
+// Receive
+// =============================================================================
+
+std::uint8_t UpliTlBridge::sent_port(std::uint16_t tag) const {
+  UALINK_TRACE_SCOPED(__func__);
+  if (tag >= kUpliTagCount || !sent_active_[tag]) {
+    throw std::invalid_argument("UpliTlBridge: response tag not outstanding");
+  }
+  return sent_port_[tag];
+}
+
+void UpliTlBridge::on_field(const TlControlField& field) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (const auto* request = std::get_if<UncompressedRequestField>(&field)) {
+    UpliRequestFields beat{};
+    beat.req_vld = true;
+    beat.req_addr = request->addr << kTlAddressShift;
+    beat.req_port_id = static_cast<std::uint8_t>(
+        (beat.req_addr / kRegionAlignmentBytes) %
+        bifurcation_port_count(config_.bifurcation));
+    beat.req_src_phys_acc_id = request->srcaccid;
+    beat.req_dst_phys_acc_id = request->dstaccid;
+    beat.req_tag = request->tag;
+    beat.req_cmd = upli_cmd_from_tl(request->cmd);
+    beat.req_len = request->len;
+    beat.req_num_beats = request->numbeats;
+    beat.req_attr = request->attr;
+    if (!carries_data(beat.req_cmd)) {
+      beat.req_attr = swap_read_attr(request->attr);
+    }
+    beat.req_meta_data = request->metadata;
+    beat.req_vc = request->vchan;
+
+    ReceivedRequest& slot = received(beat.req_port_id, beat.req_tag);
+    if (slot.active) {
+      throw std::invalid_argument(
+          "UpliTlBridge: request tag already outstanding");
+    }
+    slot = ReceivedRequest{
+        .active = true,
+        .vc = beat.req_vc,
+        .src_acc_id = beat.req_src_phys_acc_id,
+        .beats = static_cast<std::uint8_t>(upli_data_beats(beat.req_len))};
+    stats_.requests_received++;
+
+    if (carries_data(beat.req_cmd)) {
+      expected_[expected_count_++] = ExpectedData{
+          .write = true,
+          .port_id = beat.req_port_id,
+          .beats = static_cast<std::uint8_t>(beat.req_num_beats + 1U)};
+    }
+    if (request_sink_) {
+      request_sink_(beat);
+    }
+    return;
+  }
+
+  const auto* response = std::get_if<UncompressedResponseField>(&field);
+  if (response == nullptr) {
+    return;  // Flow control; credits are not modeled on this path
+  }
+
+  const std::uint8_t port_id = sent_port(response->tag);
+  if (response->rd_wr || response->last) {
+    sent_active_[response->tag] = false;
+    stats_.responses_received++;
+  }
+
+  if (response->rd_wr) {
+    UpliWrRspFields beat{};
+    beat.wr_rsp_vld = true;
+    beat.wr_rsp_port_id = port_id;
+    beat.wr_rsp_tag = response->tag;
+    beat.wr_rsp_status = response->status;
+    if (wr_rsp_sink_) {
+      wr_rsp_sink_(beat);
+    }
+    return;
+  }
+
+  ExpectedData& expected = expected_[expected_count_++];
+  expected = ExpectedData{.write = false, .port_id = port_id};
+  expected.read_response.rd_rsp_vld = true;
+  expected.read_response.rd_rsp_port_id = port_id;
+  expected.read_response.rd_rsp_tag = response->tag;
+  expected.read_response.rd_rsp_status = response->status;
+}
+
+void UpliTlBridge::receive_tl_flit(const TlFlit& tl_flit) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  if (expected_next_ < expected_count_) {
+    ExpectedData& expected = expected_[expected_next_];
+    expected.beats--;
+    if (expected.beats == 0) {
+      expected_next_++;
+    }
+    if (expected.write) {
+      UpliOrigDataFields beat{};
+      beat.orig_data_vld = true;
+      beat.orig_data_port_id = expected.port_id;
+      beat.data = tl_flit.data;
+      if (orig_data_sink_) {
+        orig_data_sink_(beat);
+      }
+    } else {
+      expected.read_response.data = tl_flit.data;
+      if (rd_rsp_sink_) {
+        rd_rsp_sink_(expected.read_response);
+      }
+    }
+    return;
+  }
+
+  // A control flit; its fields' data flits come next
+  expected_count_ = 0;
+  expected_next_ = 0;
+  unpacker_.unpack(tl_flit.data,
+                   [this](const TlControlField& field) { on_field(field); });
+}
+
+void UpliTlBridge::reset_stats() noexcept {
+  UALINK_TRACE_SCOPED(__func__);
+  stats_ = Stats{};
+  packer_.reset_stats();
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "ualink/upli_transfer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+namespace {
+
+constexpr std::uint64_t kMaxUpliAddress = 0x1FFFFFFFFFFFFFFULL;  // 57 bits
+constexpr std::uint16_t kMaxAccId = 0x3FF;                       // 10 bits
+constexpr std::size_t kDwordBytes = 4;
+
+}  // namespace
+
+UpliTransferEngine::UpliTransferEngine(const UpliTransferEngineConfig& config)
+    : config_(config),
+      originator_(config.originator),
+      transfers_(config.max_transfers),
+      issue_ring_(config.max_transfers),
+      tag_transfer_(config.originator.max_outstanding_requests, kNoTransfer) {
+  UALINK_TRACE_SCOPED(__func__);
+  if (config.max_transfers == 0) {
+    throw std::invalid_argument(
+        "UpliTransferEngine: max_transfers must be nonzero");
+  }
+  if (config.originator.queue_depth < kUpliMaxDataBeats) {
+    throw std::invalid_argument(
+        "UpliTransferEngine: queue_depth must hold a 256-byte write");
+  }
+
+  free_slots_.reserve(config.max_transfers);
+  for (std::size_t slot = config.max_transfers; slot > 0; --slot) {
+    free_slots_.push_back(slot - 1);
+  }
+
+  originator_.set_read_completion_callback(
+      [this](std::uint16_t tag, RspStatus status, std::span<const std::byte>) {
+        on_complete(tag, status);
+      });
+  originator_.set_write_completion_callback(
+      [this](std::uint16_t tag, RspStatus status) {
+        on_complete(tag, status);
+      });
+}
+
+std::optional<std::uint64_t> UpliTransferEngine::read(
+    std::uint16_t dst_acc_id, std::uint64_t address,
+    std::span<std::byte> destination, std::uint8_t vc) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  Transfer transfer{};
+  transfer.write = false;
+  transfer.dst_acc_id = dst_acc_id;
+  transfer.vc = vc;
+  transfer.address = address;
+  transfer.bytes = destination.size();
+  transfer.destination = destination;
+  return submit(transfer);
+}
+
+std::optional<std::uint64_t> UpliTransferEngine::write(
+    std::uint16_t dst_acc_id, std::uint64_t address,
+    std::span<const std::byte> data, std::uint8_t vc) {
+  UALINK_TRACE_SCOPED(__func__);
+
+  Transfer transfer{};
+  transfer.write = true;
+  transfer.dst_acc_id = dst_acc_id;
+  transfer.vc = vc;
+  transfer.address = address;
+  transfer.bytes = data.size();
+  transfer.data = data;
+  return submit(transfer);
+}
+
+std::optional<std::uint64_t> UpliTransferEngine::submit(Transfer transfer) {
+  UALINK_TRACE_SCOPED(__func__);
+  // Validate everything a chunk could fail on, so no chunk throws part-way
+  // through a transfer
+  if (transfer.bytes == 0) {
+    throw std::invalid_argument("UpliTransferEngine: transfer is empty");
+  }
+  if (transfer.address % kDwordBytes != 0 ||
+      transfer.bytes % kDwordBytes != 0) {
+    throw std::invalid_argument(
+        "UpliTransferEngine: transfer is not doubleword aligned");
+  }
+  if (transfer.address > kMaxUpliAddress ||
+      transfer.bytes - 1 > kMaxUpliAddress - transfer.address) {
+    throw std::invalid_argument("UpliTransferEngine: address out of range");
+  }
+  if (transfer.dst_acc_id > kMaxAccId) {
+    throw std::invalid_argument("UpliTransferEngine: dst_acc_id out of range");
+  }
+  if (transfer.vc >= kMaxVirtualChannels) {
+    throw std::invalid_argument("UpliTransferEngine: vc out of range");
+  }
+
+  if (free_slots_.empty()) {
+    stats_.transfer_full_stalls++;
+    return std::nullopt;
+  }
+
+  const std::size_t slot = free_slots_.back();
+  free_slots_.pop_back();
+  transfer.id = next_id_++;
+  transfer.submit_cycle = originator_.cycle();
+  transfers_[slot] = transfer;
+
+  issue_ring_[(issue_head_ + issue_count_) % issue_ring_.size()] = slot;
+  issue_count_++;
+  stats_.transfers_submitted++;
+  stats_.max_active = std::max(stats_.max_active, active());
+
+  pump();
+  return transfer.id;
+}
+
+void UpliTransferEngine::pump() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  while (issue_count_ > 0) {
+    const std::size_t slot = issue_ring_[issue_head_];
+    Transfer& transfer = transfers_[slot];
+
+    // The largest chunk that stays within its 256-byte region
+    const std::size_t offset = transfer.issued_bytes;
+    const std::uint64_t address = transfer.address + offset;
+    const std::size_t chunk = std::min(
+        transfer.bytes - offset,
+        kRegionAlignmentBytes - (address % kRegionAlignmentBytes));
+
+    std::optional<std::uint16_t> tag;
+    if (transfer.write) {
+      tag = originator_.send_write(transfer.dst_acc_id, address,
+                                   transfer.data.subspan(offset, chunk),
+                                   transfer.vc);
+    } else {
+      tag = originator_.send_read_into(
+          transfer.dst_acc_id, address,
+          transfer.destination.subspan(offset, chunk), transfer.vc);
+    }
+    if (!tag.has_value()) {
+      stats_.issue_stalls++;
+      return;
+    }
+
+    tag_transfer_[*tag] = slot;
+    transfer.issued_bytes += chunk;
+    transfer.transactions++;
+    transfer.outstanding++;
+    stats_.transactions_issued++;
+
+    if (transfer.issued_bytes == transfer.bytes) {
+      issue_head_ = (issue_head_ + 1) % issue_ring_.size();
+      issue_count_--;
+    }
+  }
+}
+
+std::size_t UpliTransferEngine::advance_cycle() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  pump();
+  return originator_.advance_cycle();
+}
+
+void UpliTransferEngine::on_complete(std::uint16_t tag, RspStatus status) {
+  UALINK_TRACE_SCOPED(__func__);
+  const std::size_t slot = tag_transfer_[tag];
+  if (slot == kNoTransfer) {
+    return;  // Sent directly on originator(), not part of a transfer
+  }
+  tag_transfer_[tag] = kNoTransfer;
+
+  Transfer& transfer = transfers_[slot];
+  transfer.outstanding--;
+  if (transfer.status == 0) {
+    transfer.status = static_cast<std::uint8_t>(status);
+  }
+  if (transfer.outstanding == 0 && transfer.issued_bytes == transfer.bytes) {
+    finish(slot);
+  }
+}
+
+void UpliTransferEngine::finish(std::size_t slot) {
+  UALINK_TRACE_SCOPED(__func__);
+  const Transfer& transfer = transfers_[slot];
+
+  UpliTransferCompletion completion{};
+  completion.id = transfer.id;
+  completion.write = transfer.write;
+  completion.status = static_cast<RspStatus>(transfer.status);
+  completion.address = transfer.address;
+  completion.bytes = transfer.bytes;
+  completion.transactions = transfer.transactions;
+  completion.submit_cycle = transfer.submit_cycle;
+  completion.complete_cycle = originator_.cycle();
+
+  // The slot is free before the callback, so it may submit the next transfer
+  free_slots_.push_back(slot);
+  stats_.transfers_completed++;
+  if (completion.status != RspStatus::kOkay) {
+    stats_.error_transfers++;
+  }
+  if (completion.write) {
+    stats_.bytes_written += completion.bytes;
+  } else {
+    stats_.bytes_read += completion.bytes;
+  }
+
+  if (completion_callback_) {
+    completion_callback_(completion);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include "ualink/dl_channel_model.h"
+
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+#include "ualink/trace.h"
+
+using namespace ualink::dl;
+
+static DlFlit make_valid_flit() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  std::array<TlFlit, 4> tl_flits{};
+  for (std::size_t flit_index = 0; flit_index < tl_flits.size(); ++flit_index) {
+    tl_flits[flit_index].data.fill(static_cast<std::byte>(0xA0 + flit_index));
+  }
+
+  ExplicitFlitHeaderFields header{};
+  header.op = 0;
+  header.payload = true;
+  header.flit_seq_no = 1;
+  return DlSerializer::serialize(tl_flits, header);
+}
+
+static void test_flip_wire_bit_mapping() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlFlit flit{};
+  flip_wire_bit(flit, 0);
+  assert(flit.flit_header[0] == std::byte{0x80});
+
+  flip_wire_bit(flit, 3 * 8 + 7);
+  assert(flit.segment_headers[0] == std::byte{0x01});
+
+  flip_wire_bit(flit, 8 * 8);
+  assert(flit.payload[0] == std::byte{0x80});
+
+  flip_wire_bit(flit, kDlFlitBits - 1);
+  assert(flit.crc[3] == std::byte{0x01});
+
+  bool threw = false;
+  try {
+    flip_wire_bit(flit, kDlFlitBits);
+  } catch (const std::out_of_range &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "test_flip_wire_bit_mapping: PASS\n";
+}
+
+static void test_zero_ber_is_clean() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlBitErrorChannel channel({.bit_error_rate = 0.0, .seed = 3});
+  const DlFlit original = make_valid_flit();
+
+  for (std::size_t flit_index = 0; flit_index < 1000; ++flit_index) {
+    DlFlit wire = original;
+    assert(channel.transmit(wire) == 0);
+    assert(wire.payload == original.payload);
+    assert(wire.crc == original.crc);
+  }
+
+  const auto stats = channel.get_stats();
+  assert(stats.flits == 1000);
+  assert(stats.flits_corrupted == 0);
+  assert(stats.bits_flipped == 0);
+
+  std::cout << "test_zero_ber_is_clean: PASS\n";
+}
+
+static void test_crc_detects_channel_errors() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlBitErrorChannel channel({.bit_error_rate = 1e-4, .seed = 11});
+  const DlFlit original = make_valid_flit();
+
+  std::size_t crc_failures = 0;
+  for (std::size_t flit_index = 0; flit_index < 5000; ++flit_index) {
+    DlFlit wire = original;
+    const std::size_t bits_flipped = channel.transmit(wire);
+    const bool crc_ok = DlDeserializer::deserialize_with_crc_check(wire).has_value();
+    assert(crc_ok == (bits_flipped == 0));
+    if (!crc_ok) {
+      crc_failures++;
+    }
+  }
+
+  const auto stats = channel.get_stats();
+  assert(stats.flits_corrupted == crc_failures);
+  assert(stats.bits_flipped == stats.error_events); // single-bit events
+
+  // P(flit corrupted) = 1 - (1 - 1e-4)^5120 ~= 0.40; allow a wide band
+  assert(crc_failures > 1800 && crc_failures < 2200);
+
+  std::cout << "test_crc_detects_channel_errors: PASS\n";
+}
+
+static void test_ber_rate() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlBitErrorChannel channel({.bit_error_rate = 1e-6, .seed = 99});
+  DlFlit wire{};
+  constexpr std::size_t kFlits = 200'000;
+  for (std::size_t flit_index = 0; flit_index < kFlits; ++flit_index) {
+    [[maybe_unused]] const std::size_t bits_flipped = channel.transmit(wire);
+  }
+
+  // Expected events: 200000 * 5120 * 1e-6 = 1024
+  const auto stats = channel.get_stats();
+  assert(stats.error_events > 900 && stats.error_events < 1150);
+
+  std::cout << "test_ber_rate: PASS\n";
+}
+
+static void test_burst_errors() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlBitErrorChannel channel({.bit_error_rate = 1e-4, .mean_burst_length = 16.0, .seed = 5});
+  const DlFlit original = make_valid_flit();
+
+  for (std::size_t flit_index = 0; flit_index < 2000; ++flit_index) {
+    DlFlit wire = original;
+    const std::size_t bits_flipped = channel.transmit(wire);
+    const bool crc_ok = DlDeserializer::deserialize_with_crc_check(wire).has_value();
+    assert(crc_ok == (bits_flipped == 0));
+  }
+
+  const auto stats = channel.get_stats();
+  assert(stats.error_events > 0);
+  assert(stats.bits_flipped > stats.error_events * 2);
+
+  std::cout << "test_burst_errors: PASS\n";
+}
+
+static void test_reproducible_by_seed() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlBitErrorChannel channel_a({.bit_error_rate = 1e-4, .mean_burst_length = 4.0, .seed = 77});
+  DlBitErrorChannel channel_b({.bit_error_rate = 1e-4, .mean_burst_length = 4.0, .seed = 77});
+  const DlFlit original = make_valid_flit();
+
+  for (std::size_t flit_index = 0; flit_index < 1000; ++flit_index) {
+    DlFlit wire_a = original;
+    DlFlit wire_b = original;
+    assert(channel_a.transmit(wire_a) == channel_b.transmit(wire_b));
+    assert(wire_a.payload == wire_b.payload);
+    assert(wire_a.crc == wire_b.crc);
+  }
+
+  std::cout << "test_reproducible_by_seed: PASS\n";
+}
+
+static void test_invalid_config() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  bool threw = false;
+  try {
+    DlBitErrorChannel channel({.bit_error_rate = 1.5});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try {
+    DlBitErrorChannel channel({.bit_error_rate = 1e-6, .mean_burst_length = 0.5});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "test_invalid_config: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_flip_wire_bit_mapping();
+  test_zero_ber_is_clean();
+  test_crc_detects_channel_errors();
+  test_ber_rate();
+  test_burst_errors();
+  test_reproducible_by_seed();
+  test_invalid_config();
+
+  std::cout << "\nAll DL channel model tests passed!\n";
+  return 0;
+}
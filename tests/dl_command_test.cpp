@@ -1,5 +1,6 @@
 #include "ualink/dl_command.h"
 
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <iostream>
@@ -236,9 +237,199 @@ void test_ack_nak_manager_duplicate() {
   // Process sequence 1 again (duplicate)
   command_flit = manager.process_received_flit(1, 0);
 
-  // Should not generate any command for duplicate
+  // Duplicate means our ACK was lost - re-ACK the last in-order flit
+  assert(command_flit.has_value());
+  const CommandFlitHeaderFields header = deserialize_command_flit_header(command_flit->flit_header);
+  assert(header.op == static_cast<std::uint8_t>(DlCommandOp::kAck));
+  assert(header.ack_req_seq == 1);
+
+  // Further duplicates of the same value are not re-ACKed again
+  command_flit = manager.process_received_flit(1, 0);
+  assert(!command_flit.has_value());
+
+  const auto stats = manager.get_stats();
+  assert(stats.duplicates_received == 2);
+  assert(stats.reacks_sent == 1);
+  assert(stats.acks_sent == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Test ACK/NAK manager - duplicates re-ACKed across the 511 -> 1 wrap
+void test_ack_nak_manager_duplicate_after_wrap() {
+  std::cout << "test_ack_nak_manager_duplicate_after_wrap: ";
+
+  DlAckNakManager manager;
+  manager.set_ack_every_n_flits(0);
+
+  // A duplicate before anything arrived in sequence has nothing to re-ACK
+  auto command_flit = manager.process_received_flit(300, 0);
   assert(!command_flit.has_value());
 
+  for (std::uint16_t seq = 1; seq <= 511; ++seq) {
+    command_flit = manager.process_received_flit(seq, 0);
+    assert(command_flit.has_value());
+  }
+  assert(manager.expected_rx_seq() == 1);
+
+  // Expecting 1 after the wrap, so the last in-order flit is 511
+  command_flit = manager.process_received_flit(510, 0);
+  assert(command_flit.has_value());
+  CommandFlitHeaderFields header = deserialize_command_flit_header(command_flit->flit_header);
+  assert(header.op == static_cast<std::uint8_t>(DlCommandOp::kAck));
+  assert(header.ack_req_seq == 511);
+
+  // The first flit after the wrap is re-ACKed as well
+  command_flit = manager.process_received_flit(1, 0);
+  assert(command_flit.has_value());
+  command_flit = manager.process_received_flit(1, 0);
+  assert(command_flit.has_value());
+  header = deserialize_command_flit_header(command_flit->flit_header);
+  assert(header.ack_req_seq == 1);
+
+  const auto stats = manager.get_stats();
+  assert(stats.duplicates_received == 3);
+  assert(stats.reacks_sent == 2);
+
+  std::cout << "PASS\n";
+}
+
+// Test ACK/NAK manager - one Replay Request per gap
+void test_ack_nak_manager_replay_suppression() {
+  std::cout << "test_ack_nak_manager_replay_suppression: ";
+
+  DlAckNakManager manager;
+  manager.set_replay_retry_flits(0); // Never retry
+
+  assert(manager.process_received_flit(1, 0).has_value());
+
+  // Flit 2 lost; 3..10 arrive out of order - only the first triggers a request
+  std::size_t replay_requests = 0;
+  for (std::uint16_t seq = 3; seq <= 10; ++seq) {
+    const auto command_flit = manager.process_received_flit(seq, 0);
+    if (command_flit.has_value()) {
+      const CommandFlitHeaderFields header = deserialize_command_flit_header(command_flit->flit_header);
+      assert(header.op == static_cast<std::uint8_t>(DlCommandOp::kReplayRequest));
+      assert(header.ack_req_seq == 2);
+      replay_requests++;
+    }
+  }
+  assert(replay_requests == 1);
+  assert(manager.is_replay_outstanding());
+
+  // Replayed flit 2 fills the gap
+  assert(manager.process_received_flit(2, 0).has_value());
+  assert(!manager.is_replay_outstanding());
+
+  const auto stats = manager.get_stats();
+  assert(stats.replay_requests_sent == 1);
+  assert(stats.replay_requests_suppressed == 7);
+  assert(stats.out_of_order_received == 8);
+  assert(stats.flits_accepted == 2);
+
+  // A new gap gets its own request
+  const auto command_flit = manager.process_received_flit(5, 0);
+  assert(command_flit.has_value());
+  assert(manager.get_stats().replay_requests_sent == 2);
+
+  std::cout << "PASS\n";
+}
+
+// Test ACK/NAK manager - replay retry timer
+void test_ack_nak_manager_replay_retry() {
+  std::cout << "test_ack_nak_manager_replay_retry: ";
+
+  DlAckNakManager manager;
+  manager.set_replay_retry_flits(4);
+  assert(manager.get_replay_retry_flits() == 4);
+
+  // No gap - tick does nothing
+  assert(!manager.tick(0).has_value());
+
+  // Gap at 1
+  assert(manager.process_received_flit(2, 0).has_value());
+
+  // Three more flit times without the gap being filled - still suppressed
+  assert(!manager.process_received_flit(3, 0).has_value());
+  assert(!manager.tick(0).has_value());
+  assert(!manager.tick(0).has_value());
+
+  // Fourth flit time - retry
+  const auto retry = manager.tick(0);
+  assert(retry.has_value());
+  const CommandFlitHeaderFields header = deserialize_command_flit_header(retry->flit_header);
+  assert(header.op == static_cast<std::uint8_t>(DlCommandOp::kReplayRequest));
+  assert(header.ack_req_seq == 1);
+
+  const auto stats = manager.get_stats();
+  assert(stats.replay_requests_sent == 2);
+  assert(stats.replay_request_retries == 1);
+  assert(stats.replay_requests_suppressed == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Test ACK/NAK manager - goodput under loss matches go-back-N bound
+void test_ack_nak_manager_go_back_n_goodput() {
+  std::cout << "test_ack_nak_manager_go_back_n_goodput: ";
+
+  // Sender keeps a window of kWindow flits in flight. On a Replay Request it
+  // rewinds to the requested sequence (go-back-N). The Replay Request takes
+  // kWindow flit times to reach the sender, so each loss wastes ~kWindow flits.
+  constexpr std::uint16_t kWindow = 16;
+  constexpr std::uint16_t kTotalFlits = 400;
+  constexpr std::uint16_t kLossEvery = 100;
+
+  DlAckNakManager manager;
+  manager.set_replay_retry_flits(0);
+
+  std::uint16_t next_tx = 1;
+  std::size_t wire_flits = 0;
+  std::size_t losses = 0;
+  std::optional<std::uint16_t> pending_rewind{};
+  std::size_t rewind_delay = 0;
+  std::array<bool, 512> already_lost{};
+
+  while (manager.expected_rx_seq() <= kTotalFlits && wire_flits < 10000) {
+    if (pending_rewind.has_value() && rewind_delay == 0) {
+      next_tx = *pending_rewind;
+      pending_rewind.reset();
+    }
+
+    const std::uint16_t seq = next_tx++;
+    wire_flits++;
+    if (rewind_delay > 0) {
+      rewind_delay--;
+    }
+
+    const bool lose = (seq % kLossEvery == 0) && !already_lost[seq];
+    if (lose) {
+      already_lost[seq] = true;
+      losses++;
+      continue;
+    }
+
+    const auto command_flit = manager.process_received_flit(seq, 0);
+    if (command_flit.has_value()) {
+      const CommandFlitHeaderFields header = deserialize_command_flit_header(command_flit->flit_header);
+      if (header.op == static_cast<std::uint8_t>(DlCommandOp::kReplayRequest)) {
+        pending_rewind = header.ack_req_seq;
+        rewind_delay = kWindow;
+      }
+    }
+  }
+
+  const auto stats = manager.get_stats();
+  assert(losses == kTotalFlits / kLossEvery);
+
+  // Exactly one Replay Request per loss - no storm
+  assert(stats.replay_requests_sent == losses);
+  assert(stats.flits_accepted == kTotalFlits);
+
+  // Go-back-N bound: each loss costs the lost flit plus ~kWindow in-flight flits
+  const std::size_t bound = kTotalFlits + (losses * (kWindow + 2));
+  assert(wire_flits <= bound);
+
   std::cout << "PASS\n";
 }
 
@@ -339,7 +530,11 @@ int main() {
   test_ack_nak_manager_expected_sequence();
   test_ack_nak_manager_out_of_order();
   test_ack_nak_manager_duplicate();
+  test_ack_nak_manager_duplicate_after_wrap();
   test_ack_nak_manager_ack_every_n();
+  test_ack_nak_manager_replay_suppression();
+  test_ack_nak_manager_replay_retry();
+  test_ack_nak_manager_go_back_n_goodput();
 
   // Utility function tests
   test_deserialize_command_op();
@@ -0,0 +1,241 @@
+#include "ualink/dl_concurrent_message_queue.h"
+#include "ualink/dl_flit.h"
+#include "ualink/trace.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ualink::dl;
+
+static TlRateNotification make_rate_notification(std::uint16_t rate) {
+  TlRateNotification msg{};
+  msg.rate = rate;
+  msg.common = make_common(DlBasicMessageType::kTlRateNotification);
+  return msg;
+}
+
+static ChannelNegotiation make_channel_negotiation() {
+  ChannelNegotiation msg{};
+  msg.common = make_common(DlControlMessageType::kChannelOnlineOfflineNegotiation);
+  return msg;
+}
+
+static UartStreamTransportMessage make_uart_transport(std::size_t payload_count) {
+  UartStreamTransportMessage msg{};
+  msg.stream_id = 0;
+  msg.common = make_common(DlUartMessageType::kStreamTransportMessage);
+  for (std::uint32_t i = 0; i < payload_count; ++i) {
+    msg.payload_dwords.push_back(0xF00D0000U | i);
+  }
+  return msg;
+}
+
+static MessageGroup group_of_dword(const std::array<std::byte, 4> &dword) {
+  // Every DL message keeps mtype / mclass in the same bits as a No-Op
+  const auto common = deserialize_no_op_message(dword);
+  assert(common.has_value());
+  if (common->common.mclass == static_cast<std::uint8_t>(DlMessageClass::kBasic)) {
+    return MessageGroup::kBasic;
+  }
+  if (common->common.mclass == static_cast<std::uint8_t>(DlMessageClass::kControl)) {
+    return MessageGroup::kControl;
+  }
+  return MessageGroup::kUart;
+}
+
+static void test_matches_single_threaded_queue() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageQueue reference;
+  DlConcurrentMessageQueue queue;
+
+  const std::vector<DlMessage> messages = {
+      make_rate_notification(1), make_rate_notification(2), make_channel_negotiation(),
+      make_uart_transport(3),    make_rate_notification(3), make_channel_negotiation(),
+  };
+  for (const DlMessage &msg : messages) {
+    reference.enqueue(msg);
+    queue.enqueue(msg);
+  }
+
+  // Same DWords in the same order: round-robin plus UART blocking
+  std::size_t dwords = 0;
+  while (reference.has_pending_messages()) {
+    assert(queue.has_pending_messages());
+    const auto expected = reference.pop_next_dword();
+    const auto actual = queue.pop_next_dword();
+    assert(expected.has_value() && actual.has_value());
+    assert(*expected == *actual);
+    dwords++;
+  }
+  assert(dwords == 9);
+  assert(!queue.has_pending_messages());
+  assert(!queue.pop_next_dword().has_value());
+
+  const auto stats = queue.get_stats();
+  assert(stats.basic_enqueued == 3);
+  assert(stats.control_enqueued == 2);
+  assert(stats.uart_enqueued == 1);
+  assert(stats.basic_sent == 3);
+  assert(stats.control_sent == 2);
+  assert(stats.uart_sent == 1);
+  assert(stats.uart_multi_flit_count == 1);
+
+  std::cout << "test_matches_single_threaded_queue: PASS\n";
+}
+
+static void test_full_ring() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlConcurrentMessageQueue queue;
+  for (std::size_t i = 0; i < kConcurrentDlMessageSlots; ++i) {
+    assert(queue.try_enqueue(make_rate_notification(static_cast<std::uint16_t>(i))));
+  }
+  assert(!queue.try_enqueue(make_rate_notification(0)));
+
+  bool threw = false;
+  try {
+    queue.enqueue(make_rate_notification(0));
+  } catch (const std::length_error &) {
+    threw = true;
+  }
+  assert(threw);
+
+  // Other groups are independent
+  assert(queue.try_enqueue(make_channel_negotiation()));
+
+  // Draining one message frees one slot
+  [[maybe_unused]] const auto dword = queue.pop_next_dword();
+  assert(queue.try_enqueue(make_rate_notification(0)));
+
+  std::cout << "test_full_ring: PASS\n";
+}
+
+static void test_invalid_message_rejected() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlConcurrentMessageQueue queue;
+  UartStreamTransportMessage empty_transport = make_uart_transport(0);
+
+  bool threw = false;
+  try {
+    queue.enqueue(empty_transport);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+  assert(!queue.has_pending_messages());
+
+  std::cout << "test_invalid_message_rejected: PASS\n";
+}
+
+static void test_concurrent_producers() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  constexpr std::size_t kProducers = 4;
+  constexpr std::size_t kMessagesPerProducer = 5000;
+
+  DlConcurrentMessageQueue queue;
+  std::atomic<std::size_t> producers_done{0};
+
+  // Producer p sends rate notifications tagged (p << 13) | i, in order of i;
+  // producer 0 also interleaves UART transports and producer 1 channel negotiations
+  std::vector<std::thread> producers;
+  for (std::size_t producer = 0; producer < kProducers; ++producer) {
+    producers.emplace_back([&queue, &producers_done, producer]() {
+      for (std::size_t i = 0; i < kMessagesPerProducer; ++i) {
+        const auto rate = static_cast<std::uint16_t>((producer << 13) | i);
+        while (!queue.try_enqueue(make_rate_notification(rate))) {
+          std::this_thread::yield();
+        }
+        if (producer == 0 && i % 50 == 0) {
+          while (!queue.try_enqueue(make_uart_transport(32))) {
+            std::this_thread::yield();
+          }
+        }
+        if (producer == 1 && i % 25 == 0) {
+          while (!queue.try_enqueue(make_channel_negotiation())) {
+            std::this_thread::yield();
+          }
+        }
+      }
+      producers_done.fetch_add(1);
+    });
+  }
+
+  // Consumer: drain through the serializer and check per-producer order
+  std::array<std::size_t, kProducers> next_index{};
+  std::size_t uart_dwords = 0;
+  std::size_t control_dwords = 0;
+  ExplicitFlitHeaderFields header{};
+  header.flit_seq_no = 1;
+  const DlAltSectorConfig alt_sector{.dwords = 8};
+  std::size_t uart_remaining = 0; // a UART transport may continue into the next flit
+
+  while (producers_done.load() < kProducers || queue.has_pending_messages()) {
+    const DlFlit flit = DlSerializer::serialize({}, header, &queue, alt_sector);
+    const auto result = DlDeserializer::deserialize_ex(flit, alt_sector);
+
+    for (const auto &dword : result.dl_message_dwords) {
+      if (dword == std::array<std::byte, 4>{}) {
+        continue; // No-Op sector fill
+      }
+      if (uart_remaining > 0) {
+        uart_remaining--;
+        uart_dwords++;
+        continue;
+      }
+
+      const MessageGroup group = group_of_dword(dword);
+      if (group == MessageGroup::kBasic) {
+        const auto msg = deserialize_tl_rate_notification(dword);
+        assert(msg.has_value());
+        const std::size_t producer = msg->rate >> 13;
+        assert(producer < kProducers);
+        assert((msg->rate & 0x1FFFU) == next_index[producer]);
+        next_index[producer]++;
+      } else if (group == MessageGroup::kControl) {
+        control_dwords++;
+      } else {
+        uart_dwords++;
+        uart_remaining = 32;
+      }
+    }
+  }
+
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+
+  for (std::size_t producer = 0; producer < kProducers; ++producer) {
+    assert(next_index[producer] == kMessagesPerProducer);
+  }
+  assert(uart_dwords == (kMessagesPerProducer / 50) * kMaxUartTransportDwords);
+  assert(control_dwords == kMessagesPerProducer / 25);
+
+  const auto stats = queue.get_stats();
+  assert(stats.basic_sent == kProducers * kMessagesPerProducer);
+  assert(stats.basic_sent == stats.basic_enqueued);
+  assert(stats.uart_sent == stats.uart_enqueued);
+  assert(stats.control_sent == stats.control_enqueued);
+
+  std::cout << "test_concurrent_producers: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_matches_single_threaded_queue();
+  test_full_ring();
+  test_invalid_message_rejected();
+  test_concurrent_producers();
+
+  std::cout << "\nAll DL concurrent message queue tests passed!\n";
+  return 0;
+}
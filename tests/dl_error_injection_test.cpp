@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <limits>
 
 #include "ualink/crc.h"
 #include "ualink/dl_flit.h"
@@ -293,6 +294,75 @@ static void test_sequence_modification_skip() {
   std::cout << "test_sequence_modification_skip: PASS\n";
 }
 
+static void test_geometric_error_policy_reproducible() {
+  UALINK_TRACE_SCOPED(__func__);
+  GeometricErrorPolicy policy_a(0.01, 1234);
+  GeometricErrorPolicy policy_b(0.01, 1234);
+  GeometricErrorPolicy policy_c(0.01, 5678);
+
+  bool sequences_differ = false;
+  for (std::size_t flit_index = 0; flit_index < 10000; ++flit_index) {
+    const ErrorType error_a = policy_a();
+    assert(error_a == policy_b());
+    if (error_a != policy_c()) {
+      sequences_differ = true;
+    }
+  }
+  assert(sequences_differ);
+
+  // Reseeding replays the same sequence
+  policy_a.reseed(42);
+  policy_b.reseed(42);
+  for (std::size_t flit_index = 0; flit_index < 1000; ++flit_index) {
+    assert(policy_a() == policy_b());
+  }
+
+  std::cout << "test_geometric_error_policy_reproducible: PASS\n";
+}
+
+static void test_geometric_error_policy_rate() {
+  UALINK_TRACE_SCOPED(__func__);
+  GeometricErrorPolicy policy(0.0, 7);
+  policy.set_crc_corruption_probability(0.01);
+  policy.set_packet_drop_probability(0.005);
+
+  constexpr std::size_t kFlits = 1'000'000;
+  std::size_t crc_errors = 0;
+  std::size_t drops = 0;
+  for (std::size_t flit_index = 0; flit_index < kFlits; ++flit_index) {
+    const ErrorType error = policy();
+    assert(error == ErrorType::kNone || error == ErrorType::kCrcCorruption || error == ErrorType::kPacketDrop);
+    if (error == ErrorType::kCrcCorruption) {
+      crc_errors++;
+    } else if (error == ErrorType::kPacketDrop) {
+      drops++;
+    }
+  }
+
+  // Expect ~10000 CRC errors and ~5000 drops; allow +/-5%
+  assert(crc_errors > 9500 && crc_errors < 10500);
+  assert(drops > 4750 && drops < 5250);
+
+  std::cout << "test_geometric_error_policy_rate: PASS\n";
+}
+
+static void test_geometric_error_policy_limits() {
+  UALINK_TRACE_SCOPED(__func__);
+  GeometricErrorPolicy never(0.0, 1);
+  assert(never.flits_until_error() == std::numeric_limits<std::uint64_t>::max());
+  for (std::size_t flit_index = 0; flit_index < 1000; ++flit_index) {
+    assert(never() == ErrorType::kNone);
+  }
+
+  GeometricErrorPolicy always(0.0, 1);
+  always.set_packet_drop_probability(1.0);
+  for (std::size_t flit_index = 0; flit_index < 1000; ++flit_index) {
+    assert(always() == ErrorType::kPacketDrop);
+  }
+
+  std::cout << "test_geometric_error_policy_limits: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -303,6 +373,9 @@ int main() {
 
   test_periodic_error_policy();
   test_periodic_error_policy_reset();
+  test_geometric_error_policy_reproducible();
+  test_geometric_error_policy_rate();
+  test_geometric_error_policy_limits();
   test_burst_error_policy();
   test_burst_error_policy_reset();
 
@@ -4,7 +4,10 @@
 #include "ualink/trace.h"
 
 #include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <stdexcept>
+#include <vector>
 
 using namespace ualink::dl;
 
@@ -325,6 +328,96 @@ static void test_uart_stream_transport_multi_flit() {
   std::cout << "test_uart_stream_transport_multi_flit: PASS\n";
 }
 
+static void test_alt_sector_uart_transport_single_flit() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageQueue queue;
+
+  // Full-size UART Stream Transport: header + 32 payload DWords
+  UartStreamTransportMessage uart{};
+  uart.stream_id = 0;
+  uart.common = make_common(DlUartMessageType::kStreamTransportMessage);
+  for (std::uint32_t i = 0; i < 32; ++i) {
+    uart.payload_dwords.push_back(0xC0DE0000U | i);
+  }
+  queue.enqueue(uart);
+
+  std::vector<TlFlit> tl_flits(3);
+  for (std::size_t i = 0; i < tl_flits.size(); ++i) {
+    tl_flits[i].data.fill(static_cast<std::byte>(0x10 + i));
+  }
+
+  ExplicitFlitHeaderFields header{};
+  header.op = 0x1;
+  header.payload = true;
+  header.flit_seq_no = 7;
+
+  // 8-DWord sectors: 5 x 8 = 40 slots, each segment still carries one TL flit
+  const DlAltSectorConfig alt_sector{.dwords = 8};
+  std::size_t flits_serialized = 0;
+  DlFlit dl_flit = DlSerializer::serialize(tl_flits, header, &queue, alt_sector, &flits_serialized);
+  assert(flits_serialized == 3);
+  assert(!queue.has_pending_messages());
+
+  auto result = DlDeserializer::deserialize_ex_with_crc_check(dl_flit, alt_sector);
+  assert(result.has_value());
+  assert(result->dl_message_dwords.size() == 40);
+  assert(result->tl_flits.size() == 3);
+  for (std::size_t i = 0; i < tl_flits.size(); ++i) {
+    assert(result->tl_flits[i].data == tl_flits[i].data);
+  }
+
+  // The whole transport message arrives in one flit
+  std::vector<std::byte> transport_bytes;
+  for (std::size_t i = 0; i < 33; ++i) {
+    transport_bytes.insert(transport_bytes.end(), result->dl_message_dwords[i].begin(),
+                           result->dl_message_dwords[i].end());
+  }
+  auto roundtrip = deserialize_uart_stream_transport_message(transport_bytes);
+  assert(roundtrip.has_value());
+  assert(roundtrip->payload_dwords == uart.payload_dwords);
+
+  // Unused sector DWords are No-Ops
+  for (std::size_t i = 33; i < result->dl_message_dwords.size(); ++i) {
+    assert(deserialize_no_op_message(result->dl_message_dwords[i]).has_value());
+  }
+
+  std::cout << "test_alt_sector_uart_transport_single_flit: PASS\n";
+}
+
+static void test_alt_sector_invalid_size() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageQueue queue;
+  NoOpMessage nop{};
+  nop.common = make_common(DlBasicMessageType::kNoOp);
+  queue.enqueue(nop);
+
+  ExplicitFlitHeaderFields header{};
+  header.op = 0x1;
+  header.payload = true;
+  header.flit_seq_no = 1;
+
+  bool threw = false;
+  try {
+    [[maybe_unused]] DlFlit dl_flit = DlSerializer::serialize({}, header, &queue, DlAltSectorConfig{.dwords = 0});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try {
+    [[maybe_unused]] auto result =
+        DlDeserializer::deserialize_ex(DlFlit{}, DlAltSectorConfig{.dwords = kMaxAltSectorDwords + 1});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "test_alt_sector_invalid_size: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -333,6 +426,8 @@ int main() {
   test_roundtrip_no_dl_messages();
   test_roundtrip_with_crc_check();
   test_roundtrip_with_corrupted_crc();
+  test_alt_sector_uart_transport_single_flit();
+  test_alt_sector_invalid_size();
   test_dl_message_priority_placement();
   test_uart_stream_transport_multi_flit();
 
@@ -1,8 +1,11 @@
 #include "ualink/dl_message_processor.h"
 #include "ualink/trace.h"
 
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 using namespace ualink::dl;
 
@@ -278,9 +281,9 @@ static void test_invalid_message_class() {
 
   DlMessageProcessor processor;
 
-  // Create DWord with reserved mclass (0b11)
+  // Create DWord with reserved mclass (0b0011, bits 5:2)
   std::array<std::byte, 4> invalid_dword{};
-  invalid_dword[0] = std::byte{0b11000000};  // mclass=0b11 (reserved)
+  invalid_dword[3] = std::byte{0b00001100};
 
   // Process should fail
   bool result = processor.process_dword(invalid_dword, 0);
@@ -390,6 +393,114 @@ static void test_multiple_message_types() {
   std::cout << "test_multiple_message_types: PASS\n";
 }
 
+static void test_unknown_and_malformed_status() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageProcessor processor;
+
+  // Reserved mtype within the Basic class (0b001)
+  std::array<std::byte, 4> unknown_type{};
+  unknown_type[3] = std::byte{0b01000000};
+  assert(processor.process_dword_ex(unknown_type, 0) == DlMessageStatus::kUnknownMessage);
+
+  // Known type with compressed=1
+  NoOpMessage nop{};
+  nop.common = make_common(DlBasicMessageType::kNoOp);
+  auto compressed = serialize_no_op_message(nop);
+  compressed[3] |= std::byte{0x01};
+  assert(processor.process_dword_ex(compressed, 0) == DlMessageStatus::kMalformed);
+
+  // A flood of bad DWords is counted, never thrown
+  std::vector<std::array<std::byte, 4>> flood(1000, unknown_type);
+  const DlMessageBatchResult result = processor.process_dwords(flood, 0);
+  assert(result.accepted == 0);
+  assert(result.rejected == 1000);
+
+  const auto stats = processor.get_stats();
+  assert(stats.deserialization_errors == 1002);
+  assert(stats.basic_received == 0);
+
+  std::cout << "test_unknown_and_malformed_status: PASS\n";
+}
+
+static void test_process_dwords_batch_with_uart_transport() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageProcessor processor;
+  std::vector<std::uint32_t> received_payload;
+  int credit_count = 0;
+  processor.set_uart_transport_callback(
+      [&](const UartStreamTransportMessage& msg) { received_payload = msg.payload_dwords; });
+  processor.set_uart_credit_callback([&](const UartStreamCreditUpdate&) { credit_count++; });
+
+  UartStreamTransportMessage transport{};
+  transport.stream_id = 0;
+  transport.common = make_common(DlUartMessageType::kStreamTransportMessage);
+  transport.payload_dwords = {0x00000000U, 0xDEADBEEFU, 0x00C0FFEEU};
+
+  UartStreamCreditUpdate credit{};
+  credit.stream_id = 0;
+  credit.data_fc_seq = 7;
+  credit.common = make_common(DlUartMessageType::kStreamCreditUpdate);
+
+  // Header + payload, then a credit update: the payload DWords (even an
+  // all-zero one) must not be dispatched as messages
+  std::vector<std::array<std::byte, 4>> dwords;
+  dwords.push_back(serialize_uart_stream_transport_header(transport));
+  for (const std::uint32_t payload : transport.payload_dwords) {
+    dwords.push_back(serialize_uart_stream_payload_dword(payload));
+  }
+  dwords.push_back(serialize_uart_stream_credit_update(credit));
+
+  const DlMessageBatchResult result = processor.process_dwords(dwords, 0);
+  assert(result.accepted == dwords.size());
+  assert(result.rejected == 0);
+  assert(received_payload == transport.payload_dwords);
+  assert(credit_count == 1);
+  assert(!processor.is_uart_reassembly_in_progress());
+
+  const auto stats = processor.get_stats();
+  assert(stats.uart_received == 2);
+  assert(stats.deserialization_errors == 0);
+
+  std::cout << "test_process_dwords_batch_with_uart_transport: PASS\n";
+}
+
+static void test_uart_transport_view_per_stream() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageProcessor processor;
+  std::size_t views = 0;
+  std::uint8_t last_stream = 0;
+  std::vector<std::uint32_t> last_payload;
+  processor.set_uart_transport_view_callback([&](const UartStreamTransportView& msg) {
+    views++;
+    last_stream = msg.stream_id;
+    last_payload.assign(msg.payload_dwords.begin(), msg.payload_dwords.end());
+  });
+
+  // Stream 3 header (the transmit serializer only emits stream 0)
+  const DlMsgCommon common = make_common(DlUartMessageType::kStreamTransportMessage);
+  std::array<std::byte, 4> header{};
+  bit_fields::NetworkBitWriter w(header);
+  w.serialize(kUartStreamTransportHeaderFormat, 1U, 0U, 3U, common.mtype, common.mclass, 0U, 0U);
+
+  assert(processor.process_dword(header, 0));
+  assert(processor.is_uart_reassembly_in_progress(3));
+  assert(!processor.is_uart_reassembly_in_progress(0));
+  assert(processor.process_dword(serialize_uart_stream_payload_dword(0x12345678U), 0));
+  assert(views == 0);
+  assert(processor.process_dword(serialize_uart_stream_payload_dword(0x9ABCDEF0U), 0));
+
+  assert(views == 1);
+  assert(last_stream == 3);
+  assert((last_payload == std::vector<std::uint32_t>{0x12345678U, 0x9ABCDEF0U}));
+  assert(!processor.is_uart_reassembly_in_progress());
+  assert(processor.get_uart_reassembly_pool().get_stats().messages_completed == 1);
+
+  std::cout << "test_uart_transport_view_per_stream: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -406,6 +517,9 @@ int main() {
   test_stats_reset();
   test_port_id_message();
   test_multiple_message_types();
+  test_unknown_and_malformed_status();
+  test_process_dwords_batch_with_uart_transport();
+  test_uart_transport_view_per_stream();
 
   std::cout << "\nAll DlMessageProcessor tests passed!\n";
   return 0;
@@ -3,6 +3,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 
 using namespace ualink::dl;
 
@@ -266,6 +267,77 @@ static void test_multiple_messages_same_group() {
   std::cout << "test_multiple_messages_same_group: PASS\n";
 }
 
+static void test_uart_transport_dword_order() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageQueue queue;
+
+  UartStreamTransportMessage msg{};
+  msg.stream_id = 0;
+  msg.common = make_common(DlUartMessageType::kStreamTransportMessage);
+  msg.payload_dwords = {0x01020304U, 0xA1B2C3D4U};
+  queue.enqueue(msg);
+
+  const auto expected = serialize_uart_stream_transport_message(msg);
+  for (std::size_t dword_index = 0; dword_index < expected.size() / 4; ++dword_index) {
+    const auto dword = queue.pop_next_dword();
+    assert(dword.has_value());
+    for (std::size_t byte_index = 0; byte_index < 4; ++byte_index) {
+      assert((*dword)[byte_index] == expected[(dword_index * 4) + byte_index]);
+    }
+  }
+  assert(!queue.has_pending_messages());
+
+  std::cout << "test_uart_transport_dword_order: PASS\n";
+}
+
+static void test_ring_full_rejects_whole_message() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlMessageQueue queue;
+
+  NoOpMessage nop{};
+  nop.common = make_common(DlBasicMessageType::kNoOp);
+  for (std::size_t message_index = 0; message_index < kDlMessageRingDwords; ++message_index) {
+    queue.enqueue(nop);
+  }
+
+  bool threw = false;
+  try {
+    queue.enqueue(nop);
+  } catch (const std::length_error &) {
+    threw = true;
+  }
+  assert(threw);
+  assert(queue.get_stats().basic_enqueued == kDlMessageRingDwords);
+
+  // A UART transport message that does not fit is rejected without partial DWords
+  UartStreamTransportMessage uart{};
+  uart.stream_id = 0;
+  uart.common = make_common(DlUartMessageType::kStreamTransportMessage);
+  uart.payload_dwords.assign(32, 0x55555555U);
+  for (std::size_t message_index = 0; message_index < kDlMessageRingDwords / kMaxUartTransportDwords; ++message_index) {
+    queue.enqueue(uart);
+  }
+  threw = false;
+  try {
+    queue.enqueue(uart);
+  } catch (const std::length_error &) {
+    threw = true;
+  }
+  assert(threw);
+
+  // Everything that was accepted still drains cleanly
+  std::size_t dwords_drained = 0;
+  while (queue.pop_next_dword().has_value()) {
+    dwords_drained++;
+  }
+  const std::size_t uart_messages = kDlMessageRingDwords / kMaxUartTransportDwords;
+  assert(dwords_drained == kDlMessageRingDwords + (uart_messages * kMaxUartTransportDwords));
+
+  std::cout << "test_ring_full_rejects_whole_message: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -274,6 +346,8 @@ int main() {
   test_round_robin_continues_after_wrap();
   test_empty_queue();
   test_uart_stream_transport_multi_dword();
+  test_uart_transport_dword_order();
+  test_ring_full_rejects_whole_message();
   test_uart_blocking_other_groups();
   test_serialization_roundtrip();
   test_multiple_messages_same_group();
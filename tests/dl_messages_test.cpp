@@ -1,6 +1,7 @@
 #include "ualink/dl_messages.h"
 #include "ualink/trace.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -135,6 +136,11 @@ int main() {
     assert(roundtrip->common.mtype == msg.common.mtype);
     assert(roundtrip->common.mclass == msg.common.mclass);
     assert(roundtrip->payload_dwords == msg.payload_dwords);
+
+    // Allocation-free pieces produce the same wire bytes.
+    assert(std::equal(dw0.begin(), dw0.end(), serialize_uart_stream_transport_header(msg).begin()));
+    const auto dw2 = serialize_uart_stream_payload_dword(msg.payload_dwords[1]);
+    assert(std::equal(dw2.begin(), dw2.end(), bytes.begin() + 8));
   }
 
   {
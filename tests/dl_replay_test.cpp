@@ -160,10 +160,11 @@ static void test_sequence_tracker_initial() {
   UALINK_TRACE_SCOPED(__func__);
   DlSequenceTracker tracker;
 
-  assert(tracker.expected_seq() == 0);
-  assert(tracker.is_expected(0));
-  assert(!tracker.is_expected(1));
-  assert(!tracker.is_duplicate(0));
+  // Sequence 0 is never sent; the first flit is 1
+  assert(tracker.expected_seq() == 1);
+  assert(tracker.is_expected(1));
+  assert(!tracker.is_expected(2));
+  assert(!tracker.is_duplicate(1));
 
   std::cout << "test_sequence_tracker_initial: PASS\n";
 }
@@ -173,10 +174,10 @@ static void test_sequence_tracker_advance() {
   DlSequenceTracker tracker;
 
   tracker.advance();
-  assert(tracker.expected_seq() == 1);
-  assert(tracker.is_expected(1));
-  assert(!tracker.is_expected(0));
-  assert(tracker.is_duplicate(0));
+  assert(tracker.expected_seq() == 2);
+  assert(tracker.is_expected(2));
+  assert(!tracker.is_expected(1));
+  assert(tracker.is_duplicate(1));
 
   std::cout << "test_sequence_tracker_advance: PASS\n";
 }
@@ -185,7 +186,7 @@ static void test_sequence_tracker_multiple_advances() {
   UALINK_TRACE_SCOPED(__func__);
   DlSequenceTracker tracker;
 
-  for (std::uint16_t seq = 0; seq < 100; ++seq) {
+  for (std::uint16_t seq = 1; seq < 100; ++seq) {
     assert(tracker.expected_seq() == seq);
     assert(tracker.is_expected(seq));
     tracker.advance();
@@ -200,14 +201,16 @@ static void test_sequence_tracker_wraparound() {
   UALINK_TRACE_SCOPED(__func__);
   DlSequenceTracker tracker;
 
-  // Advance to near the end of sequence space
-  for (std::uint16_t seq = 0; seq < 511; ++seq) {
+  // Advance to the end of sequence space
+  for (std::uint16_t seq = 1; seq < 511; ++seq) {
     tracker.advance();
   }
 
   assert(tracker.expected_seq() == 511);
   tracker.advance();
-  assert(tracker.expected_seq() == 0);  // Wrapped around
+  assert(tracker.expected_seq() == 1);  // Wrapped around, skipping 0
+  assert(tracker.is_duplicate(511));
+  assert(tracker.is_duplicate(510));
 
   std::cout << "test_sequence_tracker_wraparound: PASS\n";
 }
@@ -221,8 +224,8 @@ static void test_sequence_tracker_reset() {
   }
 
   tracker.reset();
-  assert(tracker.expected_seq() == 0);
-  assert(tracker.is_expected(0));
+  assert(tracker.expected_seq() == 1);
+  assert(tracker.is_expected(1));
 
   std::cout << "test_sequence_tracker_reset: PASS\n";
 }
@@ -232,7 +235,7 @@ static void test_sequence_tracker_duplicate_detection() {
   DlSequenceTracker tracker;
 
   // Advance to seq 10
-  for (std::uint16_t seq = 0; seq < 10; ++seq) {
+  for (std::uint16_t seq = 1; seq < 10; ++seq) {
     tracker.advance();
   }
 
@@ -242,7 +245,7 @@ static void test_sequence_tracker_duplicate_detection() {
   // Previous sequences are duplicates
   assert(tracker.is_duplicate(9));
   assert(tracker.is_duplicate(8));
-  assert(tracker.is_duplicate(0));
+  assert(tracker.is_duplicate(1));
 
   // Current expected is not duplicate
   assert(!tracker.is_duplicate(10));
@@ -0,0 +1,223 @@
+#include "ualink/dl_stream_packer.h"
+#include "ualink/dl_message_queue.h"
+#include "ualink/trace.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ualink::dl;
+
+static std::vector<TlFlit> make_tl_flits(std::size_t count) {
+  std::vector<TlFlit> tl_flits(count);
+  for (std::size_t flit_index = 0; flit_index < count; ++flit_index) {
+    for (std::size_t byte_index = 0; byte_index < kTlFlitBytes; ++byte_index) {
+      tl_flits[flit_index].data[byte_index] = static_cast<std::byte>((flit_index * 7) + byte_index);
+    }
+    tl_flits[flit_index].message_field = static_cast<std::uint8_t>(flit_index % 4);
+  }
+  return tl_flits;
+}
+
+static void assert_same_flit(const TlFlit &actual, const TlFlit &expected) {
+  assert(actual.data == expected.data);
+  assert(actual.message_field == expected.message_field);
+}
+
+static ExplicitFlitHeaderFields make_header() {
+  ExplicitFlitHeaderFields header{};
+  header.flit_seq_no = 1;
+  return header;
+}
+
+// Pack `tl_flits` through a packer/depacker pair, `chunk` flits offered per DL flit
+static std::vector<TlFlit> stream_round_trip(const std::vector<TlFlit> &tl_flits, std::size_t chunk,
+                                             DlStreamPacker &packer, DlStreamDepacker &depacker,
+                                             DlMessageQueue *message_queue, std::size_t *dl_flits) {
+  std::vector<TlFlit> received;
+  std::size_t next = 0;
+  *dl_flits = 0;
+  while (next < tl_flits.size() || packer.has_partial_flit()) {
+    const std::size_t offered = std::min(chunk, tl_flits.size() - next);
+    std::size_t consumed = 0;
+    const DlFlit flit =
+        packer.pack(std::span<const TlFlit>(tl_flits).subspan(next, offered), make_header(), message_queue, &consumed);
+    next += consumed;
+    (*dl_flits)++;
+
+    const auto result = depacker.unpack_with_crc_check(flit);
+    assert(result.has_value());
+    received.insert(received.end(), result->tl_flits.begin(), result->tl_flits.end());
+  }
+  return received;
+}
+
+static void test_full_payload_utilization() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // 628 payload bytes per DL flit: 157 TL flits fill exactly 16 DL flits
+  const std::vector<TlFlit> tl_flits = make_tl_flits(157);
+  DlStreamPacker packer;
+  DlStreamDepacker depacker;
+  std::size_t dl_flits = 0;
+  const std::vector<TlFlit> received = stream_round_trip(tl_flits, tl_flits.size(), packer, depacker, nullptr, &dl_flits);
+
+  assert(dl_flits == 16);
+  assert(received.size() == tl_flits.size());
+  for (std::size_t flit_index = 0; flit_index < tl_flits.size(); ++flit_index) {
+    assert_same_flit(received[flit_index], tl_flits[flit_index]);
+  }
+
+  const auto stats = packer.get_stats();
+  assert(stats.tl_bytes == 157 * kTlFlitBytes);
+  assert(stats.padding_bytes == 0);
+  assert(!depacker.has_partial_flit());
+
+  std::cout << "test_full_payload_utilization: PASS\n";
+}
+
+static void test_straddle_across_dl_flits() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlStreamPacker packer;
+  DlStreamDepacker depacker;
+  const std::vector<TlFlit> tl_flits = make_tl_flits(10);
+
+  // First DL flit: 9 whole flits (576 bytes) plus 52 bytes of the tenth
+  std::size_t consumed = 0;
+  const DlFlit first = packer.pack(tl_flits, make_header(), nullptr, &consumed);
+  assert(consumed == 10);
+  assert(packer.has_partial_flit());
+
+  const auto first_result = depacker.unpack(first);
+  assert(first_result.tl_flits.size() == 9);
+  assert(depacker.has_partial_flit());
+
+  // Second DL flit carries the last 12 bytes with no new input
+  const DlFlit second = packer.pack({}, make_header(), nullptr, &consumed);
+  assert(consumed == 0);
+  assert(!packer.has_partial_flit());
+
+  const auto second_result = depacker.unpack(second);
+  assert(second_result.tl_flits.size() == 1);
+  assert_same_flit(second_result.tl_flits[0], tl_flits[9]);
+  assert(!depacker.has_partial_flit());
+
+  // The continuation needs no header bits
+  for (const std::byte segment_header : second.segment_headers) {
+    const SegmentHeaderFields fields = deserialize_segment_header(segment_header);
+    assert(!fields.tl_flit0_present && !fields.tl_flit1_present);
+  }
+
+  std::cout << "test_straddle_across_dl_flits: PASS\n";
+}
+
+static void test_round_trip_with_messages() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  for (const std::size_t sector_dwords : {std::size_t{1}, std::size_t{5}, std::size_t{32}}) {
+    const DlAltSectorConfig alt_sector{.dwords = sector_dwords};
+    DlStreamPacker packer(alt_sector);
+    DlStreamDepacker depacker(alt_sector);
+    DlMessageQueue queue;
+    for (std::uint16_t rate = 0; rate < 40; ++rate) {
+      TlRateNotification msg{};
+      msg.rate = rate;
+      msg.common = make_common(DlBasicMessageType::kTlRateNotification);
+      queue.enqueue(msg);
+    }
+
+    const std::vector<TlFlit> tl_flits = make_tl_flits(200);
+    std::size_t dl_flits = 0;
+    const std::vector<TlFlit> received = stream_round_trip(tl_flits, 3, packer, depacker, &queue, &dl_flits);
+
+    assert(received.size() == tl_flits.size());
+    for (std::size_t flit_index = 0; flit_index < tl_flits.size(); ++flit_index) {
+      assert_same_flit(received[flit_index], tl_flits[flit_index]);
+    }
+    assert(!queue.has_pending_messages());
+  }
+
+  std::cout << "test_round_trip_with_messages: PASS\n";
+}
+
+static void test_crc_failure_keeps_carry() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlStreamPacker packer;
+  DlStreamDepacker depacker;
+  const std::vector<TlFlit> tl_flits = make_tl_flits(10);
+
+  const DlFlit first = packer.pack(tl_flits, make_header(), nullptr, nullptr);
+  assert(depacker.unpack(first).tl_flits.size() == 9);
+
+  const DlFlit second = packer.pack({}, make_header(), nullptr, nullptr);
+  DlFlit corrupted = second;
+  corrupted.payload[0] ^= std::byte{0x01};
+  assert(!depacker.unpack_with_crc_check(corrupted).has_value());
+  assert(depacker.has_partial_flit());
+
+  // Replayed copy completes the carried flit
+  const auto replayed = depacker.unpack_with_crc_check(second);
+  assert(replayed.has_value());
+  assert(replayed->tl_flits.size() == 1);
+  assert_same_flit(replayed->tl_flits[0], tl_flits[9]);
+
+  std::cout << "test_crc_failure_keeps_carry: PASS\n";
+}
+
+static void test_malformed_start_rejected() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // A 32-DWord sector fills segment 0, so no TL flit can start there
+  const DlAltSectorConfig alt_sector{.dwords = 32};
+  DlStreamPacker packer(alt_sector);
+  DlStreamDepacker depacker(alt_sector);
+  const std::vector<TlFlit> tl_flits = make_tl_flits(1);
+
+  DlFlit bad = packer.pack({}, make_header(), nullptr, nullptr);
+  SegmentHeaderFields fields{};
+  fields.dl_alt_sector = true;
+  fields.tl_flit0_present = true;
+  bad.segment_headers[0] = serialize_segment_header(fields);
+
+  bool threw = false;
+  try {
+    [[maybe_unused]] const auto result = depacker.unpack(bad);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+  assert(depacker.get_stats().dl_flits == 0);
+
+  // The depacker is unaffected and decodes the next valid flit
+  const auto good = depacker.unpack(packer.pack(tl_flits, make_header(), nullptr, nullptr));
+  assert(good.tl_flits.size() == 1);
+  assert_same_flit(good.tl_flits[0], tl_flits[0]);
+
+  bool config_threw = false;
+  try {
+    DlStreamPacker invalid(DlAltSectorConfig{.dwords = 0});
+  } catch (const std::invalid_argument &) {
+    config_threw = true;
+  }
+  assert(config_threw);
+
+  std::cout << "test_malformed_start_rejected: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_full_payload_utilization();
+  test_straddle_across_dl_flits();
+  test_round_trip_with_messages();
+  test_crc_failure_keeps_carry();
+  test_malformed_start_rejected();
+
+  std::cout << "\nAll DL stream packer tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,202 @@
+#include "ualink/dl_timer_wheel.h"
+#include "ualink/prng.h"
+#include "ualink/trace.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ualink::dl;
+
+static void test_fires_at_deadline() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTimerWheel wheel({.capacity = 16});
+  std::vector<DlTimerExpiry> fired;
+  const auto collect = [&](std::span<const DlTimerExpiry> expired) {
+    fired.insert(fired.end(), expired.begin(), expired.end());
+  };
+
+  [[maybe_unused]] const DlTimerHandle handle = wheel.schedule(DlTimerKind::kBasicRequest, 7, 42, 5);
+  assert(wheel.size() == 1);
+
+  assert(wheel.advance(4, collect) == 0);
+  assert(fired.empty());
+  assert(wheel.advance(5, collect) == 1);
+  assert(fired.size() == 1);
+  assert(fired[0].kind == DlTimerKind::kBasicRequest);
+  assert(fired[0].link_id == 7);
+  assert(fired[0].tag == 42);
+  assert(fired[0].deadline_us == 5);
+  assert(wheel.empty());
+
+  // A deadline already passed fires on the next advance
+  [[maybe_unused]] const DlTimerHandle overdue = wheel.schedule(DlTimerKind::kChannelNegotiation, 1, 0, 2);
+  assert(wheel.advance(6, collect) == 1);
+  assert(fired.back().kind == DlTimerKind::kChannelNegotiation);
+
+  std::cout << "test_fires_at_deadline: PASS\n";
+}
+
+static void test_cancel() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTimerWheel wheel({.capacity = 4});
+  const DlTimerHandle first = wheel.schedule(DlTimerKind::kBasicRequest, 0, 1, 10);
+  const DlTimerHandle second = wheel.schedule(DlTimerKind::kBasicRequest, 0, 2, 10);
+
+  assert(wheel.cancel(first));
+  assert(!wheel.cancel(first)); // already cancelled
+  assert(wheel.size() == 1);
+
+  std::size_t fired = 0;
+  assert(wheel.advance(10, [&](std::span<const DlTimerExpiry> expired) { fired += expired.size(); }) == 1);
+  assert(fired == 1);
+  assert(!wheel.cancel(second)); // already fired
+
+  // A recycled node does not honour a stale handle
+  const DlTimerHandle reused = wheel.schedule(DlTimerKind::kBasicRequest, 0, 3, 20);
+  assert(!wheel.cancel(first));
+  assert(wheel.cancel(reused));
+  assert(!wheel.cancel(DlTimerHandle{}));
+
+  const auto stats = wheel.get_stats();
+  assert(stats.scheduled == 3);
+  assert(stats.cancelled == 2);
+  assert(stats.expired == 1);
+
+  std::cout << "test_cancel: PASS\n";
+}
+
+static void test_expiry_batched_per_tick() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  constexpr std::uint32_t kLinks = 1000;
+  DlTimerWheel wheel({.capacity = 2 * kLinks});
+  for (std::uint32_t link = 0; link < kLinks; ++link) {
+    [[maybe_unused]] const auto basic = wheel.schedule(DlTimerKind::kBasicRequest, link, 0, 100);
+    [[maybe_unused]] const auto negotiation = wheel.schedule(DlTimerKind::kChannelNegotiation, link, 0, 200);
+  }
+
+  std::vector<std::size_t> batch_sizes;
+  assert(wheel.advance(1000, [&](std::span<const DlTimerExpiry> expired) { batch_sizes.push_back(expired.size()); }) ==
+         2 * kLinks);
+  assert((batch_sizes == std::vector<std::size_t>{kLinks, kLinks}));
+  assert(wheel.get_stats().expiry_batches == 2);
+
+  std::cout << "test_expiry_batched_per_tick: PASS\n";
+}
+
+static void test_random_deadlines_across_levels() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Deadlines spread over every level, including beyond the 2^24-tick span
+  constexpr std::size_t kTimers = 5000;
+  constexpr std::uint64_t kHorizonUs = std::uint64_t{1} << 26;
+  DlTimerWheel wheel({.capacity = kTimers, .tick_us = 4, .start_us = 1000});
+  ualink::Xoshiro256StarStar rng(2024);
+
+  std::vector<DlTimerHandle> handles;
+  for (std::size_t timer = 0; timer < kTimers; ++timer) {
+    const std::uint64_t deadline = 1000 + (rng() % kHorizonUs);
+    handles.push_back(wheel.schedule(DlTimerKind::kBasicRequest, static_cast<std::uint32_t>(timer), 0, deadline));
+  }
+  std::size_t cancelled = 0;
+  for (std::size_t timer = 0; timer < kTimers; timer += 10) {
+    assert(wheel.cancel(handles[timer]));
+    cancelled++;
+  }
+
+  // Every timer fires in the advance() call covering its deadline, in order
+  std::uint64_t previous_now = 0;
+  std::uint64_t now = 1000;
+  std::size_t fired = 0;
+  while (!wheel.empty()) {
+    now += 1 + (rng() % 50'000);
+    wheel.advance(now, [&](std::span<const DlTimerExpiry> expired) {
+      for (const DlTimerExpiry &expiry : expired) {
+        assert(expiry.deadline_us <= now);
+        assert(expiry.deadline_us + 4 > previous_now);
+        assert(expiry.link_id % 10 != 0);
+        fired++;
+      }
+    });
+    previous_now = now;
+  }
+  assert(fired == kTimers - cancelled);
+  assert(wheel.get_stats().cascaded > 0);
+
+  std::cout << "test_random_deadlines_across_levels: PASS\n";
+}
+
+static void test_reschedule_from_callback() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // Periodic negotiation retry: each expiry re-arms the timer 3 us later
+  DlTimerWheel wheel({.capacity = 1});
+  [[maybe_unused]] const auto first = wheel.schedule(DlTimerKind::kChannelNegotiation, 0, 5, 3);
+
+  std::size_t retries = 0;
+  for (std::uint64_t now = 0; now <= 30; ++now) {
+    wheel.advance(now, [&](std::span<const DlTimerExpiry> expired) {
+      for (const DlTimerExpiry &expiry : expired) {
+        assert(expiry.deadline_us == now);
+        retries++;
+        [[maybe_unused]] const auto next = wheel.schedule(expiry.kind, expiry.link_id, expiry.tag, now + 3);
+      }
+    });
+  }
+  assert(retries == 10);
+
+  std::cout << "test_reschedule_from_callback: PASS\n";
+}
+
+static void test_capacity_and_config() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTimerWheel wheel({.capacity = 2});
+  [[maybe_unused]] const auto first = wheel.schedule(DlTimerKind::kBasicRequest, 0, 0, 1);
+  [[maybe_unused]] const auto second = wheel.schedule(DlTimerKind::kBasicRequest, 0, 1, 1);
+
+  bool threw = false;
+  try {
+    [[maybe_unused]] const auto third = wheel.schedule(DlTimerKind::kBasicRequest, 0, 2, 1);
+  } catch (const std::length_error &) {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try {
+    DlTimerWheel invalid({.capacity = 0});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try {
+    DlTimerWheel invalid({.tick_us = 0});
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "test_capacity_and_config: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_fires_at_deadline();
+  test_cancel();
+  test_expiry_batched_per_tick();
+  test_random_deadlines_across_levels();
+  test_reschedule_from_callback();
+  test_capacity_and_config();
+
+  std::cout << "\nAll DL timer wheel tests passed!\n";
+  return 0;
+}
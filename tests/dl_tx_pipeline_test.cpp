@@ -0,0 +1,292 @@
+#include "ualink/dl_tx_pipeline.h"
+#include "ualink/trace.h"
+
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+using namespace ualink::dl;
+
+static std::vector<TlFlit> make_tl_flits(std::size_t count) {
+  std::vector<TlFlit> tl_flits(count);
+  for (std::size_t flit_index = 0; flit_index < count; ++flit_index) {
+    tl_flits[flit_index].data.fill(static_cast<std::byte>(flit_index + 1));
+  }
+  return tl_flits;
+}
+
+struct WireCapture {
+  std::vector<DlFlit> flits;
+  void operator()(const DlFlit &flit) { flits.push_back(flit); }
+};
+
+static std::uint16_t seq_of(const DlFlit &flit) {
+  return deserialize_explicit_flit_header(flit.flit_header).flit_seq_no;
+}
+
+static void test_plain_pipeline() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, NoTxErrors{}, NoTxMessages{}};
+
+  const auto tl_flits = make_tl_flits(3);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.dl_flits_transmitted == 1);
+  assert(result.tl_flits_packed == 3);
+  assert(wire.flits.size() == 1);
+  assert(seq_of(wire.flits[0]) == 1);
+  assert(tx_controller.get_state().last_seq == 1);
+  assert(replay_buffer.size() == 1);
+  assert(DlDeserializer::deserialize_with_crc_check(wire.flits[0]).has_value());
+
+  std::cout << "test_plain_pipeline: PASS\n";
+}
+
+static void test_coalescing_across_dl_flits() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, NoTxErrors{}, NoTxMessages{}};
+
+  // 20 TL flits → 7 + 7 + 6
+  const auto tl_flits = make_tl_flits(20);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.dl_flits_transmitted == 3);
+  assert(result.tl_flits_packed == 20);
+  assert(seq_of(wire.flits[0]) == 1);
+  assert(seq_of(wire.flits[1]) == 2);
+  assert(seq_of(wire.flits[2]) == 3);
+  assert(DlDeserializer::deserialize(wire.flits[0]).size() == kMaxTlFlitsPerDlFlit);
+  assert(DlDeserializer::deserialize(wire.flits[2]).size() == 6);
+  assert(replay_buffer.size() == 3);
+
+  std::cout << "test_coalescing_across_dl_flits: PASS\n";
+}
+
+static void test_pacing_drop_consumes_no_sequence() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlPacingController pacing;
+  pacing.set_tx_callback([](std::size_t, std::size_t) { return PacingDecision::kThrottle; });
+
+  DlTxPipeline pipeline{tx_controller, replay_buffer, ControllerTxPacing{pacing}, NoTxErrors{}, NoTxMessages{}};
+
+  const auto tl_flits = make_tl_flits(12);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.dropped_by_pacing == 1);
+  assert(result.dl_flits_transmitted == 0);
+  assert(wire.flits.empty());
+  assert(tx_controller.get_state().last_seq == 0);
+  assert(replay_buffer.is_empty());
+
+  std::cout << "test_pacing_drop_consumes_no_sequence: PASS\n";
+}
+
+static void test_error_drop_after_replay_store() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlErrorInjector injector;
+  injector.enable();
+  PeriodicErrorPolicy policy(2, ErrorType::kPacketDrop);
+  injector.set_policy(std::ref(policy));
+
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, InjectorTxErrors{injector}, NoTxMessages{}};
+
+  // Three DL flits; the policy drops every second one
+  const auto tl_flits = make_tl_flits(3 * kMaxTlFlitsPerDlFlit);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.dropped_by_error_injection == 1);
+  assert(result.dl_flits_transmitted == 2);
+  assert(seq_of(wire.flits[0]) == 1);
+  assert(seq_of(wire.flits[1]) == 3); // seq 2 was lost on the "wire"
+  assert(replay_buffer.size() == 3);  // ... but is still available for replay
+
+  std::cout << "test_error_drop_after_replay_store: PASS\n";
+}
+
+static void test_crc_corruption_keeps_clean_replay_copy() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlErrorInjector injector;
+  injector.enable();
+  injector.set_policy([]() { return ErrorType::kCrcCorruption; });
+
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, InjectorTxErrors{injector}, NoTxMessages{}};
+
+  const auto tl_flits = make_tl_flits(2);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.errors_injected == 1);
+  assert(wire.flits.size() == 1);
+  assert(!DlDeserializer::deserialize_with_crc_check(wire.flits[0]).has_value());
+
+  const auto replayed = replay_buffer.process_nak(1);
+  for (const auto &flit : replayed) {
+    assert(DlDeserializer::deserialize_with_crc_check(flit).has_value());
+  }
+
+  std::cout << "test_crc_corruption_keeps_clean_replay_copy: PASS\n";
+}
+
+static void test_messages_piggyback() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  DlMessageQueue message_queue;
+
+  TlRateNotification msg{};
+  msg.rate = 0x55;
+  msg.common = make_common(DlBasicMessageType::kTlRateNotification);
+  message_queue.enqueue(msg);
+
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, NoTxErrors{}, QueueTxMessages{message_queue}};
+
+  const auto tl_flits = make_tl_flits(4);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.tl_flits_packed == 4);
+  assert(!message_queue.has_pending_messages());
+
+  const auto received = DlDeserializer::deserialize_ex(wire.flits[0]);
+  assert(received.dl_message_dwords.size() == 1);
+  assert(received.tl_flits.size() == 4);
+
+  std::cout << "test_messages_piggyback: PASS\n";
+}
+
+static void test_replay_full_stalls() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  for (std::uint16_t seq = 0; seq < kReplayBufferSize; ++seq) {
+    [[maybe_unused]] const bool added = replay_buffer.add_flit(seq, DlFlit{});
+  }
+  assert(replay_buffer.is_full());
+
+  DlTxPipeline pipeline{tx_controller, replay_buffer, NoTxPacing{}, NoTxErrors{}, NoTxMessages{}};
+
+  const auto tl_flits = make_tl_flits(1);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.stalled_on_replay_full);
+  assert(result.dl_flits_transmitted == 0);
+  assert(tx_controller.get_state().last_seq == 0);
+
+  std::cout << "test_replay_full_stalls: PASS\n";
+}
+
+static void test_stage_selection() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  DlPacingController pacing;
+  DlErrorInjector injector;
+  DlMessageQueue message_queue;
+
+  const bool no_pacing = select_tx_pacing_stage(
+      pacing, [](auto stage) { return std::is_same_v<decltype(stage), NoTxPacing>; });
+  const bool no_errors = select_tx_error_stage(
+      injector, [](auto stage) { return std::is_same_v<decltype(stage), NoTxErrors>; });
+  const bool no_messages = select_tx_message_stage(
+      message_queue, [](auto stage) { return std::is_same_v<decltype(stage), NoTxMessages>; });
+  assert(no_pacing);
+  assert(no_errors);
+  assert(no_messages);
+
+  pacing.set_tx_callback([](std::size_t, std::size_t) { return PacingDecision::kAllow; });
+  injector.enable();
+  message_queue.enqueue(NoOpMessage{});
+
+  const bool controller_pacing = select_tx_pacing_stage(
+      pacing, [](auto stage) { return std::is_same_v<decltype(stage), ControllerTxPacing>; });
+  const bool injector_errors = select_tx_error_stage(
+      injector, [](auto stage) { return std::is_same_v<decltype(stage), InjectorTxErrors>; });
+  const bool queue_messages = select_tx_message_stage(
+      message_queue, [](auto stage) { return std::is_same_v<decltype(stage), QueueTxMessages>; });
+  assert(controller_pacing);
+  assert(injector_errors);
+  assert(queue_messages);
+
+  std::cout << "test_stage_selection: PASS\n";
+}
+
+static void test_policy_stages() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  static_assert(!PolicyTxPacing<NoTxPacingPolicy>::kEnabled);
+  static_assert(!PolicyTxErrors<NoErrorPolicy>::kEnabled);
+  static_assert(PolicyTxPacing<SimpleTxRateLimiter>::kEnabled);
+  static_assert(PolicyTxErrors<PeriodicErrorPolicy>::kEnabled);
+
+  DlTxController tx_controller;
+  DlReplayBuffer replay_buffer;
+  SimpleTxRateLimiter limiter(2 * kMaxTlFlitsPerDlFlit);
+  PeriodicErrorPolicy errors(2, ErrorType::kCrcCorruption);
+
+  DlPolicyTxPipeline<SimpleTxRateLimiter, PeriodicErrorPolicy> pipeline{
+      tx_controller, replay_buffer, PolicyTxPacing{limiter}, PolicyTxErrors{errors}, NoTxMessages{}};
+
+  // Limiter admits two full DL flits, then throttles the third
+  const auto tl_flits = make_tl_flits(3 * kMaxTlFlitsPerDlFlit);
+  WireCapture wire;
+  const auto result = pipeline.transmit(tl_flits, wire);
+
+  assert(result.dl_flits_transmitted == 2);
+  assert(result.dropped_by_pacing == 1);
+  assert(result.errors_injected == 1);
+  assert(limiter.window_count() == 2 * kMaxTlFlitsPerDlFlit);
+  assert(DlDeserializer::deserialize_with_crc_check(wire.flits[0]).has_value());
+  assert(!DlDeserializer::deserialize_with_crc_check(wire.flits[1]).has_value());
+
+  // No-op policies behave exactly like the plain pipeline
+  NoTxPacingPolicy no_pacing;
+  NoErrorPolicy no_errors;
+  DlPolicyTxPipeline<NoTxPacingPolicy, NoErrorPolicy> no_op_pipeline{
+      tx_controller, replay_buffer, PolicyTxPacing{no_pacing}, PolicyTxErrors{no_errors}, NoTxMessages{}};
+  WireCapture no_op_wire;
+  const auto no_op_result = no_op_pipeline.transmit(tl_flits, no_op_wire);
+  assert(no_op_result.dl_flits_transmitted == 3);
+  assert(no_op_result.dropped_by_pacing == 0);
+
+  std::cout << "test_policy_stages: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_plain_pipeline();
+  test_coalescing_across_dl_flits();
+  test_pacing_drop_consumes_no_sequence();
+  test_error_drop_after_replay_store();
+  test_crc_corruption_keeps_clean_replay_copy();
+  test_messages_piggyback();
+  test_replay_full_stalls();
+  test_stage_selection();
+  test_policy_stages();
+
+  std::cout << "\nAll DL TX pipeline tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,188 @@
+#include "ualink/dl_uart_reassembly.h"
+#include "ualink/trace.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+using namespace ualink::dl;
+
+// The transmit serializer only emits stream 0, so build other streams' headers directly
+static std::array<std::byte, 4> make_transport_header(std::uint8_t stream_id, std::size_t payload_dwords) {
+  const DlMsgCommon common = make_common(DlUartMessageType::kStreamTransportMessage);
+  std::array<std::byte, 4> header{};
+  bit_fields::NetworkBitWriter w(header);
+  w.serialize(kUartStreamTransportHeaderFormat, static_cast<std::uint32_t>(payload_dwords - 1U), 0U, stream_id,
+              common.mtype, common.mclass, 0U, 0U);
+  return header;
+}
+
+static std::uint32_t payload_value(std::uint8_t stream_id, std::size_t index) {
+  return (static_cast<std::uint32_t>(stream_id) << 24) | static_cast<std::uint32_t>(index);
+}
+
+static void test_single_stream() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UartStreamReassemblyPool pool;
+  assert(!pool.any_in_progress());
+
+  const auto stream_id = pool.begin(make_transport_header(0, 3));
+  assert(stream_id.has_value() && *stream_id == 0);
+  assert(pool.in_progress(0));
+  assert(pool.payload_dwords_remaining(0) == 3);
+
+  const UartStreamTransportView *msg = pool.append(0, 0xA);
+  assert(msg == nullptr);
+  msg = pool.append(0, 0xB);
+  assert(msg == nullptr);
+  msg = pool.append(0, 0xC);
+  assert(msg != nullptr);
+  assert(msg->stream_id == 0);
+  assert(msg->payload_dwords.size() == 3);
+  assert(msg->payload_dwords[0] == 0xA && msg->payload_dwords[2] == 0xC);
+  assert(!pool.any_in_progress());
+
+  std::cout << "test_single_stream: PASS\n";
+}
+
+static void test_all_streams_interleaved() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UartStreamReassemblyPool pool;
+  for (std::uint8_t stream_id = 0; stream_id < kUartStreamCount; ++stream_id) {
+    // Stream n carries n + 25 DWords, so the longest is the 32-DWord maximum
+    const auto started = pool.begin(make_transport_header(stream_id, stream_id + 25U));
+    assert(started == stream_id);
+  }
+
+  // Round-robin one DWord per stream; each stream completes independently
+  std::array<std::size_t, kUartStreamCount> sent{};
+  std::size_t completed = 0;
+  while (pool.any_in_progress()) {
+    for (std::uint8_t stream_id = 0; stream_id < kUartStreamCount; ++stream_id) {
+      if (!pool.in_progress(stream_id)) {
+        continue;
+      }
+      const UartStreamTransportView *msg = pool.append(stream_id, payload_value(stream_id, sent[stream_id]));
+      sent[stream_id]++;
+      if (msg == nullptr) {
+        continue;
+      }
+      assert(msg->stream_id == stream_id);
+      assert(msg->payload_dwords.size() == stream_id + 25U);
+      for (std::size_t index = 0; index < msg->payload_dwords.size(); ++index) {
+        assert(msg->payload_dwords[index] == payload_value(stream_id, index));
+      }
+      completed++;
+    }
+  }
+  assert(completed == kUartStreamCount);
+
+  const auto stats = pool.get_stats();
+  assert(stats.messages_started == kUartStreamCount);
+  assert(stats.messages_completed == kUartStreamCount);
+  assert(stats.messages_abandoned == 0);
+
+  std::cout << "test_all_streams_interleaved: PASS\n";
+}
+
+static void test_view_reuses_stream_buffer() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UartStreamReassemblyPool pool;
+  const std::uint32_t *first_payload = nullptr;
+  for (std::size_t round = 0; round < 3; ++round) {
+    const auto started = pool.begin(make_transport_header(5, 2));
+    assert(started.has_value());
+    const UartStreamTransportView *msg = pool.append(5, 1);
+    assert(msg == nullptr);
+    msg = pool.append(5, 2);
+    assert(msg != nullptr);
+    if (first_payload == nullptr) {
+      first_payload = msg->payload_dwords.data();
+    }
+    // Delivered in place: every message on a stream lands in the same buffer
+    assert(msg->payload_dwords.data() == first_payload);
+  }
+
+  std::cout << "test_view_reuses_stream_buffer: PASS\n";
+}
+
+static void test_restart_and_reset() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UartStreamReassemblyPool pool;
+  auto started = pool.begin(make_transport_header(1, 4));
+  assert(started.has_value());
+  started = pool.begin(make_transport_header(2, 4));
+  assert(started.has_value());
+  const UartStreamTransportView *msg = pool.append(1, 0);
+  assert(msg == nullptr);
+
+  // A new header on stream 1 abandons its partial message only
+  started = pool.begin(make_transport_header(1, 1));
+  assert(started.has_value());
+  assert(pool.payload_dwords_remaining(1) == 1);
+  assert(pool.payload_dwords_remaining(2) == 4);
+
+  pool.reset(2);
+  assert(!pool.in_progress(2));
+  assert(pool.in_progress(1));
+  msg = pool.append(1, 7);
+  assert(msg != nullptr);
+
+  assert(pool.get_stats().messages_abandoned == 2);
+
+  std::cout << "test_restart_and_reset: PASS\n";
+}
+
+static void test_invalid_input() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UartStreamReassemblyPool pool;
+
+  // Not a transport header: credit update type, and a compressed header
+  std::array<std::byte, 4> credit = make_transport_header(0, 1);
+  credit[3] = std::byte{static_cast<unsigned char>(std::to_integer<unsigned>(credit[3]) | 0x40U)};
+  auto started = pool.begin(credit);
+  assert(!started.has_value());
+  std::array<std::byte, 4> compressed = make_transport_header(0, 1);
+  compressed[3] |= std::byte{0x01};
+  started = pool.begin(compressed);
+  assert(!started.has_value());
+  assert(pool.get_stats().messages_started == 0);
+
+  bool threw = false;
+  try {
+    [[maybe_unused]] const auto *msg = pool.append(3, 0);
+  } catch (const std::logic_error &) {
+    threw = true;
+  }
+  assert(threw);
+
+  threw = false;
+  try {
+    pool.reset(kUartStreamCount);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  std::cout << "test_invalid_input: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_single_stream();
+  test_all_streams_interleaved();
+  test_view_reuses_stream_buffer();
+  test_restart_and_reset();
+  test_invalid_input();
+
+  std::cout << "\nAll UART stream reassembly tests passed!\n";
+  return 0;
+}
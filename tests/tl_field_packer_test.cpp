@@ -0,0 +1,297 @@
+#include "ualink/tl_field_packer.h"
+#include "ualink/trace.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+using namespace ualink::tl;
+
+// 64-byte read at a 64B-aligned byte address; compressible once its region is cached
+static UncompressedRequestField make_read(std::uint64_t byte_address, std::uint16_t tag) {
+  UncompressedRequestField request{};
+  request.cmd = kTlReqCmdRead;
+  request.tag = tag;
+  request.attr = 0xFF;
+  request.len = 15;
+  request.addr = byte_address >> 2;
+  request.srcaccid = 0x012;
+  request.dstaccid = 0x034;
+  return request;
+}
+
+static void assert_same_request(const UncompressedRequestField &actual, const UncompressedRequestField &expected) {
+  assert(actual.cmd == expected.cmd);
+  assert(actual.vchan == expected.vchan);
+  assert(actual.asi == expected.asi);
+  assert(actual.tag == expected.tag);
+  assert(actual.pool == expected.pool);
+  assert(actual.attr == expected.attr);
+  assert(actual.len == expected.len);
+  assert(actual.metadata == expected.metadata);
+  assert(actual.addr == expected.addr);
+  assert(actual.srcaccid == expected.srcaccid);
+  assert(actual.dstaccid == expected.dstaccid);
+  assert(!actual.cload && actual.cway == 0);
+  assert(actual.numbeats == expected.numbeats);
+}
+
+static std::vector<TlControlField> pack_and_unpack(TlFieldPacker &packer, TlFieldUnpacker &unpacker,
+                                                   const std::vector<TlControlField> &fields) {
+  for (const TlControlField &field : fields) {
+    packer.push(field);
+  }
+  packer.flush();
+
+  std::vector<TlControlField> received;
+  for (const auto &flit : packer.take_flits()) {
+    const std::vector<TlControlField> decoded = unpacker.unpack(flit);
+    received.insert(received.end(), decoded.begin(), decoded.end());
+  }
+  return received;
+}
+
+static void test_request_compression_round_trip() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // 16 reads in one 1MB region, plus a 256B write: the first read loads the
+  // cache, everything after it compresses
+  std::vector<TlControlField> fields;
+  for (std::uint16_t tag = 0; tag < 16; ++tag) {
+    fields.emplace_back(make_read(0x12340000ULL + (tag * 0x1000ULL), tag));
+  }
+  UncompressedRequestField write = make_read(0x12380000ULL, 0x100);
+  write.cmd = kTlReqCmdWrite;
+  write.attr = 0x00;
+  write.len = 63;
+  write.numbeats = 3;
+  write.metadata = 0x5;
+  write.vchan = 2;
+  write.pool = true;
+  fields.emplace_back(write);
+
+  TlFieldPacker packer;
+  TlFieldUnpacker unpacker;
+  const std::vector<TlControlField> received = pack_and_unpack(packer, unpacker, fields);
+
+  assert(received.size() == fields.size());
+  for (std::size_t index = 0; index < fields.size(); ++index) {
+    assert_same_request(std::get<UncompressedRequestField>(received[index]),
+                        std::get<UncompressedRequestField>(fields[index]));
+  }
+
+  const TlFieldPacker::Stats stats = packer.get_stats();
+  assert(stats.requests_uncompressed == 1);
+  assert(stats.requests_compressed == 16);
+  assert(stats.field_bytes == 16 + (16 * 8));
+  assert(stats.uncompressed_bytes == 17 * 16);
+  assert(stats.flits == 3); // 144 bytes of fields, 64 per flit
+
+  std::cout << "test_request_compression_round_trip: PASS\n";
+}
+
+static void test_request_compression_rules() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlFieldPacker packer;
+  TlFieldUnpacker unpacker;
+
+  std::vector<TlControlField> fields;
+  fields.emplace_back(make_read(0x40000ULL, 1)); // loads the region
+  UncompressedRequestField atomic = make_read(0x40000ULL, 2);
+  atomic.cmd = 0x10;
+  fields.emplace_back(atomic);
+  fields.emplace_back(make_read(0x40004ULL, 3)); // not 64B-aligned
+  UncompressedRequestField crossing = make_read(0x400C0ULL, 4);
+  crossing.len = 31; // 128 bytes from 0xC0 crosses 256B
+  fields.emplace_back(crossing);
+  UncompressedRequestField partial = make_read(0x40000ULL, 5);
+  partial.attr = 0x0F;
+  fields.emplace_back(partial);
+  UncompressedRequestField odd_length = make_read(0x40000ULL, 6);
+  odd_length.len = 7;
+  fields.emplace_back(odd_length);
+
+  const std::vector<TlControlField> received = pack_and_unpack(packer, unpacker, fields);
+  assert(received.size() == fields.size());
+  for (std::size_t index = 0; index < fields.size(); ++index) {
+    assert_same_request(std::get<UncompressedRequestField>(received[index]),
+                        std::get<UncompressedRequestField>(fields[index]));
+  }
+  assert(packer.get_stats().requests_compressed == 0);
+  assert(packer.get_stats().requests_uncompressed == 6);
+
+  // Five regions on one stream: round-robin replacement evicts the first
+  for (std::uint64_t region = 1; region <= 4; ++region) {
+    packer.push(make_read(region << 20, 0));
+  }
+  packer.push(make_read(0x40000ULL, 7));
+  assert(packer.get_stats().requests_uncompressed == 11);
+
+  // A different stream has its own ways
+  UncompressedRequestField other_stream = make_read(0x40000ULL, 8);
+  other_stream.srcaccid = 0x3FF;
+  packer.push(other_stream);
+  packer.push(other_stream);
+  assert(packer.get_stats().requests_compressed == 1);
+
+  std::cout << "test_request_compression_rules: PASS\n";
+}
+
+static void test_response_compression() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UncompressedResponseField single_beat{};
+  single_beat.tag = 0x7FF;
+  single_beat.vchan = 1;
+  single_beat.dstaccid = 0x200;
+  single_beat.offset = 2;
+  single_beat.last = true;
+  single_beat.srcaccid = 0x155; // not carried compressed
+
+  UncompressedResponseField write_response{};
+  write_response.tag = 0x010;
+  write_response.rd_wr = true;
+  write_response.pool = true;
+
+  UncompressedResponseField multi_beat{};
+  multi_beat.tag = 0x020;
+  multi_beat.len = 3;
+
+  UncompressedResponseField error_response = write_response;
+  error_response.status = 0x4;
+  error_response.srcaccid = 0x155;
+
+  TlFieldPacker packer;
+  TlFieldUnpacker unpacker;
+  const std::vector<TlControlField> received =
+      pack_and_unpack(packer, unpacker, {single_beat, write_response, multi_beat, error_response});
+  assert(received.size() == 4);
+
+  const auto &single_out = std::get<UncompressedResponseField>(received[0]);
+  assert(single_out.tag == 0x7FF && single_out.vchan == 1 && single_out.dstaccid == 0x200);
+  assert(single_out.offset == 2 && single_out.last && !single_out.rd_wr);
+  assert(single_out.srcaccid == 0);
+
+  const auto &write_out = std::get<UncompressedResponseField>(received[1]);
+  assert(write_out.tag == 0x010 && write_out.rd_wr && write_out.pool);
+
+  const auto &multi_out = std::get<UncompressedResponseField>(received[2]);
+  assert(multi_out.tag == 0x020 && multi_out.len == 3 && !multi_out.rd_wr);
+
+  // Non-zero STATUS stays uncompressed, SRCACCID included
+  const auto &error_out = std::get<UncompressedResponseField>(received[3]);
+  assert(error_out.status == 0x4 && error_out.srcaccid == 0x155);
+
+  const TlFieldPacker::Stats stats = packer.get_stats();
+  assert(stats.responses_compressed == 3);
+  assert(stats.responses_uncompressed == 1);
+  assert(stats.flits == 1);
+
+  std::cout << "test_response_compression: PASS\n";
+}
+
+static void test_sector_alignment() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  FlowControlNopField credits{};
+  credits.req_cmd = 4;
+  credits.rsp_data = 8;
+
+  // FC at sector 0, the 4-sector request skips to sector 4, then eight
+  // compressed responses fill sectors 8..15
+  TlFieldPacker packer;
+  packer.push(credits);
+  packer.push(make_read(0x1000ULL, 1));
+  assert(packer.has_partial_flit());
+  UncompressedResponseField response{};
+  response.rd_wr = true;
+  for (std::uint16_t tag = 0; tag < 8; ++tag) {
+    response.tag = tag;
+    packer.push(response);
+  }
+  assert(!packer.has_partial_flit());
+
+  const auto flits = packer.take_flits();
+  assert(flits.size() == 1);
+  assert(packer.get_stats().padding_bytes == 12);
+
+  // The zero alignment sectors decode as NOPs and are dropped
+  TlFieldUnpacker unpacker;
+  const std::vector<TlControlField> fields = unpacker.unpack(flits[0]);
+  assert(fields.size() == 10);
+  assert(std::get<FlowControlNopField>(fields[0]).req_cmd == 4);
+  assert(std::get<FlowControlNopField>(fields[0]).rsp_data == 8);
+  assert(std::holds_alternative<UncompressedRequestField>(fields[1]));
+  assert(std::get<UncompressedResponseField>(fields[9]).tag == 7);
+
+  std::cout << "test_sector_alignment: PASS\n";
+}
+
+static void test_unpacker_rejects_malformed() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  // A compressed request the Rx cache was never loaded for
+  TlFieldPacker tx;
+  tx.push(make_read(0x2000ULL, 1));
+  tx.push(make_read(0x3000ULL, 2));
+  tx.flush();
+  const auto flits = tx.take_flits();
+
+  std::array<std::byte, kTlFlitBytes> compressed_only{};
+  std::copy_n(flits[0].begin() + 16, 8, compressed_only.begin());
+
+  TlFieldUnpacker unpacker;
+  bool threw = false;
+  try {
+    [[maybe_unused]] const auto fields = unpacker.unpack(compressed_only);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  // Reserved FTYPE 0xF
+  std::array<std::byte, kTlFlitBytes> reserved{};
+  reserved[0] = std::byte{0xF0};
+  threw = false;
+  try {
+    [[maybe_unused]] const auto fields = unpacker.unpack(reserved);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+
+  // An out-of-range field is rejected before the Tx cache changes
+  TlFieldPacker packer;
+  UncompressedRequestField bad = make_read(0x2000ULL, 1);
+  bad.vchan = 4;
+  threw = false;
+  try {
+    packer.push(bad);
+  } catch (const std::invalid_argument &) {
+    threw = true;
+  }
+  assert(threw);
+  packer.push(make_read(0x2000ULL, 2));
+  assert(packer.get_stats().requests_uncompressed == 1);
+
+  std::cout << "test_unpacker_rejects_malformed: PASS\n";
+}
+
+int main() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  test_request_compression_round_trip();
+  test_request_compression_rules();
+  test_response_compression();
+  test_sector_alignment();
+  test_unpacker_rejects_malformed();
+
+  std::cout << "\nAll TL field packer tests passed!\n";
+  return 0;
+}
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 
 #include "ualink/trace.h"
 
@@ -420,6 +421,118 @@ static void test_message_type_conversion() {
   std::cout << "test_message_type_conversion: PASS\n";
 }
 
+static void test_half_flit_round_trip() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlReadRequest request{};
+  request.header.size = 0x10;
+  request.header.tag = 0x5A5;
+  request.header.address = 0x2ABCDEF0123ULL;
+
+  const std::array<std::byte, kTlHalfFlitBytes> request_half = TlSerializer::serialize_read_request_half(request);
+  assert(is_half_flit(request_half[0]));
+  assert(TlDeserializer::deserialize_opcode(request_half) == TlOpcode::kReadRequest);
+
+  const std::optional<TlReadRequest> unpacked_request = TlDeserializer::deserialize_read_request_half(request_half);
+  assert(unpacked_request.has_value());
+  assert(unpacked_request->header.half_flit);
+  assert(unpacked_request->header.tag == request.header.tag);
+  assert(unpacked_request->header.address == request.header.address);
+  assert(!TlDeserializer::deserialize_write_completion_half(request_half).has_value());
+
+  TlWriteCompletion completion{};
+  completion.header.opcode = TlOpcode::kWriteCompletion;
+  completion.header.status = 0x3;
+  completion.header.tag = 0x123;
+
+  const std::array<std::byte, kTlHalfFlitBytes> completion_half =
+      TlSerializer::serialize_write_completion_half(completion);
+  const std::optional<TlWriteCompletion> unpacked_completion =
+      TlDeserializer::deserialize_write_completion_half(completion_half);
+  assert(unpacked_completion.has_value());
+  assert(unpacked_completion->header.status == 0x3);
+  assert(unpacked_completion->header.tag == 0x123);
+
+  // A full-flit encoding is not accepted as a half-flit
+  const std::array<std::byte, kTlFlitBytes> full = TlSerializer::serialize_read_request(request);
+  const std::span<const std::byte, kTlHalfFlitBytes> full_first_half =
+      std::span<const std::byte, kTlFlitBytes>(full).first<kTlHalfFlitBytes>();
+  assert(!TlDeserializer::deserialize_read_request_half(full_first_half).has_value());
+
+  std::cout << "test_half_flit_round_trip: PASS\n";
+}
+
+static void test_half_flit_packer_pairs_slots() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlHalfFlitPacker packer;
+  for (std::uint16_t tag = 0; tag < 5; ++tag) {
+    TlReadRequest request{};
+    request.header.tag = tag;
+    packer.push_half_flit(TlSerializer::serialize_read_request_half(request));
+  }
+  assert(packer.has_pending_half_flit());
+  packer.flush();
+  assert(!packer.has_pending_half_flit());
+
+  const std::vector<std::array<std::byte, kTlFlitBytes>> slots = packer.take_slots();
+  assert(slots.size() == 3);
+  assert(packer.take_slots().empty());
+  assert(packer.get_stats().paired_slots == 2);
+  assert(packer.get_stats().single_half_slots == 1);
+
+  std::uint16_t expected_tag = 0;
+  for (const auto& slot : slots) {
+    const TlSlotContents contents = unpack_tl_slot(slot);
+    assert(!contents.full_flit);
+    for (std::size_t half_index = 0; half_index < contents.half_flit_count; ++half_index) {
+      const auto request = TlDeserializer::deserialize_read_request_half(contents.half_flits[half_index]);
+      assert(request.has_value());
+      assert(request->header.tag == expected_tag);
+      expected_tag++;
+    }
+  }
+  assert(expected_tag == 5);
+  assert(unpack_tl_slot(slots[2]).half_flit_count == 1);
+
+  std::cout << "test_half_flit_packer_pairs_slots: PASS\n";
+}
+
+static void test_half_flit_packer_keeps_order() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  TlHalfFlitPacker packer;
+  TlReadRequest request{};
+  request.header.tag = 0x001;
+  TlWriteRequest write{};
+  write.header.opcode = TlOpcode::kWriteRequest;
+  write.header.tag = 0x002;
+
+  // The waiting half-flit goes out alone ahead of the full flit
+  packer.push_half_flit(TlSerializer::serialize_read_request_half(request));
+  packer.push_flit(TlSerializer::serialize_write_request(write));
+
+  const std::vector<std::array<std::byte, kTlFlitBytes>> slots = packer.take_slots();
+  assert(slots.size() == 2);
+  assert(unpack_tl_slot(slots[0]).half_flit_count == 1);
+  assert(unpack_tl_slot(slots[1]).full_flit);
+  assert(TlDeserializer::deserialize_write_request(slots[1])->header.tag == 0x002);
+  assert(packer.get_stats().full_slots == 1);
+
+  // A full-flit encoding cannot be pushed as a half-flit
+  const std::array<std::byte, kTlFlitBytes> full = TlSerializer::serialize_read_request(request);
+  bool threw = false;
+  try {
+    packer.push_half_flit(std::span<const std::byte, kTlFlitBytes>(full).first<kTlHalfFlitBytes>());
+  } catch (const std::invalid_argument&) {
+    threw = true;
+  }
+  assert(threw);
+  assert(!packer.has_pending_half_flit());
+
+  std::cout << "test_half_flit_packer_keeps_order: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -435,6 +548,9 @@ int main() {
   test_address_42_bits();
   test_tag_12_bits();
   test_message_type_conversion();
+  test_half_flit_round_trip();
+  test_half_flit_packer_pairs_slots();
+  test_half_flit_packer_keeps_order();
 
   std::cout << "\nAll TL flit tests passed!\n";
   return 0;
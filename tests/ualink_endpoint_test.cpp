@@ -65,7 +65,7 @@ static void test_basic_read_request() {
   endpoint.set_transmit_callback(std::ref(tx_capture));
 
   // Send read request
-  const std::uint16_t tag = endpoint.send_read_request(0x100000000ULL, 32);
+  const auto tag = endpoint.send_read_request(0x100000000ULL, 32);
 
   // Should have allocated tag 0
   assert(tag == 0);
@@ -96,7 +96,7 @@ static void test_basic_write_request() {
   }
 
   // Send write request
-  const std::uint16_t tag = endpoint.send_write_request(0x200000000ULL, 32, data);
+  const auto tag = endpoint.send_write_request(0x200000000ULL, 32, data);
 
   // Should have allocated tag 0
   assert(tag == 0);
@@ -121,9 +121,9 @@ static void test_multiple_requests() {
   endpoint.set_transmit_callback(std::ref(tx_capture));
 
   // Send multiple requests
-  const std::uint16_t tag1 = endpoint.send_read_request(0x1000, 16);
-  const std::uint16_t tag2 = endpoint.send_read_request(0x2000, 32);
-  const std::uint16_t tag3 = endpoint.send_read_request(0x3000, 63);  // Max 63 for 6-bit field
+  const auto tag1 = endpoint.send_read_request(0x1000, 16);
+  const auto tag2 = endpoint.send_read_request(0x2000, 32);
+  const auto tag3 = endpoint.send_read_request(0x3000, 63);  // Max 63 for 6-bit field
 
   // Tags should increment
   assert(tag1 == 0);
@@ -258,7 +258,7 @@ static void test_end_to_end_read_transaction() {
   requester.set_read_completion_callback(std::ref(read_completion_capture));
 
   // Requester sends read request
-  const std::uint16_t req_tag = requester.send_read_request(0xABCD0000ULL, 32);
+  const auto req_tag = requester.send_read_request(0xABCD0000ULL, 32);
   assert(req_tag == 0);
   assert(req_tx_capture.flits.size() == 1);
 
@@ -268,7 +268,7 @@ static void test_end_to_end_read_transaction() {
 
   tl::TlReadResponse response{};
   response.header.opcode = tl::TlOpcode::kReadResponse;
-  response.header.tag = req_tag;  // Match request tag
+  response.header.tag = *req_tag;  // Match request tag
   response.header.status = 0;
   response.header.data_valid = true;
 
@@ -287,7 +287,7 @@ static void test_end_to_end_read_transaction() {
   dl::ExplicitFlitHeaderFields header{};
   header.op = 0;
   header.payload = true;
-  header.flit_seq_no = 100;
+  header.flit_seq_no = 1;  // First flit from the responder, so in sequence
 
   std::array<dl::TlFlit, 1> tl_flits{tl_flit};
   const dl::DlFlit response_flit = dl::DlSerializer::serialize(tl_flits, header);
@@ -297,7 +297,7 @@ static void test_end_to_end_read_transaction() {
 
   // Verify completion callback was triggered
   assert(read_completion_capture.completions.size() == 1);
-  assert(read_completion_capture.completions[0].tag == req_tag);
+  assert(read_completion_capture.completions[0].tag == *req_tag);
   assert(read_completion_capture.completions[0].status == 0);
 
   // Verify data
@@ -511,7 +511,7 @@ static void test_tag_wrap_around() {
   // Allocate tags to verify proper allocation
   // Note: flit_seq_no is only 9 bits (0-511), so limit test size
   for (std::size_t request_index = 0; request_index < 16; ++request_index) {
-    const std::uint16_t tag = endpoint.send_read_request(0x1000 + request_index, 16);
+    const auto tag = endpoint.send_read_request(0x1000 + request_index, 16);
     assert(tag == request_index);
   }
 
@@ -521,6 +521,40 @@ static void test_tag_wrap_around() {
   std::cout << "test_tag_wrap_around: PASS\n";
 }
 
+static void test_replay_full_returns_no_tag() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UaLinkEndpoint endpoint;
+  TransmitCapture tx_capture;
+  endpoint.set_transmit_callback(std::ref(tx_capture));
+
+  // No ACKs come back, so the replay buffer fills
+  for (std::size_t request_index = 0; request_index < dl::kReplayBufferSize; ++request_index) {
+    const auto tag = endpoint.send_read_request(0x1000, 16);
+    assert(tag.has_value());
+  }
+
+  // The next request never reaches the wire and gets no tag
+  const auto stalled = endpoint.send_read_request(0x1000, 16);
+  const auto stalled_write = endpoint.send_write_request(0x2000, 16, std::vector<std::byte>(16));
+  assert(!stalled.has_value());
+  assert(!stalled_write.has_value());
+
+  const auto stats = endpoint.get_stats();
+  assert(stats.tx_read_requests == dl::kReplayBufferSize);
+  assert(stats.tx_write_requests == 0);
+  assert(stats.tx_dl_flits == dl::kReplayBufferSize);
+  assert(stats.tx_stalled_replay_full == 2);
+  assert(tx_capture.flits.size() == dl::kReplayBufferSize);
+
+  // ACKs free replay space; the retry takes the tag the stalled request did not use
+  endpoint.process_ack(endpoint.get_tx_seq());
+  const auto retried = endpoint.send_read_request(0x1000, 16);
+  assert(retried == dl::kReplayBufferSize);
+
+  std::cout << "test_replay_full_returns_no_tag: PASS\n";
+}
+
 static void test_stats_reset() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -549,6 +583,30 @@ static void test_stats_reset() {
   std::cout << "test_stats_reset: PASS\n";
 }
 
+static void test_dl_message_piggyback() {
+  UALINK_TRACE_SCOPED(__func__);
+
+  UaLinkEndpoint endpoint;
+  TransmitCapture tx_capture;
+  endpoint.set_transmit_callback(std::ref(tx_capture));
+
+  dl::TlRateNotification msg{};
+  msg.rate = 0x10;
+  msg.common = dl::make_common(dl::DlBasicMessageType::kTlRateNotification);
+  endpoint.enqueue_dl_message(msg);
+
+  [[maybe_unused]] auto tag = endpoint.send_read_request(0x1000, 16);
+
+  // DL message rides in the same DL flit as the read request
+  assert(tx_capture.flits.size() == 1);
+  const auto received = dl::DlDeserializer::deserialize_ex(tx_capture.flits[0]);
+  assert(received.dl_message_dwords.size() == 1);
+  assert(received.tl_flits.size() == 1);
+  assert(endpoint.get_tx_seq() == 1);
+
+  std::cout << "test_dl_message_piggyback: PASS\n";
+}
+
 int main() {
   UALINK_TRACE_SCOPED(__func__);
 
@@ -569,7 +627,9 @@ int main() {
   test_crc_check_disabled();
 
   test_tag_wrap_around();
+  test_replay_full_returns_no_tag();
   test_stats_reset();
+  test_dl_message_piggyback();
 
   std::cout << "\nAll UaLink endpoint tests passed!\n";
   return 0;
@@ -1,5 +1,6 @@
 #include "ualink/upli_channel.h"
 
+#include <array>
 #include <cassert>
 #include <cstring>
 #include <iostream>
@@ -379,6 +380,77 @@ void test_max_values() {
   std::cout << "PASS\n";
 }
 
+// Test fixed-size serializers: compile-time sizes, caller-span overloads
+void test_fixed_size_serializers() {
+  std::cout << "test_fixed_size_serializers: ";
+
+  static_assert(kUpliRequestBytes == 24);
+  static_assert(kUpliOrigDataBytes == 1 + kUpliDataBeatBytes);
+  static_assert(kUpliRdRspBytes == 12 + kUpliDataBeatBytes);
+  static_assert(kUpliWrRspBytes == 12);
+  static_assert(kUpliCreditReturnBytes == 5);
+
+  UpliRequestFields req{};
+  req.req_vld = true;
+  req.req_tag = 0x2AA;
+  req.req_addr = 0x1234567;
+  req.req_vc = 2;
+
+  // A dirty caller buffer is fully overwritten, pad bits included
+  std::array<std::byte, kUpliRequestBytes> req_out{};
+  req_out.fill(std::byte{0xFF});
+  serialize_upli_request(req, req_out);
+  assert(req_out == serialize_upli_request(req));
+  assert(deserialize_upli_request(req_out).req_tag == 0x2AA);
+
+  UpliRdRspFields rd{};
+  rd.rd_rsp_vld = true;
+  rd.rd_rsp_tag = 0x155;
+  rd.data[63] = std::byte{0x5A};
+  std::array<std::byte, kUpliRdRspBytes> rd_out{};
+  rd_out.fill(std::byte{0xFF});
+  serialize_upli_rd_rsp(rd, rd_out);
+  assert(rd_out == serialize_upli_rd_rsp(rd));
+  assert(deserialize_upli_rd_rsp(rd_out).data[63] == std::byte{0x5A});
+
+  UpliOrigDataFields orig{};
+  orig.orig_data_vld = true;
+  orig.data[0] = std::byte{0xA5};
+  std::array<std::byte, kUpliOrigDataBytes> orig_out{};
+  orig_out.fill(std::byte{0xFF});
+  serialize_upli_orig_data(orig, orig_out);
+  assert(orig_out == serialize_upli_orig_data(orig));
+
+  UpliWrRspFields wr{};
+  wr.wr_rsp_tag = 0x7FF;
+  std::array<std::byte, kUpliWrRspBytes> wr_out{};
+  wr_out.fill(std::byte{0xFF});
+  serialize_upli_wr_rsp(wr, wr_out);
+  assert(wr_out == serialize_upli_wr_rsp(wr));
+
+  UpliCreditReturn credits{};
+  credits.ports[1].credit_vld = true;
+  credits.ports[1].credit_num = 2;
+  credits.credit_init_done[3] = true;
+  std::array<std::byte, kUpliCreditReturnBytes> credit_out{};
+  credit_out.fill(std::byte{0xFF});
+  serialize_upli_credit_return(credits, credit_out);
+  assert(credit_out == serialize_upli_credit_return(credits));
+
+  // Out-of-range fields throw before the buffer is touched
+  req.req_vc = 4;
+  req_out.fill(std::byte{0xEE});
+  try {
+    serialize_upli_request(req, req_out);
+    assert(false && "Should have thrown");
+  } catch (const std::invalid_argument&) {
+    // Expected
+  }
+  assert(req_out[0] == std::byte{0xEE});
+
+  std::cout << "PASS\n";
+}
+
 int main() {
   std::cout << "\n=== UPLI Channel Tests ===\n\n";
 
@@ -393,6 +465,7 @@ int main() {
   test_request_validation();
   test_zero_fields();
   test_max_values();
+  test_fixed_size_serializers();
 
   std::cout << "\n=== All UPLI Channel Tests Passed ===\n";
   return 0;
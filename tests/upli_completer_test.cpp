@@ -0,0 +1,264 @@
+#include "ualink/upli_completer.h"
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ualink::upli;
+
+static UpliRequestFields make_request(std::uint8_t port_id, std::uint16_t tag,
+                                      ReqCmd cmd, std::uint8_t vc = 0) {
+  UpliRequestFields request{};
+  request.req_vld = true;
+  request.req_port_id = port_id;
+  request.req_src_phys_acc_id = 0x12;
+  request.req_tag = tag;
+  request.req_addr = 0x8000 + (static_cast<std::uint64_t>(tag) * 64);
+  request.req_cmd = static_cast<std::uint8_t>(cmd);
+  request.req_len = 15;
+  request.req_vc = vc;
+  return request;
+}
+
+// Test read dispatch and the RdRsp beat with its credit return
+void test_read_response() {
+  std::cout << "test_read_response: ";
+
+  UpliCompleter completer(UpliCompleterConfig{.physical_acc_id = 3});
+
+  std::vector<UpliCompleterRequest> requests;
+  completer.set_request_callback(
+      [&](const UpliCompleterRequest& request,
+          std::span<const std::byte> write_data) {
+        assert(write_data.empty());
+        requests.push_back(request);
+      });
+  std::vector<UpliRdRspFields> responses;
+  completer.set_rd_rsp_sink(
+      [&](const UpliRdRspFields& beat) { responses.push_back(beat); });
+  std::vector<UpliCreditReturn> credits;
+  completer.set_credit_return_sink(
+      [&](const UpliCreditReturn& credit) { credits.push_back(credit); });
+
+  completer.process_request(make_request(0, 7, ReqCmd::kRead, 3));
+  assert(requests.size() == 1);
+  assert(requests[0].tag == 7 && requests[0].address == 0x8000 + (7 * 64));
+  assert(requests[0].src_acc_id == 0x12 && requests[0].vc == 3);
+  assert(completer.pending() == 1);
+
+  // Nothing goes out until the application answers
+  completer.advance_cycle();
+  assert(responses.empty());
+
+  const std::array<std::byte, 4> data{std::byte{1}, std::byte{2},
+                                      std::byte{3}, std::byte{4}};
+  assert(completer.send_read_response(0, 7, RspStatus::kTargetAbort, data));
+  completer.advance_cycle();
+
+  assert(responses.size() == 1);
+  assert(responses[0].rd_rsp_tag == 7);
+  assert(responses[0].rd_rsp_status ==
+         static_cast<std::uint8_t>(RspStatus::kTargetAbort));
+  assert(responses[0].data[3] == std::byte{4});
+  assert(responses[0].data[4] == std::byte{0});
+
+  assert(credits.size() == 1);
+  assert(credits[0].ports[0].credit_vld);
+  assert(credits[0].ports[0].credit_vc == 3);
+  assert(credits[0].ports[0].credit_num == 0);
+  assert(completer.pending() == 0);
+
+  std::cout << "PASS\n";
+}
+
+// Test that writes wait for their data beat, in order per port
+void test_write_data_pairing() {
+  std::cout << "test_write_data_pairing: ";
+
+  UpliCompleter completer(
+      UpliCompleterConfig{.bifurcation = BifurcationMode::kX2});
+
+  std::vector<std::uint16_t> dispatched;
+  std::vector<std::byte> first_bytes;
+  completer.set_request_callback(
+      [&](const UpliCompleterRequest& request,
+          std::span<const std::byte> write_data) {
+        assert(write_data.size() == kUpliDataBeatBytes);
+        dispatched.push_back(request.tag);
+        first_bytes.push_back(write_data[0]);
+      });
+  std::vector<std::uint16_t> responses;
+  completer.set_wr_rsp_sink([&](const UpliWrRspFields& beat) {
+    responses.push_back(beat.wr_rsp_tag);
+  });
+
+  completer.process_request(make_request(1, 10, ReqCmd::kWriteFull));
+  completer.process_request(make_request(1, 11, ReqCmd::kWriteFull));
+  completer.process_request(make_request(0, 10, ReqCmd::kWriteFull));
+  assert(dispatched.empty());
+
+  UpliOrigDataFields data{};
+  data.orig_data_vld = true;
+  data.orig_data_port_id = 1;
+  data.data[0] = std::byte{0xA};
+  completer.process_orig_data(data);
+  data.data[0] = std::byte{0xB};
+  completer.process_orig_data(data);
+  data.orig_data_port_id = 0;
+  data.data[0] = std::byte{0xC};
+  completer.process_orig_data(data);
+
+  assert((dispatched == std::vector<std::uint16_t>{10, 11, 10}));
+  assert((first_bytes ==
+          std::vector<std::byte>{std::byte{0xA}, std::byte{0xB},
+                                 std::byte{0xC}}));
+
+  // Port 1's responses go out in its TDM slots only
+  assert(completer.send_write_response(1, 11, RspStatus::kOkay));
+  assert(completer.send_write_response(1, 10, RspStatus::kOkay));
+  completer.advance_cycle();
+  assert(responses.empty());
+  completer.advance_cycle();
+  completer.advance_cycle();
+  completer.advance_cycle();
+  assert((responses == std::vector<std::uint16_t>{11, 10}));
+
+  const auto stats = completer.get_stats();
+  assert(stats.writes_received == 3);
+  assert(stats.write_responses == 2);
+  assert(stats.max_pending == 3);
+  assert(completer.pending() == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Test that a write waits for all of its beats and a read answers with one
+// RdRsp beat per 64 bytes, returning a single credit
+void test_multi_beat_transfers() {
+  std::cout << "test_multi_beat_transfers: ";
+
+  UpliCompleter completer(UpliCompleterConfig{.physical_acc_id = 3});
+
+  std::vector<std::byte> write_data;
+  completer.set_request_callback(
+      [&](const UpliCompleterRequest&, std::span<const std::byte> data) {
+        write_data.assign(data.begin(), data.end());
+      });
+  std::vector<UpliRdRspFields> responses;
+  completer.set_rd_rsp_sink(
+      [&](const UpliRdRspFields& beat) { responses.push_back(beat); });
+  std::size_t credits = 0;
+  completer.set_credit_return_sink([&](const UpliCreditReturn& credit) {
+    credits += credit.ports[0].credit_num + 1U;
+  });
+
+  // 192 bytes in three beats
+  UpliRequestFields write = make_request(0, 4, ReqCmd::kWriteFull);
+  write.req_len = 47;
+  write.req_num_beats = 2;
+  completer.process_request(write);
+  UpliOrigDataFields data{};
+  data.orig_data_vld = true;
+  for (std::uint8_t beat = 0; beat < 3; ++beat) {
+    assert(write_data.empty());
+    data.data.fill(static_cast<std::byte>(beat));
+    completer.process_orig_data(data);
+  }
+  assert(write_data.size() == 192);
+  assert(write_data[0] == std::byte{0} && write_data[64] == std::byte{1});
+  assert(write_data[191] == std::byte{2});
+  assert(completer.get_stats().orig_data_beats == 3);
+
+  // A 256-byte read; its data is answered from one buffer
+  UpliRequestFields read = make_request(0, 5, ReqCmd::kRead);
+  read.req_len = 63;
+  completer.process_request(read);
+  std::array<std::byte, kUpliMaxTransferBytes> read_data{};
+  read_data[0] = std::byte{0x10};
+  read_data[255] = std::byte{0x13};
+  assert(completer.send_read_response(0, 5, RspStatus::kOkay, read_data));
+  for (int cycle = 0; cycle < 4; ++cycle) {
+    completer.advance_cycle();
+  }
+  assert(responses.size() == 4);
+  assert(responses[0].data[0] == std::byte{0x10});
+  assert(responses[3].data[63] == std::byte{0x13});
+  assert(completer.get_stats().read_responses == 1);
+  assert(completer.get_stats().rd_rsp_beats == 4);
+  assert(credits == 1);
+  assert(completer.pending() == 1);
+
+  // req_num_beats must agree with req_len
+  write.req_tag = 6;
+  write.req_num_beats = 1;
+  bool caught = false;
+  try {
+    completer.process_request(write);
+  } catch (const std::invalid_argument&) {
+    caught = true;
+  }
+  assert(caught);
+
+  std::cout << "PASS\n";
+}
+
+// Test protocol errors
+void test_validation_errors() {
+  std::cout << "test_validation_errors: ";
+
+  const auto expect_throw = [](auto&& action) {
+    bool caught = false;
+    try {
+      action();
+    } catch (const std::invalid_argument&) {
+      caught = true;
+    }
+    assert(caught);
+  };
+
+  UpliCompleter completer(UpliCompleterConfig{});
+  completer.process_request(make_request(0, 1, ReqCmd::kRead));
+
+  // Duplicate tag, inactive port, unsupported command
+  expect_throw(
+      [&] { completer.process_request(make_request(0, 1, ReqCmd::kRead)); });
+  expect_throw(
+      [&] { completer.process_request(make_request(1, 2, ReqCmd::kRead)); });
+  expect_throw(
+      [&] { completer.process_request(make_request(0, 2, ReqCmd::kAtomicR)); });
+
+  // Data with no write waiting, wrong response kind, unknown tag
+  expect_throw([&] { completer.process_orig_data(UpliOrigDataFields{}); });
+  expect_throw([&] {
+    (void)completer.send_write_response(0, 1, RspStatus::kOkay);
+  });
+  expect_throw([&] {
+    (void)completer.send_read_response(0, 2, RspStatus::kOkay, {});
+  });
+
+  // Full response queue: the request stays dispatched and can be retried
+  UpliCompleter small(UpliCompleterConfig{.queue_depth = 1});
+  small.process_request(make_request(0, 1, ReqCmd::kRead));
+  small.process_request(make_request(0, 2, ReqCmd::kRead));
+  assert(small.send_read_response(0, 1, RspStatus::kOkay, {}));
+  assert(!small.send_read_response(0, 2, RspStatus::kOkay, {}));
+  assert(small.get_stats().response_queue_full == 1);
+  small.advance_cycle();
+  assert(small.send_read_response(0, 2, RspStatus::kOkay, {}));
+
+  std::cout << "PASS\n";
+}
+
+int main() {
+  std::cout << "\n=== UPLI Completer Tests ===\n\n";
+
+  test_read_response();
+  test_write_data_pairing();
+  test_multi_beat_transfers();
+  test_validation_errors();
+
+  std::cout << "\n=== All UPLI Completer Tests Passed ===\n";
+  return 0;
+}
\ No newline at end of file
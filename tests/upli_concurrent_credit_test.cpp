@@ -0,0 +1,184 @@
+#include "ualink/upli_concurrent_credit.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ualink::upli;
+
+// Matches UpliCreditManager for single-threaded consume and return
+void test_single_threaded_accounting() {
+  std::cout << "test_single_threaded_accounting: ";
+
+  UpliConcurrentCreditManager credits;
+
+  PortCreditConfig config{};
+  config.vc_config[0].initial_credits = 2;
+  config.vc_config[1].initial_credits = 8;
+  config.vc_config[3].enabled = false;
+  credits.configure_port(0, config);
+  credits.initialize_credits();
+
+  assert(credits.get_available_credits(0, 0) == 2);
+  assert(credits.get_available_credits(0, 1) == 8);
+  assert(credits.get_available_credits(0, 3) == 0);
+
+  assert(credits.try_consume_credit(0, 0));
+  assert(credits.try_consume_credit(0, 0));
+  assert(!credits.try_consume_credit(0, 0));
+  assert(!credits.try_consume_credit(0, 3));
+  assert(credits.get_stats(0, 0).send_blocked_count == 1);
+
+  // Credit return message: VC0 gets 2 credits (credit_num encodes n - 1)
+  UpliCreditReturn credit_return{};
+  credit_return.ports[0].credit_vld = true;
+  credit_return.ports[0].credit_vc = 0;
+  credit_return.ports[0].credit_num = 1;
+  credits.process_credit_return(credit_return);
+  assert(credits.get_available_credits(0, 0) == 2);
+  assert(credits.get_stats(0, 0).credits_returned == 2);
+  assert(credits.get_stats(0, 0).over_returned == 0);
+
+  // A return past the initial credits is kept but flagged
+  assert(credits.return_credits(0, 0, 1));
+  assert(credits.get_available_credits(0, 0) == 3);
+  assert(credits.get_stats(0, 0).over_returned == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Pool mode: every VC draws from the port's shared counter
+void test_pool_credits() {
+  std::cout << "test_pool_credits: ";
+
+  UpliConcurrentCreditManager credits;
+
+  PortCreditConfig config{};
+  config.use_pool = true;
+  config.pool_credits = 3;
+  credits.configure_port(1, config);
+  credits.initialize_credits();
+
+  assert(credits.try_consume_credit(1, 0));
+  assert(credits.try_consume_credit(1, 2));
+  assert(credits.try_consume_credit(1, 3));
+  assert(!credits.try_consume_credit(1, 1));
+
+  UpliCreditReturn credit_return{};
+  credit_return.ports[1].credit_vld = true;
+  credit_return.ports[1].credit_pool = true;
+  credit_return.ports[1].credit_num = 0;
+  credits.process_credit_return(credit_return);
+  assert(credits.get_available_credits(1, 1) == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Traffic-path calls reject bad input instead of throwing
+void test_out_of_range() {
+  std::cout << "test_out_of_range: ";
+
+  UpliConcurrentCreditManager credits;
+  credits.initialize_credits();
+
+  assert(!credits.try_consume_credit(kMaxPorts, 0));
+  assert(!credits.try_consume_credit(0, kMaxVirtualChannels));
+  assert(!credits.return_credits(kMaxPorts, 0, 1));
+  assert(credits.get_available_credits(0, kMaxVirtualChannels) == 0);
+
+  bool caught = false;
+  try {
+    credits.configure_port(kMaxPorts, PortCreditConfig{});
+  } catch (const std::invalid_argument&) {
+    caught = true;
+  }
+  assert(caught);
+
+  std::cout << "PASS\n";
+}
+
+// Senders on several threads race a returner on one VC. No credit may be
+// handed out twice, and every credit must end up back in the counter.
+void test_concurrent_consume_and_return() {
+  std::cout << "test_concurrent_consume_and_return: ";
+
+  constexpr std::size_t kSenders = 4;
+  constexpr std::size_t kSendsPerThread = 20'000;
+  constexpr std::size_t kCredits = 8;
+
+  UpliConcurrentCreditManager credits;
+  PortCreditConfig config{};
+  config.vc_config[2].initial_credits = kCredits;
+  credits.configure_port(0, config);
+  credits.initialize_credits();
+
+  std::atomic<std::size_t> in_use{0};
+  std::atomic<std::size_t> max_in_use{0};
+  std::atomic<std::size_t> to_return{0};
+  std::atomic<bool> senders_done{false};
+
+  std::vector<std::thread> senders;
+  for (std::size_t sender = 0; sender < kSenders; ++sender) {
+    senders.emplace_back([&]() {
+      for (std::size_t send = 0; send < kSendsPerThread; ++send) {
+        while (!credits.try_consume_credit(0, 2)) {
+          std::this_thread::yield();
+        }
+        const std::size_t now = in_use.fetch_add(1) + 1;
+        std::size_t seen = max_in_use.load();
+        while (now > seen && !max_in_use.compare_exchange_weak(seen, now)) {
+        }
+        in_use.fetch_sub(1);
+        to_return.fetch_add(1);
+      }
+    });
+  }
+
+  std::thread returner([&]() {
+    std::size_t returned = 0;
+    while (!senders_done.load() || to_return.load() != 0) {
+      const std::size_t owed = to_return.exchange(0);
+      if (owed == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      const bool accepted = credits.return_credits(0, 2, owed);
+      assert(accepted);
+      (void)accepted;
+      returned += owed;
+    }
+    assert(returned == kSenders * kSendsPerThread);
+    (void)returned;
+  });
+
+  for (auto& sender : senders) {
+    sender.join();
+  }
+  senders_done.store(true);
+  returner.join();
+
+  assert(max_in_use.load() <= kCredits);
+  assert(credits.get_available_credits(0, 2) == kCredits);
+  const auto stats = credits.get_stats(0, 2);
+  assert(stats.credits_returned == kSenders * kSendsPerThread);
+  assert(stats.over_returned == 0);
+
+  std::cout << "PASS\n";
+}
+
+int main() {
+  std::cout << "\n=== UPLI Concurrent Credit Manager Tests ===\n\n";
+
+  test_single_threaded_accounting();
+  test_pool_credits();
+  test_out_of_range();
+  test_concurrent_consume_and_return();
+
+  std::cout << "\n=== All UPLI Concurrent Credit Manager Tests Passed ===\n";
+  return 0;
+}
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "ualink/upli_credit.h"
 
+#include <array>
 #include <cassert>
 #include <iostream>
+#include <utility>
 
 using namespace ualink::upli;
 
@@ -191,21 +193,80 @@ void test_credit_return_generation() {
   manager.configure_port(0, config);
   manager.initialize_credits();
 
-  // No credits consumed yet, no return needed
+  // No credits owed yet, no return needed
   auto return_msg = manager.generate_credit_return();
-  // Note: Implementation returns init_done even with no consumption
-  // This is fine for the simple implementation
+  assert(!return_msg.has_value());
 
-  // Consume some credits
+  // Consuming credits on the send side owes nothing
   assert(manager.consume_credit(0, 0));
   assert(manager.consume_credit(0, 0));
+  assert(!manager.generate_credit_return().has_value());
+
+  // Receive side frees two buffers
+  manager.owe_credits(0, 0, 2);
+  assert(manager.get_owed_credits(0, 0) == 2);
 
-  // Generate credit return
+  // Generate credit return: both credits in one entry
   return_msg = manager.generate_credit_return();
   assert(return_msg.has_value());
   assert(return_msg->ports[0].credit_vld);
   assert(return_msg->ports[0].credit_vc == 0);
+  assert(return_msg->ports[0].credit_num == 1);
   assert(return_msg->credit_init_done[0]);
+  assert(manager.get_owed_credits(0, 0) == 0);
+  assert(!manager.generate_credit_return().has_value());
+
+  std::cout << "PASS\n";
+}
+
+// Test owed credits coalesce to four per entry and rotate across VCs/pool
+void test_batched_credit_return() {
+  std::cout << "test_batched_credit_return: ";
+
+  UpliCreditManager manager;
+  manager.initialize_credits();
+
+  manager.owe_credits(0, 0, 9);
+  manager.owe_credits(0, 2, 1);
+  manager.owe_pool_credits(0, 4);
+  manager.owe_credits(3, 1, 3);
+  assert(manager.get_owed_pool_credits(0) == 4);
+
+  // Port 0: VC0 x4, VC2 x1, pool x4, VC0 x4, VC0 x1
+  const std::array<std::pair<int, std::size_t>, 5> expected{{
+      {0, 4}, {2, 1}, {-1, 4}, {0, 4}, {0, 1}}};
+  for (std::size_t index = 0; index < expected.size(); ++index) {
+    const auto return_msg = manager.generate_credit_return();
+    assert(return_msg.has_value());
+    const auto& port_credit = return_msg->ports[0];
+    assert(port_credit.credit_vld);
+    if (expected[index].first < 0) {
+      assert(port_credit.credit_pool);
+    } else {
+      assert(!port_credit.credit_pool);
+      assert(port_credit.credit_vc == expected[index].first);
+    }
+    assert(port_credit.credit_num + 1U == expected[index].second);
+
+    // Port 3 is returned alongside port 0 in the first message
+    assert(return_msg->ports[3].credit_vld == (index == 0));
+  }
+  assert(!manager.generate_credit_return().has_value());
+
+  // A sender applying the messages sees every owed credit exactly once
+  UpliCreditManager sender;
+  PortCreditConfig config{};
+  config.vc_config[1].initial_credits = 8;
+  sender.configure_port(1, config);
+  sender.initialize_credits();
+  for (int index = 0; index < 8; ++index) {
+    assert(sender.consume_credit(1, 1));
+  }
+  manager.owe_credits(1, 1, 6);
+  while (const auto return_msg = manager.generate_credit_return()) {
+    sender.process_credit_return(*return_msg);
+  }
+  assert(sender.get_available_credits(1, 1) == 6);
 
   std::cout << "PASS\n";
 }
@@ -350,6 +411,7 @@ int main() {
   test_pool_credits();
   test_multiple_ports();
   test_credit_return_generation();
+  test_batched_credit_return();
   test_reset();
   test_credit_capping();
 
@@ -359,4 +421,4 @@ int main() {
 
   std::cout << "\n=== All UPLI Credit Manager Tests Passed ===\n";
   return 0;
-}
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include "ualink/upli_ordering.h"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+using namespace ualink::upli;
+
+// Test that a 256-byte region always maps to the same port
+void test_required_port() {
+  std::cout << "test_required_port: ";
+
+  UpliOrderingManager x4(OrderingMode::kRelaxed, BifurcationMode::kX4);
+  UpliOrderingManager x2(OrderingMode::kRelaxed, BifurcationMode::kX2);
+  UpliOrderingManager x1(OrderingMode::kRelaxed, BifurcationMode::kX1);
+
+  assert(x4.get_required_port(0x12345) == 0);
+  assert(x2.get_required_port(0x000) == 0);
+  assert(x2.get_required_port(0x0FF) == 0);
+  assert(x2.get_required_port(0x100) == 1);
+  assert(x1.get_required_port(0x300) == 3);
+  assert(x1.get_required_port(0x4C0) == 0);
+
+  // Issue on the wrong port is refused
+  assert(x2.can_issue_request(0x100, 1, 0));
+  assert(!x2.can_issue_request(0x100, 0, 0));
+
+  std::cout << "PASS\n";
+}
+
+// Test relaxed mode: same region and VC pipelines, another VC waits
+void test_relaxed_ordering() {
+  std::cout << "test_relaxed_ordering: ";
+
+  UpliOrderingManager ordering(OrderingMode::kRelaxed);
+
+  ordering.track_request(0x1000, 0, 1, 10);
+  assert(ordering.can_issue_request(0x1040, 0, 1));
+  ordering.track_request(0x1040, 0, 1, 11);
+  assert(ordering.region_in_flight(0x10C0, 1) == 2);
+
+  // Same region on another VC could overtake; a different region is free
+  assert(!ordering.can_issue_request(0x1080, 0, 0));
+  assert(ordering.can_issue_request(0x1100, 0, 0));
+
+  ordering.complete_request(10);
+  assert(!ordering.can_issue_request(0x1080, 0, 0));
+  ordering.complete_request(11);
+  assert(ordering.can_issue_request(0x1080, 0, 0));
+  assert(ordering.region_in_flight(0x1000, 1) == 0);
+  assert(ordering.in_flight_count() == 0);
+
+  std::cout << "PASS\n";
+}
+
+// Test strict mode: one request in flight per region
+void test_strict_ordering() {
+  std::cout << "test_strict_ordering: ";
+
+  UpliOrderingManager ordering(OrderingMode::kStrict, BifurcationMode::kX2);
+
+  ordering.track_request(0x2000, 0, 0, 1);
+  assert(!ordering.can_issue_request(0x2040, 0, 0));
+  assert(!ordering.can_issue_request(0x2040, 0, 2));
+  assert(ordering.can_issue_request(0x2100, 1, 0));
+
+  ordering.complete_request(1);
+  assert(ordering.can_issue_request(0x2040, 0, 2));
+
+  std::cout << "PASS\n";
+}
+
+// Test tag bookkeeping across the full 11-bit tag space
+void test_tag_tracking() {
+  std::cout << "test_tag_tracking: ";
+
+  UpliOrderingManager ordering(OrderingMode::kRelaxed);
+  for (std::uint16_t tag = 0; tag < kUpliTagCount; ++tag) {
+    ordering.track_request(static_cast<std::uint64_t>(tag) * 64, 0, 0, tag);
+  }
+  assert(ordering.in_flight_count() == kUpliTagCount);
+  assert(ordering.is_tag_in_flight(2047));
+  assert(ordering.region_in_flight(0, 0) == 4);
+
+  // Complete out of order
+  for (std::uint16_t tag = kUpliTagCount; tag-- > 0;) {
+    ordering.complete_request(tag);
+  }
+  assert(ordering.in_flight_count() == 0);
+  assert(!ordering.is_tag_in_flight(0));
+
+  const auto stats = ordering.get_stats();
+  assert(stats.requests_tracked == kUpliTagCount);
+  assert(stats.requests_completed == kUpliTagCount);
+  assert(stats.max_in_flight == kUpliTagCount);
+
+  std::cout << "PASS\n";
+}
+
+// Test argument validation
+void test_validation_errors() {
+  std::cout << "test_validation_errors: ";
+
+  UpliOrderingManager ordering(OrderingMode::kRelaxed, BifurcationMode::kX2);
+  ordering.track_request(0x0, 0, 0, 5);
+
+  const auto expect_throw = [](auto&& action) {
+    bool caught = false;
+    try {
+      action();
+    } catch (const std::invalid_argument&) {
+      caught = true;
+    }
+    assert(caught);
+  };
+
+  expect_throw([&] { ordering.track_request(0x40, 0, 0, 5); });  // Duplicate
+  expect_throw([&] { ordering.track_request(0x40, 2, 0, 6); });  // Port
+  expect_throw([&] { ordering.track_request(0x40, 0, 4, 6); });  // VC
+  expect_throw([&] { ordering.track_request(0x40, 0, 0, 2048); });
+  expect_throw([&] { ordering.complete_request(6); });
+  assert(!ordering.can_issue_request(0x40, 0, 4));
+
+  // Failed calls leave the state untouched
+  assert(ordering.in_flight_count() == 1);
+  ordering.complete_request(5);
+  expect_throw([&] { ordering.complete_request(5); });
+
+  std::cout << "PASS\n";
+}
+
+int main() {
+  std::cout << "\n=== UPLI Ordering Manager Tests ===\n\n";
+
+  test_required_port();
+  test_relaxed_ordering();
+  test_strict_ordering();
+  test_tag_tracking();
+  test_validation_errors();
+
+  std::cout << "\n=== All UPLI Ordering Manager Tests Passed ===\n";
+  return 0;
+}
\ No newline at end of file
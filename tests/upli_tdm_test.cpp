@@ -0,0 +1,199 @@
+#include "ualink/upli_tdm.h"
+
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ualink::upli;
+
+// Test which port owns each cycle in every bifurcation mode
+void test_slot_ownership() {
+  std::cout << "test_slot_ownership: ";
+
+  UpliTdmScheduler x4(BifurcationMode::kX4);
+  UpliTdmScheduler x2(BifurcationMode::kX2);
+  UpliTdmScheduler x1(BifurcationMode::kX1);
+  assert(x4.num_active_ports() == 1);
+  assert(x2.num_active_ports() == 2);
+  assert(x1.num_active_ports() == 4);
+  assert(x2.is_port_active(1) && !x2.is_port_active(2));
+
+  for (std::uint64_t cycle = 0; cycle < 8; ++cycle) {
+    assert(x4.current_port_id() == 0);
+    assert(x2.current_port_id() == cycle % 2);
+    assert(x1.current_port_id() == cycle % 4);
+    assert(x1.can_transmit_on_port(static_cast<std::uint8_t>(cycle % 4)));
+    x4.advance_cycle();
+    x2.advance_cycle();
+    x1.advance_cycle();
+  }
+  assert(x1.cycle() == 8);
+
+  std::cout << "PASS\n";
+}
+
+// Test per-port bandwidth: a saturated port gets 1/N of the cycles
+void test_per_port_bandwidth() {
+  std::cout << "test_per_port_bandwidth: ";
+
+  constexpr std::size_t kCycles = 64;
+  for (const BifurcationMode mode :
+       {BifurcationMode::kX4, BifurcationMode::kX2, BifurcationMode::kX1}) {
+    UpliTdmScheduler scheduler(mode, kCycles);
+    const std::size_t ports = scheduler.num_active_ports();
+    for (std::uint8_t port = 0; port < ports; ++port) {
+      for (std::uint16_t tag = 0; tag < kCycles; ++tag) {
+        assert(scheduler.enqueue(port, UpliChannel::kRequest, {.tag = tag}));
+      }
+    }
+
+    std::vector<std::uint8_t> granted_ports;
+    for (std::size_t cycle = 0; cycle < kCycles; ++cycle) {
+      scheduler.advance_cycle(
+          [&](std::uint8_t port, UpliChannel channel, const UpliTdmBeat&) {
+            assert(channel == UpliChannel::kRequest);
+            granted_ports.push_back(port);
+          });
+    }
+
+    assert(granted_ports.size() == kCycles);
+    for (std::size_t index = 0; index < granted_ports.size(); ++index) {
+      assert(granted_ports[index] == index % ports);
+    }
+    for (std::uint8_t port = 0; port < ports; ++port) {
+      const auto& stats = scheduler.get_stats(port, UpliChannel::kRequest);
+      assert(stats.beats_sent == kCycles / ports);
+      assert(stats.slots_owned == kCycles / ports);
+      assert(stats.idle_slots == 0);
+      assert(scheduler.port_throughput(port) ==
+             1.0 / static_cast<double>(ports));
+      // The other channels owned the same slots with nothing to send
+      assert(scheduler.get_stats(port, UpliChannel::kWrRsp).idle_slots ==
+             kCycles / ports);
+    }
+  }
+
+  std::cout << "PASS\n";
+}
+
+// Test that channels are scheduled independently in the same slot
+void test_channels_in_parallel() {
+  std::cout << "test_channels_in_parallel: ";
+
+  UpliTdmScheduler scheduler(BifurcationMode::kX4);
+  assert(scheduler.enqueue(0, UpliChannel::kRequest, {.tag = 1}));
+  assert(scheduler.enqueue(0, UpliChannel::kOrigData, {.tag = 1}));
+  assert(scheduler.enqueue(0, UpliChannel::kRdRsp, {.tag = 2}));
+  assert(scheduler.enqueue(0, UpliChannel::kWrRsp, {.tag = 3}));
+
+  std::array<bool, kUpliChannelCount> seen{};
+  assert(scheduler.advance_cycle(
+             [&](std::uint8_t, UpliChannel channel, const UpliTdmBeat&) {
+               seen[static_cast<std::size_t>(channel)] = true;
+             }) == 4);
+  assert(seen[0] && seen[1] && seen[2] && seen[3]);
+  assert(scheduler.port_throughput(0) == 4.0);
+
+  std::cout << "PASS\n";
+}
+
+// Test head-of-line blocking when the head beat is not ready
+void test_head_of_line_blocking() {
+  std::cout << "test_head_of_line_blocking: ";
+
+  UpliTdmScheduler scheduler(BifurcationMode::kX2);
+
+  // VC 1 on port 0 has no credit; beats queued behind it wait too
+  bool vc1_credit = false;
+  scheduler.set_ready_predicate(
+      [&](std::uint8_t, UpliChannel, const UpliTdmBeat& beat) {
+        return beat.vc != 1 || vc1_credit;
+      });
+  assert(scheduler.enqueue(0, UpliChannel::kRequest, {.tag = 1, .vc = 1}));
+  assert(scheduler.enqueue(0, UpliChannel::kRequest, {.tag = 2, .vc = 0}));
+  assert(scheduler.enqueue(0, UpliChannel::kRequest, {.tag = 3, .vc = 0}));
+  assert(scheduler.enqueue(1, UpliChannel::kRequest, {.tag = 4, .vc = 0}));
+
+  std::vector<std::uint16_t> granted_tags;
+  const auto on_grant = [&](std::uint8_t, UpliChannel,
+                            const UpliTdmBeat& beat) {
+    granted_tags.push_back(beat.tag);
+  };
+
+  // Port 0 loses both of its slots; port 1 is unaffected
+  for (int cycle = 0; cycle < 4; ++cycle) {
+    scheduler.advance_cycle(on_grant);
+  }
+  assert(granted_tags == std::vector<std::uint16_t>{4});
+  const auto& blocked = scheduler.get_stats(0, UpliChannel::kRequest);
+  assert(blocked.blocked_slots == 2);
+  assert(blocked.hol_blocked_beats == 4);
+  assert(scheduler.queue_size(0, UpliChannel::kRequest) == 3);
+
+  // Credit arrives: port 0 drains in order on its own slots
+  vc1_credit = true;
+  for (int cycle = 0; cycle < 6; ++cycle) {
+    scheduler.advance_cycle(on_grant);
+  }
+  assert((granted_tags == std::vector<std::uint16_t>{4, 1, 2, 3}));
+  assert(scheduler.get_stats(0, UpliChannel::kRequest).beats_sent == 3);
+
+  scheduler.reset_stats();
+  assert(scheduler.get_stats(0, UpliChannel::kRequest).blocked_slots == 0);
+  assert(scheduler.port_throughput(0) == 0.0);
+
+  std::cout << "PASS\n";
+}
+
+// Test queue capacity and argument validation
+void test_queue_limits_and_errors() {
+  std::cout << "test_queue_limits_and_errors: ";
+
+  UpliTdmScheduler scheduler(BifurcationMode::kX2, 2);
+  assert(scheduler.enqueue(1, UpliChannel::kRdRsp, {.tag = 1}));
+  assert(scheduler.enqueue(1, UpliChannel::kRdRsp, {.tag = 2}));
+  assert(!scheduler.enqueue(1, UpliChannel::kRdRsp, {.tag = 3}));
+  const auto& stats = scheduler.get_stats(1, UpliChannel::kRdRsp);
+  assert(stats.enqueue_rejected == 1);
+  assert(stats.max_queue_size == 2);
+
+  // Draining frees space; the ring wraps
+  scheduler.advance_cycle();
+  scheduler.advance_cycle();
+  assert(scheduler.queue_size(1, UpliChannel::kRdRsp) == 1);
+  assert(scheduler.enqueue(1, UpliChannel::kRdRsp, {.tag = 3}));
+
+  bool caught = false;
+  try {
+    [[maybe_unused]] const bool queued =
+        scheduler.enqueue(2, UpliChannel::kRequest, {});
+  } catch (const std::invalid_argument&) {
+    caught = true;
+  }
+  assert(caught);
+
+  caught = false;
+  try {
+    UpliTdmScheduler empty(BifurcationMode::kX4, 0);
+  } catch (const std::invalid_argument&) {
+    caught = true;
+  }
+  assert(caught);
+
+  std::cout << "PASS\n";
+}
+
+int main() {
+  std::cout << "\n=== UPLI TDM Scheduler Tests ===\n\n";
+
+  test_slot_ownership();
+  test_per_port_bandwidth();
+  test_channels_in_parallel();
+  test_head_of_line_blocking();
+  test_queue_limits_and_errors();
+
+  std::cout << "\n=== All UPLI TDM Scheduler Tests Passed ===\n";
+  return 0;
+}
\ No newline at end of file
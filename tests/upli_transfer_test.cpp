@@ -0,0 +1,255 @@
+#include "ualink/upli_completer.h"
+#include "ualink/upli_transfer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace ualink::upli;
+
+constexpr std::size_t kMemoryBytes = 256 * 1024;
+
+// Transfer engine wired straight to a completer backed by a flat memory. The
+// completer answers every request at once, failing reads of fail_address.
+struct Loopback {
+  explicit Loopback(const UpliTransferEngineConfig& config)
+      : engine(config),
+        completer(UpliCompleterConfig{
+            .physical_acc_id = 1,
+            .bifurcation = config.originator.bifurcation,
+            .queue_depth = kUpliTagCount}),
+        memory(kMemoryBytes) {
+    UpliOriginator& originator = engine.originator();
+    originator.set_request_sink([this](const UpliRequestFields& beat) {
+      completer.process_request(beat);
+    });
+    originator.set_orig_data_sink([this](const UpliOrigDataFields& beat) {
+      completer.process_orig_data(beat);
+    });
+    completer.set_rd_rsp_sink([&originator](const UpliRdRspFields& beat) {
+      originator.process_rd_rsp(beat);
+    });
+    completer.set_wr_rsp_sink([&originator](const UpliWrRspFields& beat) {
+      originator.process_wr_rsp(beat);
+    });
+    completer.set_credit_return_sink(
+        [&originator](const UpliCreditReturn& credits) {
+          originator.process_credit_return(credits);
+        });
+    completer.set_request_callback([this](const UpliCompleterRequest& request,
+                                          std::span<const std::byte> data) {
+      requests.push_back(request);
+      const std::size_t bytes = (static_cast<std::size_t>(request.len) + 1) * 4;
+      if (request.cmd == ReqCmd::kRead) {
+        RspStatus status = RspStatus::kOkay;
+        if (request.address == fail_address) {
+          status = RspStatus::kTargetAbort;
+        }
+        assert(completer.send_read_response(
+            request.port_id, request.tag, status,
+            std::span<const std::byte>(memory).subspan(request.address,
+                                                       bytes)));
+      } else {
+        const std::span<std::byte> target(memory);
+        std::copy(data.begin(), data.end(),
+                  target.subspan(request.address).begin());
+        assert(completer.send_write_response(request.port_id, request.tag,
+                                             RspStatus::kOkay));
+      }
+    });
+    engine.set_completion_callback(
+        [this](const UpliTransferCompletion& completion) {
+          completions.push_back(completion);
+        });
+  }
+
+  // Run until every transfer has completed
+  void run() {
+    for (std::size_t cycle = 0; cycle < 100000 && engine.active() > 0;
+         ++cycle) {
+      engine.advance_cycle();
+      completer.advance_cycle();
+    }
+    assert(engine.active() == 0);
+  }
+
+  UpliTransferEngine engine;
+  UpliCompleter completer;
+  std::vector<std::byte> memory;
+  std::vector<UpliCompleterRequest> requests;
+  std::vector<UpliTransferCompletion> completions;
+  std::uint64_t fail_address{~0ULL};
+};
+
+std::vector<std::byte> pattern(std::size_t bytes, unsigned seed) {
+  std::vector<std::byte> data(bytes);
+  for (std::size_t i = 0; i < bytes; ++i) {
+    data[i] = static_cast<std::byte>((i * 7 + seed) & 0xFF);
+  }
+  return data;
+}
+
+// Test a 64 KiB write and read back, 256 bytes per transaction
+void test_large_round_trip() {
+  std::cout << "test_large_round_trip: ";
+
+  Loopback loop(UpliTransferEngineConfig{});
+
+  const std::vector<std::byte> source = pattern(64 * 1024, 3);
+  const auto write_id = loop.engine.write(1, 0x10000, source);
+  assert(write_id.has_value());
+  loop.run();
+  assert(loop.completions.size() == 1);
+  assert(loop.completions[0].id == *write_id);
+  assert(loop.completions[0].write);
+  assert(loop.completions[0].status == RspStatus::kOkay);
+  assert(loop.completions[0].bytes == source.size());
+  assert(loop.completions[0].transactions == 256);
+  assert(std::equal(source.begin(), source.end(),
+                    loop.memory.begin() + 0x10000));
+
+  // Every transaction is a full 256-byte region
+  for (const auto& request : loop.requests) {
+    assert(request.len == 63);
+    assert(request.address % kRegionAlignmentBytes == 0);
+  }
+
+  std::vector<std::byte> destination(source.size());
+  const auto read_id = loop.engine.read(1, 0x10000, destination);
+  assert(read_id.has_value() && *read_id != *write_id);
+  loop.run();
+  assert(loop.completions.size() == 2);
+  assert(loop.completions[1].id == *read_id);
+  assert(!loop.completions[1].write);
+  assert(loop.completions[1].transactions == 256);
+  assert(loop.completions[1].complete_cycle >
+         loop.completions[1].submit_cycle);
+  assert(destination == source);
+
+  const auto stats = loop.engine.get_stats();
+  assert(stats.transfers_completed == 2);
+  assert(stats.transactions_issued == 512);
+  assert(stats.bytes_written == source.size());
+  assert(stats.bytes_read == source.size());
+  assert(stats.issue_stalls > 0);  // 64 tags for 256 transactions
+
+  std::cout << "PASS\n";
+}
+
+// Test region-split chunks and concurrent transfers sharing a few tags
+void test_unaligned_concurrent_transfers() {
+  std::cout << "test_unaligned_concurrent_transfers: ";
+
+  UpliTransferEngineConfig config{};
+  config.originator.max_outstanding_requests = 4;
+  config.max_transfers = 2;
+  Loopback loop(config);
+
+  // 0x2004..0x23EB: chunks of 252, 256, 256 and 236 bytes
+  const std::vector<std::byte> first = pattern(1000, 1);
+  const std::vector<std::byte> second = pattern(512, 9);
+  assert(loop.engine.write(1, 0x2004, first).has_value());
+  assert(loop.engine.write(1, 0x8000, second).has_value());
+  assert(loop.engine.active() == 2);
+  assert(!loop.engine.write(1, 0x9000, second).has_value());
+  assert(loop.engine.get_stats().transfer_full_stalls == 1);
+  loop.run();
+
+  assert(loop.completions.size() == 2);
+  assert(loop.completions[0].transactions == 4);
+  assert(loop.completions[1].transactions == 2);
+  assert(loop.requests.size() == 6);
+  assert(loop.requests[0].address == 0x2004 && loop.requests[0].len == 62);
+  assert(loop.requests[3].address == 0x2300 && loop.requests[3].len == 58);
+  assert(std::equal(first.begin(), first.end(), loop.memory.begin() + 0x2004));
+  assert(std::equal(second.begin(), second.end(),
+                    loop.memory.begin() + 0x8000));
+  assert(loop.memory[0x2003] == std::byte{0});
+  assert(loop.memory[0x23EC] == std::byte{0});
+
+  // Read back into unaligned slices of one buffer
+  std::vector<std::byte> destination(1000 + 512);
+  const std::span<std::byte> buffer(destination);
+  assert(loop.engine.read(1, 0x2004, buffer.first(1000)).has_value());
+  assert(loop.engine.read(1, 0x8000, buffer.subspan(1000)).has_value());
+  loop.run();
+  assert(loop.completions.size() == 4);
+  assert(std::equal(first.begin(), first.end(), destination.begin()));
+  assert(std::equal(second.begin(), second.end(), destination.begin() + 1000));
+  assert(loop.engine.get_stats().max_active == 2);
+
+  std::cout << "PASS\n";
+}
+
+// Test that one failed transaction fails the whole transfer
+void test_error_status() {
+  std::cout << "test_error_status: ";
+
+  Loopback loop(UpliTransferEngineConfig{});
+  loop.fail_address = 0x500;
+
+  std::vector<std::byte> destination(1024);
+  assert(loop.engine.read(1, 0x400, destination).has_value());
+  loop.run();
+  assert(loop.completions.size() == 1);
+  assert(loop.completions[0].status == RspStatus::kTargetAbort);
+  assert(loop.completions[0].transactions == 4);
+  assert(loop.engine.get_stats().error_transfers == 1);
+
+  std::cout << "PASS\n";
+}
+
+// Test validation errors
+void test_validation_errors() {
+  std::cout << "test_validation_errors: ";
+
+  const auto expect_throw = [](auto&& action) {
+    bool threw = false;
+    try {
+      action();
+    } catch (const std::invalid_argument&) {
+      threw = true;
+    }
+    assert(threw);
+  };
+
+  expect_throw([] {
+    UpliTransferEngine engine(UpliTransferEngineConfig{.max_transfers = 0});
+  });
+  expect_throw([] {
+    UpliTransferEngineConfig config{};
+    config.originator.queue_depth = kUpliMaxDataBeats - 1;
+    UpliTransferEngine engine(config);
+  });
+
+  UpliTransferEngine engine(UpliTransferEngineConfig{});
+  std::vector<std::byte> buffer(64);
+  const std::span<std::byte> data(buffer);
+  expect_throw([&] { (void)engine.read(1, 0, data.first(0)); });
+  expect_throw([&] { (void)engine.write(1, 0x2, data); });
+  expect_throw([&] { (void)engine.write(1, 0, data.first(6)); });
+  expect_throw([&] { (void)engine.read(1, 0x1FFFFFFFFFFFFC0ULL + 4, data); });
+  expect_throw([&] { (void)engine.read(0x400, 0, data); });
+  expect_throw([&] { (void)engine.read(1, 0, data, kMaxVirtualChannels); });
+  assert(engine.active() == 0);
+
+  // The last 64 bytes of the address space are legal
+  assert(engine.read(1, 0x1FFFFFFFFFFFFC0ULL, data).has_value());
+
+  std::cout << "PASS\n";
+}
+
+int main() {
+  std::cout << "\n=== UPLI Transfer Tests ===\n\n";
+
+  test_large_round_trip();
+  test_unaligned_concurrent_transfers();
+  test_error_status();
+  test_validation_errors();
+
+  std::cout << "\n=== All UPLI Transfer Tests Passed ===\n";
+  return 0;
+}
\ No newline at end of file